@@ -76,7 +76,23 @@ void EpdFont::getTextDimensions(const char* string, int* w, int* h) const {
   *h = maxY - minY;
 }
 
-static uint8_t lookupKernClass(const EpdKernClassEntry* entries, const uint16_t count, const uint32_t cp) {
+// Index of cp in the direct-indexed kerning class maps, or -1 outside EPD_KERN_DIRECT_RANGES
+static int kernDirectIndex(const uint32_t cp) {
+  int base = 0;
+  for (const auto& range : EPD_KERN_DIRECT_RANGES) {
+    if (cp < range[0]) return -1;
+    if (cp <= range[1]) return base + static_cast<int>(cp - range[0]);
+    base += static_cast<int>(range[1] - range[0] + 1);
+  }
+  return -1;
+}
+
+static uint8_t lookupKernClass(const uint8_t* direct, const EpdKernClassEntry* entries, const uint16_t count,
+                               const uint32_t cp) {
+  if (direct) {
+    const int index = kernDirectIndex(cp);
+    if (index >= 0) return direct[index];
+  }
   if (!entries || count == 0 || cp > 0xFFFF) {
     return 0;
   }
@@ -102,9 +118,10 @@ int8_t EpdFont::getKerning(const uint32_t leftCp, const uint32_t rightCp) const
   if (!data->kernMatrix) {
     return 0;
   }
-  const uint8_t lc = lookupKernClass(data->kernLeftClasses, data->kernLeftEntryCount, leftCp);
+  const uint8_t lc = lookupKernClass(data->kernLeftDirect, data->kernLeftClasses, data->kernLeftEntryCount, leftCp);
   if (lc == 0) return 0;
-  const uint8_t rc = lookupKernClass(data->kernRightClasses, data->kernRightEntryCount, rightCp);
+  const uint8_t rc =
+      lookupKernClass(data->kernRightDirect, data->kernRightClasses, data->kernRightEntryCount, rightCp);
   if (rc == 0) return 0;
   return data->kernMatrix[(lc - 1) * data->kernRightClassCount + (rc - 1)];
 }
@@ -139,7 +156,10 @@ uint32_t EpdFont::applyLigatures(uint32_t cp, const char*& text) const {
   if (!data->ligaturePairs || data->ligaturePairCount == 0) {
     return cp;
   }
+  const uint8_t* filter = data->ligatureStartFilter;
   while (true) {
+    // Most codepoints start no ligature, which the filter tells without decoding the next one
+    if (filter && !(filter[(cp >> 3) & 0x1F] & (1 << (cp & 7)))) break;
     const auto saved = reinterpret_cast<const uint8_t*>(text);
     const uint32_t nextCp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text));
     if (nextCp == 0) break;
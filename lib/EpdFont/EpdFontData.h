@@ -45,6 +45,15 @@ typedef struct {
   uint32_t ligatureCp;  ///< Codepoint of the replacement ligature glyph
 } __attribute__((packed)) EpdLigaturePair;
 
+/// Codepoint ranges covered by the direct-indexed kerning class maps, concatenated in this order:
+/// Basic Latin through Latin Extended-A, basic Cyrillic, and the General Punctuation dashes and quotes.
+/// fontconvert.py emits the maps with the same layout.
+constexpr uint32_t EPD_KERN_DIRECT_RANGES[][2] = {{0x0000, 0x017F}, {0x0400, 0x045F}, {0x2010, 0x203F}};
+constexpr uint32_t EPD_KERN_DIRECT_SIZE = 0x180 + 0x60 + 0x30;
+
+/// Size of the ligature start filter: one bit per value of the low byte of a pair's left codepoint.
+constexpr uint32_t EPD_LIGATURE_FILTER_BYTES = 32;
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
@@ -57,6 +66,7 @@ typedef struct {
   bool is2Bit;
   const EpdFontGroup* groups;                 ///< NULL for uncompressed fonts
   uint16_t groupCount;                        ///< 0 for uncompressed fonts
+  const uint8_t* glyphGroups;                 ///< Group index of each glyph (nullptr for uncompressed fonts)
   const EpdKernClassEntry* kernLeftClasses;   ///< Sorted left-side class map (nullptr if none)
   const EpdKernClassEntry* kernRightClasses;  ///< Sorted right-side class map (nullptr if none)
   const int8_t* kernMatrix;                   ///< Flat leftClassCount x rightClassCount matrix
@@ -66,4 +76,7 @@ typedef struct {
   uint8_t kernRightClassCount;                ///< Number of distinct right classes (matrix cols)
   const EpdLigaturePair* ligaturePairs;       ///< Sorted ligature pair table (nullptr if none)
   uint32_t ligaturePairCount;                 ///< Number of entries in ligaturePairs
+  const uint8_t* kernLeftDirect;              ///< Left class per EPD_KERN_DIRECT_RANGES codepoint (nullptr if none)
+  const uint8_t* kernRightDirect;             ///< Right class per EPD_KERN_DIRECT_RANGES codepoint (nullptr if none)
+  const uint8_t* ligatureStartFilter;         ///< Bit (cp & 0xFF) set if a pair may start with cp (nullptr if none)
 } EpdFontData;
@@ -1,21 +1,29 @@
 #include "FontDecompressor.h"
 
+#include <Arduino.h>
 #include <Logging.h>
 
 #include <cstdlib>
 
-bool FontDecompressor::init() {
+bool FontDecompressor::init(const uint16_t cacheBudgetKb) {
   clearCache();
+  cacheBudget = static_cast<uint32_t>(cacheBudgetKb) * 1024;
   return true;
 }
 
+void FontDecompressor::freeEntry(CacheEntry& entry) {
+  if (entry.data) {
+    free(entry.data);
+    entry.data = nullptr;
+    cachedBytes -= entry.dataSize;
+  }
+  entry.dataSize = 0;
+  entry.valid = false;
+}
+
 void FontDecompressor::freeAllEntries() {
   for (auto& entry : cache) {
-    if (entry.data) {
-      free(entry.data);
-      entry.data = nullptr;
-    }
-    entry.valid = false;
+    freeEntry(entry);
   }
 }
 
@@ -26,7 +34,24 @@ void FontDecompressor::clearCache() {
   accessCounter = 0;
 }
 
-uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, uint16_t glyphIndex) {
+void FontDecompressor::logStats() {
+  if (hits == 0 && misses == 0) {
+    return;
+  }
+  LOG_DBG("FDC", "Glyph cache: %u hits, %u misses, %u evictions, %u us inflating, %u/%u bytes cached", hits, misses,
+          evictions, inflateMicros, cachedBytes, cacheBudget);
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+  inflateMicros = 0;
+}
+
+uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, const uint16_t glyphIndex) {
+  if (fontData->glyphGroups) {
+    return fontData->glyphGroups[glyphIndex];
+  }
+
+  // Fonts converted before the glyph -> group table existed
   for (uint16_t i = 0; i < fontData->groupCount; i++) {
     uint16_t first = fontData->groups[i].firstGlyphIndex;
     if (glyphIndex >= first && glyphIndex < first + fontData->groups[i].glyphCount) {
@@ -45,33 +70,34 @@ FontDecompressor::CacheEntry* FontDecompressor::findInCache(const EpdFontData* f
   return nullptr;
 }
 
-FontDecompressor::CacheEntry* FontDecompressor::findEvictionCandidate() {
-  // Find an invalid slot first
-  for (auto& entry : cache) {
-    if (!entry.valid) {
-      return &entry;
+// Evicts least recently used groups until `size` more bytes fit in the budget and a slot is free, then returns that
+// slot. A single group larger than the whole budget is still cached on its own.
+FontDecompressor::CacheEntry* FontDecompressor::makeRoom(const uint32_t size) {
+  while (true) {
+    CacheEntry* freeSlot = nullptr;
+    CacheEntry* lru = nullptr;
+    for (auto& entry : cache) {
+      if (!entry.valid) {
+        if (!freeSlot) {
+          freeSlot = &entry;
+        }
+      } else if (!lru || entry.lastUsed < lru->lastUsed) {
+        lru = &entry;
+      }
     }
-  }
-  // Otherwise evict LRU
-  CacheEntry* lru = &cache[0];
-  for (auto& entry : cache) {
-    if (entry.lastUsed < lru->lastUsed) {
-      lru = &entry;
+
+    if (freeSlot && (cachedBytes + size <= cacheBudget || !lru)) {
+      return freeSlot;
     }
+
+    freeEntry(*lru);
+    evictions++;
   }
-  return lru;
 }
 
 bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, CacheEntry* entry) {
   const EpdFontGroup& group = fontData->groups[groupIndex];
 
-  // Free old buffer if reusing a slot
-  if (entry->data) {
-    free(entry->data);
-    entry->data = nullptr;
-  }
-  entry->valid = false;
-
   // Allocate output buffer
   auto* outBuf = static_cast<uint8_t*>(malloc(group.uncompressedSize));
   if (!outBuf) {
@@ -79,6 +105,7 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
     return false;
   }
 
+  const unsigned long start = micros();
   inflateReader.init(false);
   inflateReader.setSource(&fontData->bitmap[group.compressedOffset], group.compressedSize);
   if (!inflateReader.read(outBuf, group.uncompressedSize)) {
@@ -86,12 +113,14 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
     free(outBuf);
     return false;
   }
+  inflateMicros += micros() - start;
 
   entry->font = fontData;
   entry->groupIndex = groupIndex;
   entry->data = outBuf;
   entry->dataSize = group.uncompressedSize;
   entry->valid = true;
+  cachedBytes += group.uncompressedSize;
   return true;
 }
 
@@ -109,19 +138,14 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
   // Check cache
   CacheEntry* entry = findInCache(fontData, groupIndex);
   if (entry) {
-    entry->lastUsed = ++accessCounter;
-    if (glyph->dataOffset + glyph->dataLength > entry->dataSize) {
-      LOG_ERR("FDC", "dataOffset %u + dataLength %u out of bounds for group %u (size %u)", glyph->dataOffset,
-              glyph->dataLength, groupIndex, entry->dataSize);
+    hits++;
+  } else {
+    // Cache miss - decompress
+    misses++;
+    entry = makeRoom(fontData->groups[groupIndex].uncompressedSize);
+    if (!decompressGroup(fontData, groupIndex, entry)) {
       return nullptr;
     }
-    return &entry->data[glyph->dataOffset];
-  }
-
-  // Cache miss - decompress
-  entry = findEvictionCandidate();
-  if (!decompressGroup(fontData, groupIndex, entry)) {
-    return nullptr;
   }
 
   entry->lastUsed = ++accessCounter;
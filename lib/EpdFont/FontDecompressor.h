@@ -6,18 +6,27 @@
 
 class FontDecompressor {
  public:
-  bool init();
+  // Default budget for decompressed groups: fits the ASCII and punctuation groups of all four styles of an 18pt reader
+  // font, so bold/italic-heavy pages don't re-inflate groups.
+  static constexpr uint16_t DEFAULT_CACHE_BUDGET_KB = 48;
+
+  bool init(uint16_t cacheBudgetKb = DEFAULT_CACHE_BUDGET_KB);
   void deinit();
 
   // Returns pointer to decompressed bitmap data for the given glyph.
   // Valid until LRU eviction (safe for the duration of one glyph render).
   const uint8_t* getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint16_t glyphIndex);
 
-  // Evict all cached decompressed groups (call between pages for within-page-only caching).
+  // Evict all cached decompressed groups. The cache is meant to persist across pages; clear it to hand the memory
+  // back before heap-hungry work or when leaving the reader.
   void clearCache();
 
+  // Log hit/miss/inflate-time counters accumulated since the previous call, then reset them.
+  void logStats();
+
  private:
-  static constexpr uint8_t CACHE_SLOTS = 4;
+  // Upper bound on cached groups regardless of budget (a font has at most a handful of commonly used groups per style)
+  static constexpr uint8_t MAX_CACHE_ENTRIES = 16;
 
   struct CacheEntry {
     const EpdFontData* font = nullptr;
@@ -29,12 +38,20 @@ class FontDecompressor {
   };
 
   InflateReader inflateReader;
-  CacheEntry cache[CACHE_SLOTS] = {};
+  CacheEntry cache[MAX_CACHE_ENTRIES] = {};
   uint32_t accessCounter = 0;
+  uint32_t cacheBudget = DEFAULT_CACHE_BUDGET_KB * 1024;
+  uint32_t cachedBytes = 0;
+
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  uint32_t evictions = 0;
+  uint32_t inflateMicros = 0;
 
+  void freeEntry(CacheEntry& entry);
   void freeAllEntries();
-  uint16_t getGroupIndex(const EpdFontData* fontData, uint16_t glyphIndex);
+  static uint16_t getGroupIndex(const EpdFontData* fontData, uint16_t glyphIndex);
   CacheEntry* findInCache(const EpdFontData* fontData, uint16_t groupIndex);
-  CacheEntry* findEvictionCandidate();
+  CacheEntry* makeRoom(uint32_t size);
   bool decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, CacheEntry* entry);
 };
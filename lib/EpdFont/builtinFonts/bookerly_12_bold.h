@@ -3013,6 +3013,68 @@ static const EpdFontGroup bookerly_12_boldGroups[] = {
     { 31423, 105, 150, 1, 937 },
 };
 
+static const uint8_t bookerly_12_boldGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_12_boldKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0027, 1 }, // '
@@ -4492,6 +4554,78 @@ static const int8_t bookerly_12_boldKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    0,    0,   -2,   -1,   -4,    0,   -3,    0,    0,    0,    0,    0,   -1,    0,    0,    0,    0,    0,   -1,   -1,    0,   -1,   -1,   -3,    0,   -3,    0,    0,    0,    0,    0,    0,   -1,    0,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -2,   -1,    0,    0,    0,   -1,    0,    0,    0,    0,    0,   -1,    0,   -3,    0,    0,    0,    0,    0,    0,   -1,    0,    0,    0,   -1,   -2,   -3,    0,   -2,    0,    0,    0,    0,    0,    0,   -4,    0,   -3,   -2,   -1,    0,    0,    0,    0,   -2,   -1,
 };
 
+static const uint8_t bookerly_12_boldKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 5, 4, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0,
+    8, 9, 10, 11, 12, 0, 13, 14, 15, 15, 16, 17, 18, 19, 20, 12,
+    21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 31, 32, 0, 0, 0,
+    0, 33, 34, 35, 36, 37, 38, 39, 40, 36, 41, 42, 43, 40, 40, 34,
+    34, 44, 45, 46, 47, 48, 49, 49, 50, 49, 51, 52, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 56,
+    9, 9, 9, 9, 9, 9, 0, 11, 0, 0, 0, 0, 15, 15, 15, 15,
+    12, 20, 12, 12, 12, 12, 12, 0, 12, 26, 26, 26, 26, 29, 57, 58,
+    33, 33, 33, 33, 33, 33, 37, 35, 37, 37, 37, 37, 36, 36, 59, 59,
+    34, 40, 34, 34, 34, 34, 34, 0, 34, 48, 48, 48, 48, 49, 34, 49,
+    9, 33, 9, 33, 60, 61, 11, 35, 11, 35, 11, 35, 11, 35, 12, 62,
+    12, 36, 0, 37, 0, 37, 0, 37, 0, 63, 0, 37, 14, 39, 14, 39,
+    14, 39, 14, 39, 15, 40, 15, 40, 15, 59, 15, 59, 15, 59, 15, 64,
+    15, 36, 16, 41, 16, 65, 17, 42, 42, 18, 43, 18, 43, 0, 62, 0,
+    0, 18, 66, 20, 40, 20, 40, 20, 40, 40, 20, 40, 12, 34, 12, 34,
+    12, 34, 0, 37, 23, 45, 23, 45, 23, 45, 24, 46, 24, 46, 24, 46,
+    24, 46, 25, 67, 25, 0, 25, 47, 26, 48, 26, 48, 26, 48, 26, 48,
+    26, 48, 26, 68, 27, 49, 29, 49, 29, 30, 51, 30, 51, 30, 51, 0,
+    76, 76, 77, 0, 78, 79, 80, 80, 81, 82, 82, 83, 84, 80, 85, 80,
+    86, 87, 88, 89, 90, 76, 84, 88, 80, 80, 84, 80, 91, 80, 92, 80,
+    93, 94, 89, 85, 95, 96, 90, 80, 80, 90, 82, 80, 82, 92, 92, 80,
+    97, 98, 99, 100, 101, 102, 103, 104, 105, 105, 103, 105, 105, 105, 98, 105,
+    98, 106, 100, 107, 98, 108, 101, 105, 105, 101, 109, 105, 109, 98, 98, 105,
+    102, 102, 110, 100, 0, 111, 112, 113, 0, 109, 109, 114, 103, 105, 107, 105,
+    5, 5, 0, 5, 5, 5, 0, 0, 138, 139, 140, 138, 138, 139, 4, 138,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_12_boldKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 0, 2, 3, 0, 4, 5, 6, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 9,
+    0, 10, 11, 12, 11, 11, 11, 12, 11, 11, 13, 11, 11, 14, 11, 12,
+    11, 12, 11, 15, 16, 17, 18, 18, 19, 20, 21, 0, 22, 23, 0, 0,
+    0, 24, 25, 26, 26, 26, 27, 28, 29, 30, 31, 29, 29, 32, 32, 26,
+    33, 26, 32, 34, 35, 36, 37, 37, 38, 39, 40, 0, 0, 41, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 44,
+    10, 10, 10, 10, 10, 10, 45, 12, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 0, 46, 17, 17, 17, 17, 20, 11, 47,
+    24, 24, 24, 48, 49, 24, 24, 26, 26, 26, 26, 50, 51, 30, 52, 53,
+    26, 32, 26, 26, 26, 26, 26, 0, 26, 36, 36, 36, 36, 39, 54, 39,
+    10, 55, 10, 56, 10, 24, 12, 26, 12, 26, 12, 26, 12, 26, 11, 26,
+    11, 26, 11, 50, 11, 26, 11, 26, 11, 26, 11, 26, 12, 28, 12, 57,
+    12, 28, 12, 28, 11, 29, 11, 58, 11, 53, 11, 53, 11, 53, 11, 30,
+    11, 30, 11, 30, 13, 59, 11, 29, 32, 11, 29, 11, 29, 11, 29, 11,
+    29, 11, 60, 11, 32, 11, 32, 11, 32, 32, 11, 32, 12, 26, 12, 26,
+    12, 26, 12, 26, 11, 32, 11, 32, 11, 61, 15, 34, 15, 62, 15, 34,
+    15, 62, 16, 35, 16, 35, 16, 35, 17, 36, 17, 36, 17, 36, 17, 36,
+    17, 36, 17, 36, 18, 37, 20, 39, 20, 21, 40, 21, 40, 21, 63, 47,
+    70, 70, 71, 70, 72, 73, 70, 70, 74, 75, 70, 71, 70, 70, 76, 70,
+    77, 70, 70, 70, 78, 70, 79, 80, 70, 70, 70, 75, 81, 70, 72, 70,
+    70, 72, 71, 76, 82, 83, 70, 84, 70, 70, 71, 70, 70, 85, 70, 86,
+    87, 88, 89, 89, 90, 91, 92, 93, 89, 89, 89, 94, 89, 89, 91, 89,
+    95, 91, 96, 97, 91, 98, 89, 99, 89, 89, 96, 89, 89, 100, 89, 101,
+    91, 91, 102, 89, 91, 103, 0, 104, 105, 94, 89, 102, 89, 89, 97, 89,
+    5, 5, 0, 5, 5, 5, 0, 0, 115, 116, 6, 115, 115, 116, 6, 115,
+    0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_12_boldLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -4500,6 +4634,11 @@ static const EpdLigaturePair bookerly_12_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_12_boldLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_12_bold = {
     bookerly_12_boldBitmaps,
     bookerly_12_boldGlyphs,
@@ -4511,6 +4650,7 @@ static const EpdFontData bookerly_12_bold = {
     true,
     bookerly_12_boldGroups,
     14,
+    bookerly_12_boldGlyphGroups,
     bookerly_12_boldKernLeftClasses,
     bookerly_12_boldKernRightClasses,
     bookerly_12_boldKernMatrix,
@@ -4520,4 +4660,7 @@ static const EpdFontData bookerly_12_bold = {
     116,
     bookerly_12_boldLigaturePairs,
     5,
+    bookerly_12_boldKernLeftDirect,
+    bookerly_12_boldKernRightDirect,
+    bookerly_12_boldLigatureStartFilter,
 };
@@ -2977,6 +2977,68 @@ static const EpdFontGroup bookerly_12_italicGroups[] = {
     { 30843, 105, 150, 1, 937 },
 };
 
+static const uint8_t bookerly_12_italicGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_12_italicKernLeftClasses[] = {
     { 0x0028, 1 }, // (
     { 0x002A, 2 }, // *
@@ -4454,6 +4516,78 @@ static const int8_t bookerly_12_italicKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    1,    0,   -1,    0,    1,    0,    0,   -2,   -2,   -3,    1,   -2,    0,    0,    0,   -1,    0,    2,    0,    0,    2,   -1,    0,   -1,   -1,   -2,    0,   -2,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,   -1,    0,    0,    0,    0,    0,    0,    2,    0,    0,    0,    0,    0,   -2,   -1,    0,    1,    1,    0,    1,    0,    0,    0,    0,    0,   -1,    1,   -3,    0,    0,   -1,   -1,    0,   -1,    0,    0,   -1,   -1,    0,    0,   -2,    0,   -3,   -2,    0,    0,    0,    0,    0,    2,   -3,   -1,    0,   -2,   -3,   -1,    0,    0,    0,    0,    0,    0,   -3,   -3,
 };
 
+static const uint8_t bookerly_12_italicKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 3, 4, 3, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 7, 8, 9, 10, 11, 12, 13, 13, 14, 15, 16, 17, 18, 9,
+    19, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28, 29, 30, 0, 0, 0,
+    0, 31, 32, 33, 0, 34, 35, 36, 37, 0, 38, 39, 0, 37, 37, 32,
+    32, 40, 41, 42, 43, 31, 44, 44, 45, 44, 46, 47, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 51,
+    6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10, 13, 13, 13, 13,
+    9, 18, 9, 9, 9, 9, 9, 0, 9, 24, 24, 24, 24, 27, 52, 53,
+    31, 31, 31, 31, 31, 31, 34, 54, 34, 34, 34, 34, 0, 0, 55, 55,
+    32, 37, 32, 32, 32, 32, 32, 0, 56, 31, 31, 31, 31, 44, 32, 44,
+    6, 31, 6, 31, 57, 58, 8, 33, 8, 33, 8, 33, 8, 33, 9, 59,
+    9, 0, 10, 34, 10, 34, 10, 34, 60, 61, 10, 34, 12, 36, 12, 36,
+    12, 36, 12, 36, 13, 37, 13, 37, 13, 62, 13, 55, 13, 55, 63, 64,
+    13, 31, 14, 38, 14, 65, 15, 39, 33, 16, 0, 16, 66, 0, 59, 0,
+    0, 16, 67, 18, 37, 18, 37, 18, 37, 37, 18, 68, 9, 32, 9, 32,
+    9, 32, 10, 34, 21, 41, 21, 41, 21, 41, 22, 42, 22, 42, 22, 69,
+    22, 42, 23, 70, 23, 0, 23, 43, 24, 31, 24, 31, 24, 31, 24, 31,
+    24, 31, 24, 71, 25, 44, 27, 44, 27, 28, 46, 28, 46, 28, 46, 0,
+    77, 77, 78, 0, 79, 80, 81, 81, 82, 83, 83, 84, 85, 81, 86, 81,
+    87, 88, 89, 90, 91, 77, 85, 89, 81, 81, 85, 81, 92, 81, 93, 81,
+    94, 95, 90, 86, 96, 97, 91, 81, 81, 91, 83, 81, 83, 93, 93, 81,
+    98, 99, 100, 0, 99, 101, 102, 100, 98, 98, 103, 98, 98, 98, 99, 104,
+    99, 105, 104, 106, 99, 45, 107, 98, 98, 107, 108, 98, 108, 99, 99, 98,
+    101, 101, 109, 0, 105, 110, 0, 111, 112, 108, 108, 104, 103, 98, 106, 98,
+    4, 4, 0, 4, 4, 4, 0, 0, 136, 137, 138, 136, 136, 137, 3, 0,
+    0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_12_italicKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 4, 5, 6, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 9, 0, 0, 0, 10,
+    0, 11, 12, 13, 12, 14, 14, 13, 14, 14, 15, 14, 14, 16, 14, 13,
+    12, 13, 12, 17, 18, 19, 20, 20, 21, 22, 23, 0, 24, 25, 0, 0,
+    0, 26, 27, 26, 26, 26, 28, 29, 27, 30, 31, 27, 27, 32, 32, 26,
+    32, 26, 32, 33, 34, 35, 36, 36, 37, 38, 39, 0, 0, 40, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 43,
+    11, 11, 11, 11, 11, 11, 44, 13, 14, 14, 14, 14, 14, 14, 14, 14,
+    12, 14, 13, 13, 13, 13, 13, 0, 13, 19, 19, 19, 19, 22, 14, 45,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 30, 30, 46, 46,
+    26, 32, 26, 26, 26, 26, 26, 0, 47, 35, 35, 35, 35, 36, 48, 36,
+    11, 26, 11, 26, 11, 26, 13, 26, 13, 26, 13, 26, 13, 49, 12, 26,
+    12, 26, 14, 26, 14, 26, 14, 26, 14, 26, 14, 26, 13, 29, 13, 29,
+    13, 29, 13, 29, 14, 27, 14, 50, 14, 51, 14, 46, 14, 46, 14, 30,
+    14, 32, 14, 30, 15, 0, 14, 27, 32, 14, 27, 14, 27, 14, 27, 14,
+    27, 14, 52, 14, 32, 14, 32, 14, 32, 32, 14, 32, 13, 26, 13, 26,
+    13, 26, 13, 26, 12, 32, 12, 32, 12, 32, 17, 33, 17, 33, 17, 33,
+    17, 53, 18, 34, 18, 34, 18, 34, 19, 35, 19, 35, 19, 35, 19, 35,
+    19, 35, 19, 35, 20, 36, 22, 36, 22, 23, 39, 23, 39, 23, 54, 45,
+    61, 61, 62, 61, 63, 64, 61, 61, 65, 66, 61, 62, 61, 61, 67, 61,
+    68, 61, 69, 61, 70, 61, 71, 72, 61, 61, 61, 66, 73, 61, 63, 61,
+    69, 63, 62, 67, 74, 75, 61, 76, 61, 61, 62, 61, 61, 77, 61, 78,
+    79, 80, 79, 81, 82, 79, 83, 84, 85, 85, 86, 87, 88, 86, 79, 86,
+    86, 79, 86, 89, 79, 90, 85, 91, 85, 85, 92, 85, 85, 84, 86, 93,
+    79, 79, 94, 81, 79, 95, 96, 97, 98, 87, 86, 94, 86, 85, 89, 85,
+    5, 5, 0, 5, 5, 5, 0, 0, 111, 112, 6, 111, 111, 112, 6, 0,
+    0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 1, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_12_italicLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -4462,6 +4596,11 @@ static const EpdLigaturePair bookerly_12_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_12_italicLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_12_italic = {
     bookerly_12_italicBitmaps,
     bookerly_12_italicGlyphs,
@@ -4473,6 +4612,7 @@ static const EpdFontData bookerly_12_italic = {
     true,
     bookerly_12_italicGroups,
     14,
+    bookerly_12_italicGlyphGroups,
     bookerly_12_italicKernLeftClasses,
     bookerly_12_italicKernRightClasses,
     bookerly_12_italicKernMatrix,
@@ -4482,4 +4622,7 @@ static const EpdFontData bookerly_12_italic = {
     112,
     bookerly_12_italicLigaturePairs,
     5,
+    bookerly_12_italicKernLeftDirect,
+    bookerly_12_italicKernRightDirect,
+    bookerly_12_italicLigatureStartFilter,
 };
@@ -2857,6 +2857,68 @@ static const EpdFontGroup bookerly_12_regularGroups[] = {
     { 28933, 105, 150, 1, 937 },
 };
 
+static const uint8_t bookerly_12_regularGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_12_regularKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0027, 1 }, // '
@@ -4339,6 +4401,78 @@ static const int8_t bookerly_12_regularKernMatrix[] = {
        0,    0,    0,    0,   -2,    0,    0,    0,    0,   -3,    0,   -1,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,   -2,    0,   -3,    0,    0,    0,    0,    0,   -2,    0,    0,    0,    0,    0,   -1,    0,    0,    0,    0,   -5,    0,   -1,   -1,   -2,    0,    0,    0,    0,   -1,   -1,    0,    1,    0,    0,   -2,    0,   -3,    0,    0,    0,    0,    0,    0,   -1,   -1,    0,   -2,    0,   -3,   -2,   -1,    0,    0,    0,    0,    0,    0,   -1,   -1,    0,    0,   -2,   -2,    0,    0,   -2,    0,    0,    0,    0,    0,   -2,    0,   -2,    0,    0,    0,    0,    0,    0,   -2,   -5,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t bookerly_12_regularKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 5, 4, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0,
+    8, 9, 10, 11, 12, 0, 13, 14, 15, 15, 16, 17, 18, 19, 20, 12,
+    21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 31, 32, 0, 0, 0,
+    0, 33, 34, 35, 36, 37, 38, 39, 40, 36, 41, 42, 43, 40, 40, 34,
+    34, 44, 45, 46, 47, 48, 49, 49, 50, 49, 51, 52, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 56,
+    9, 9, 9, 9, 9, 9, 0, 11, 0, 0, 0, 0, 15, 15, 15, 15,
+    12, 20, 12, 12, 12, 12, 12, 0, 12, 26, 26, 26, 26, 29, 57, 58,
+    33, 33, 33, 33, 33, 33, 37, 35, 37, 37, 37, 37, 36, 36, 59, 59,
+    60, 40, 34, 34, 34, 34, 34, 0, 61, 48, 48, 48, 48, 49, 34, 49,
+    9, 33, 9, 33, 62, 63, 11, 35, 11, 35, 11, 35, 11, 35, 12, 64,
+    12, 36, 0, 37, 0, 37, 0, 37, 0, 37, 0, 37, 14, 39, 14, 39,
+    14, 39, 14, 39, 15, 40, 15, 40, 15, 59, 15, 59, 15, 59, 15, 65,
+    15, 36, 16, 41, 16, 66, 17, 42, 42, 18, 43, 18, 43, 0, 64, 0,
+    0, 18, 67, 20, 40, 20, 40, 20, 40, 40, 20, 40, 12, 34, 12, 34,
+    12, 34, 0, 37, 23, 45, 23, 45, 23, 45, 24, 46, 24, 46, 24, 46,
+    24, 46, 25, 47, 25, 0, 25, 47, 26, 48, 26, 48, 26, 48, 26, 48,
+    26, 48, 26, 68, 27, 49, 29, 49, 29, 30, 51, 30, 51, 30, 51, 0,
+    76, 76, 77, 0, 78, 79, 80, 80, 81, 82, 82, 83, 84, 80, 85, 80,
+    86, 87, 88, 89, 90, 76, 84, 88, 80, 80, 84, 80, 91, 80, 92, 80,
+    93, 94, 89, 85, 95, 96, 90, 80, 80, 90, 82, 80, 82, 92, 92, 80,
+    97, 98, 99, 100, 101, 102, 103, 104, 105, 105, 103, 105, 105, 105, 98, 105,
+    98, 106, 100, 107, 98, 108, 101, 105, 105, 101, 109, 105, 109, 98, 98, 105,
+    102, 102, 110, 100, 0, 111, 112, 113, 114, 109, 109, 115, 103, 105, 107, 105,
+    5, 5, 0, 5, 5, 5, 0, 0, 139, 140, 4, 139, 139, 140, 4, 139,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_12_regularKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4, 0, 5, 6, 5, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 9,
+    0, 10, 11, 12, 11, 11, 11, 12, 11, 11, 13, 11, 11, 14, 11, 12,
+    11, 12, 11, 15, 16, 17, 18, 18, 19, 20, 21, 0, 22, 23, 0, 0,
+    0, 24, 25, 26, 26, 26, 27, 28, 29, 30, 31, 29, 29, 32, 32, 26,
+    33, 26, 32, 34, 35, 36, 37, 37, 38, 39, 40, 0, 0, 41, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 44,
+    10, 10, 10, 10, 10, 10, 45, 12, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 0, 12, 17, 17, 17, 17, 20, 11, 46,
+    24, 24, 24, 47, 48, 24, 24, 26, 26, 26, 26, 49, 50, 30, 51, 52,
+    26, 32, 26, 26, 26, 26, 26, 0, 26, 36, 36, 36, 36, 39, 53, 39,
+    10, 54, 10, 55, 10, 24, 12, 26, 12, 26, 12, 26, 12, 26, 11, 26,
+    11, 26, 11, 26, 11, 26, 11, 26, 11, 26, 11, 26, 12, 28, 12, 28,
+    12, 28, 12, 28, 11, 29, 11, 56, 11, 52, 11, 52, 11, 52, 11, 30,
+    11, 30, 11, 30, 13, 57, 11, 29, 32, 11, 29, 11, 29, 11, 29, 11,
+    29, 11, 58, 11, 32, 11, 32, 11, 32, 32, 11, 32, 12, 26, 12, 26,
+    12, 26, 12, 26, 11, 32, 11, 32, 11, 59, 15, 34, 15, 34, 15, 34,
+    15, 60, 16, 35, 16, 35, 16, 35, 17, 36, 17, 36, 17, 36, 17, 36,
+    17, 36, 17, 36, 18, 37, 20, 39, 20, 21, 40, 21, 40, 21, 40, 46,
+    67, 67, 68, 67, 69, 70, 67, 67, 71, 72, 67, 68, 67, 67, 73, 67,
+    74, 67, 67, 67, 75, 67, 76, 77, 67, 67, 67, 72, 78, 67, 69, 67,
+    67, 69, 68, 73, 79, 80, 67, 81, 67, 67, 68, 67, 67, 82, 67, 83,
+    84, 85, 86, 86, 87, 88, 89, 90, 86, 86, 86, 91, 86, 86, 88, 86,
+    92, 88, 93, 94, 88, 95, 86, 96, 86, 86, 93, 86, 86, 90, 86, 97,
+    88, 88, 98, 86, 88, 99, 0, 100, 101, 91, 86, 98, 86, 86, 102, 86,
+    6, 6, 0, 6, 6, 6, 0, 0, 112, 113, 5, 112, 112, 113, 5, 112,
+    0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 1, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_12_regularLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -4347,6 +4481,11 @@ static const EpdLigaturePair bookerly_12_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_12_regularLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_12_regular = {
     bookerly_12_regularBitmaps,
     bookerly_12_regularGlyphs,
@@ -4358,6 +4497,7 @@ static const EpdFontData bookerly_12_regular = {
     true,
     bookerly_12_regularGroups,
     14,
+    bookerly_12_regularGlyphGroups,
     bookerly_12_regularKernLeftClasses,
     bookerly_12_regularKernRightClasses,
     bookerly_12_regularKernMatrix,
@@ -4367,4 +4507,7 @@ static const EpdFontData bookerly_12_regular = {
     113,
     bookerly_12_regularLigaturePairs,
     5,
+    bookerly_12_regularKernLeftDirect,
+    bookerly_12_regularKernRightDirect,
+    bookerly_12_regularLigatureStartFilter,
 };
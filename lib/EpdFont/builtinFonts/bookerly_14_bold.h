@@ -3446,6 +3446,68 @@ static const EpdFontGroup bookerly_14_boldGroups[] = {
     { 38317, 133, 196, 1, 937 },
 };
 
+static const uint8_t bookerly_14_boldGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_14_boldKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0027, 1 }, // '
@@ -4926,6 +4988,78 @@ static const int8_t bookerly_14_boldKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -2,    0,    0,    0,   -3,   -2,   -4,    0,   -3,    0,    0,    0,    0,    0,   -1,    0,    0,    0,    0,    0,   -1,   -1,    0,   -1,   -2,   -3,    0,   -4,    0,    0,    0,    0,    0,    0,   -2,    0,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,   -1,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -3,   -2,    0,    0,    0,   -2,    0,    0,    0,    0,    0,   -1,    0,   -3,    0,    0,    0,    0,    0,    0,   -1,    0,    0,    0,   -1,   -2,   -3,    0,   -3,    0,    0,    0,    0,    0,    0,   -3,   -4,    0,   -3,   -3,   -2,    0,    0,    0,    0,   -3,   -2,
 };
 
+static const uint8_t bookerly_14_boldKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 5, 4, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0,
+    8, 9, 10, 11, 12, 0, 13, 14, 15, 15, 16, 17, 18, 19, 20, 12,
+    21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 31, 32, 0, 0, 0,
+    0, 33, 34, 35, 36, 37, 38, 39, 40, 36, 41, 42, 43, 40, 40, 34,
+    34, 44, 45, 46, 47, 48, 49, 49, 50, 49, 51, 52, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 56,
+    9, 9, 9, 9, 9, 9, 0, 11, 0, 0, 0, 0, 15, 15, 15, 15,
+    12, 20, 12, 12, 12, 12, 12, 0, 57, 26, 26, 26, 26, 29, 58, 59,
+    33, 33, 33, 33, 33, 33, 37, 35, 37, 37, 37, 37, 36, 36, 60, 60,
+    34, 40, 34, 34, 34, 34, 34, 0, 34, 48, 48, 48, 48, 49, 34, 49,
+    9, 33, 9, 33, 61, 62, 11, 35, 11, 35, 11, 35, 11, 35, 12, 63,
+    12, 36, 0, 37, 0, 37, 0, 37, 0, 64, 0, 37, 14, 39, 14, 39,
+    14, 39, 14, 39, 15, 40, 15, 40, 15, 60, 15, 60, 15, 60, 15, 65,
+    15, 36, 16, 41, 16, 66, 17, 42, 42, 18, 43, 18, 43, 0, 63, 0,
+    0, 18, 67, 20, 40, 20, 40, 20, 40, 40, 20, 40, 12, 34, 12, 34,
+    12, 34, 0, 37, 23, 45, 23, 45, 23, 45, 24, 46, 24, 46, 24, 46,
+    24, 46, 25, 68, 25, 0, 25, 47, 26, 48, 26, 48, 26, 48, 26, 48,
+    26, 48, 26, 69, 27, 49, 29, 49, 29, 30, 51, 30, 51, 30, 51, 0,
+    77, 77, 78, 0, 79, 80, 81, 81, 82, 83, 83, 84, 85, 81, 86, 81,
+    87, 88, 89, 90, 91, 77, 85, 89, 81, 81, 85, 81, 92, 81, 93, 81,
+    94, 95, 90, 86, 96, 97, 91, 81, 81, 91, 83, 81, 83, 93, 93, 81,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 106, 104, 106, 106, 106, 99, 106,
+    99, 107, 101, 108, 99, 109, 102, 106, 106, 102, 110, 106, 110, 99, 99, 106,
+    103, 103, 111, 101, 0, 112, 113, 114, 0, 110, 110, 115, 104, 106, 108, 106,
+    5, 5, 0, 5, 5, 5, 0, 0, 139, 140, 141, 139, 139, 140, 4, 139,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_14_boldKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 0, 2, 3, 0, 4, 5, 6, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 9,
+    0, 10, 11, 12, 11, 11, 11, 12, 11, 11, 13, 11, 11, 14, 11, 12,
+    11, 12, 11, 15, 16, 17, 18, 18, 19, 20, 21, 0, 22, 23, 0, 0,
+    0, 24, 25, 26, 26, 26, 27, 28, 29, 30, 31, 29, 29, 32, 32, 26,
+    33, 26, 32, 34, 35, 36, 37, 37, 38, 39, 40, 0, 0, 41, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 44,
+    10, 10, 10, 10, 10, 10, 45, 12, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 0, 46, 17, 17, 17, 17, 20, 11, 47,
+    24, 24, 24, 48, 49, 24, 24, 26, 26, 26, 26, 50, 51, 30, 52, 53,
+    26, 32, 26, 26, 26, 26, 26, 0, 26, 36, 36, 36, 36, 39, 54, 39,
+    10, 55, 10, 55, 10, 24, 12, 26, 12, 26, 12, 26, 12, 26, 11, 26,
+    11, 26, 11, 50, 11, 26, 11, 26, 11, 26, 11, 26, 12, 28, 12, 56,
+    12, 28, 12, 28, 11, 29, 11, 57, 11, 53, 11, 53, 11, 53, 11, 30,
+    11, 30, 11, 30, 13, 58, 11, 29, 32, 11, 29, 11, 29, 11, 29, 11,
+    29, 11, 59, 11, 32, 11, 32, 11, 32, 32, 11, 32, 12, 26, 12, 26,
+    12, 26, 12, 26, 11, 32, 11, 32, 11, 60, 15, 34, 15, 61, 15, 34,
+    15, 61, 16, 35, 16, 35, 16, 35, 17, 36, 17, 36, 17, 36, 17, 36,
+    17, 36, 17, 36, 18, 37, 20, 39, 20, 21, 40, 21, 40, 21, 62, 47,
+    69, 69, 70, 69, 71, 72, 69, 69, 73, 74, 69, 70, 69, 69, 75, 69,
+    76, 69, 69, 69, 77, 69, 78, 79, 69, 69, 69, 74, 80, 69, 71, 69,
+    69, 71, 70, 75, 81, 82, 69, 83, 69, 69, 70, 69, 69, 84, 69, 85,
+    86, 87, 88, 88, 89, 90, 91, 92, 88, 88, 88, 93, 88, 88, 90, 88,
+    94, 90, 95, 96, 90, 97, 88, 98, 88, 88, 95, 88, 88, 99, 88, 100,
+    90, 90, 101, 88, 90, 102, 0, 103, 104, 93, 88, 101, 88, 88, 105, 88,
+    5, 5, 0, 5, 5, 5, 0, 0, 115, 116, 6, 115, 115, 116, 6, 115,
+    0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_14_boldLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -4934,6 +5068,11 @@ static const EpdLigaturePair bookerly_14_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_14_boldLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_14_bold = {
     bookerly_14_boldBitmaps,
     bookerly_14_boldGlyphs,
@@ -4945,6 +5084,7 @@ static const EpdFontData bookerly_14_bold = {
     true,
     bookerly_14_boldGroups,
     14,
+    bookerly_14_boldGlyphGroups,
     bookerly_14_boldKernLeftClasses,
     bookerly_14_boldKernRightClasses,
     bookerly_14_boldKernMatrix,
@@ -4954,4 +5094,7 @@ static const EpdFontData bookerly_14_bold = {
     116,
     bookerly_14_boldLigaturePairs,
     5,
+    bookerly_14_boldKernLeftDirect,
+    bookerly_14_boldKernRightDirect,
+    bookerly_14_boldLigatureStartFilter,
 };
@@ -3717,6 +3717,68 @@ static const EpdFontGroup bookerly_14_bolditalicGroups[] = {
     { 42657, 133, 196, 1, 937 },
 };
 
+static const uint8_t bookerly_14_bolditalicGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_14_bolditalicKernLeftClasses[] = {
     { 0x0028, 1 }, // (
     { 0x002A, 2 }, // *
@@ -5218,6 +5280,78 @@ static const int8_t bookerly_14_bolditalicKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    3,    0,    0,   -2,   -2,   -3,    1,   -2,    0,    0,    0,    0,    0,    2,    0,    0,   -1,    3,    0,    0,   -1,   -1,   -2,    0,   -1,    0,    0,    0,   -2,    0,    0,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    2,    0,    0,    0,    0,    0,   -2,   -1,    0,    3,    1,    0,    0,    0,    0,    1,    0,    1,    0,   -1,    1,   -3,    0,    1,    0,   -1,    0,    0,    0,    0,   -1,    0,    0,    0,   -2,    0,   -2,   -3,    0,    0,    0,   -1,    0,    3,    0,   -3,   -2,    0,   -1,    0,   -2,   -4,   -1,    0,    0,    0,    0,    0,    0,   -3,   -3,
 };
 
+static const uint8_t bookerly_14_bolditalicKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 3, 4, 3, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 7, 8, 9, 10, 11, 12, 13, 13, 14, 15, 16, 17, 18, 9,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 0, 0, 0,
+    0, 32, 33, 34, 0, 35, 36, 37, 38, 39, 40, 41, 0, 38, 38, 33,
+    33, 42, 43, 44, 45, 32, 46, 46, 47, 46, 48, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 52,
+    6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10, 13, 13, 13, 13,
+    9, 18, 9, 9, 9, 9, 9, 0, 9, 24, 24, 24, 24, 28, 53, 54,
+    32, 32, 32, 32, 32, 32, 35, 55, 35, 35, 35, 35, 39, 56, 57, 57,
+    33, 38, 33, 33, 33, 33, 33, 0, 58, 32, 32, 32, 32, 46, 33, 46,
+    6, 32, 6, 32, 59, 60, 8, 34, 8, 34, 8, 34, 8, 34, 9, 61,
+    9, 0, 10, 35, 10, 35, 10, 35, 62, 63, 10, 35, 12, 37, 12, 37,
+    12, 37, 12, 37, 13, 38, 64, 38, 13, 57, 13, 57, 13, 57, 65, 66,
+    13, 32, 14, 40, 14, 67, 15, 41, 68, 16, 0, 16, 69, 0, 61, 0,
+    0, 16, 70, 18, 38, 18, 38, 18, 38, 38, 18, 40, 9, 33, 9, 33,
+    9, 33, 10, 35, 21, 43, 21, 43, 21, 43, 22, 44, 22, 44, 22, 71,
+    22, 44, 23, 72, 23, 0, 23, 45, 24, 32, 24, 32, 24, 32, 24, 32,
+    24, 32, 24, 60, 25, 46, 28, 46, 28, 29, 48, 29, 48, 29, 48, 0,
+    82, 82, 83, 0, 84, 85, 86, 86, 87, 88, 88, 89, 90, 86, 91, 86,
+    92, 93, 94, 95, 96, 82, 90, 94, 86, 86, 90, 86, 97, 86, 98, 86,
+    99, 100, 101, 91, 102, 103, 96, 86, 86, 96, 88, 86, 88, 98, 98, 86,
+    104, 105, 106, 68, 107, 108, 109, 106, 104, 104, 110, 104, 104, 104, 111, 112,
+    111, 113, 112, 114, 107, 115, 116, 104, 104, 116, 117, 104, 118, 111, 111, 104,
+    108, 108, 119, 68, 113, 120, 39, 121, 122, 118, 118, 112, 110, 104, 114, 104,
+    4, 4, 0, 4, 4, 4, 0, 0, 146, 147, 148, 146, 146, 147, 3, 0,
+    0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_14_bolditalicKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4, 0, 5, 6, 7, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10, 0, 0, 0, 11,
+    0, 12, 13, 14, 13, 15, 15, 14, 15, 15, 16, 15, 15, 17, 15, 14,
+    13, 14, 13, 18, 19, 20, 21, 21, 22, 23, 24, 0, 25, 26, 0, 0,
+    0, 27, 28, 27, 27, 27, 29, 30, 31, 32, 33, 31, 31, 34, 34, 27,
+    34, 27, 34, 35, 36, 37, 38, 38, 39, 40, 41, 0, 0, 42, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 46,
+    12, 12, 12, 12, 12, 12, 47, 14, 15, 15, 15, 15, 15, 15, 15, 15,
+    13, 15, 14, 14, 14, 14, 14, 0, 14, 20, 20, 20, 20, 23, 15, 48,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 49, 32, 50, 50,
+    27, 34, 27, 27, 27, 27, 27, 0, 51, 37, 37, 37, 37, 38, 31, 38,
+    12, 27, 12, 27, 12, 27, 14, 27, 14, 27, 14, 27, 14, 52, 13, 27,
+    13, 27, 15, 27, 15, 27, 15, 27, 15, 27, 15, 27, 14, 30, 14, 30,
+    14, 30, 14, 30, 15, 31, 15, 53, 15, 50, 15, 50, 15, 50, 15, 32,
+    15, 34, 15, 32, 16, 0, 15, 31, 34, 15, 31, 15, 31, 15, 31, 15,
+    31, 15, 54, 15, 34, 15, 34, 15, 34, 34, 15, 34, 14, 27, 14, 27,
+    14, 27, 14, 27, 13, 34, 13, 34, 13, 34, 18, 35, 18, 35, 18, 35,
+    18, 55, 19, 36, 19, 36, 19, 36, 20, 37, 20, 37, 20, 37, 20, 37,
+    20, 37, 20, 37, 21, 38, 23, 38, 23, 24, 41, 24, 41, 24, 56, 48,
+    63, 63, 64, 63, 65, 66, 63, 63, 67, 68, 63, 64, 63, 63, 69, 63,
+    70, 63, 71, 63, 72, 63, 73, 74, 63, 63, 63, 75, 76, 63, 65, 63,
+    71, 65, 64, 69, 77, 78, 63, 79, 63, 63, 64, 63, 63, 80, 63, 81,
+    82, 83, 82, 84, 85, 82, 86, 87, 88, 88, 89, 90, 91, 89, 82, 89,
+    89, 82, 89, 92, 82, 93, 88, 94, 88, 88, 95, 88, 88, 87, 89, 96,
+    82, 82, 97, 84, 82, 98, 99, 100, 101, 90, 89, 102, 89, 88, 92, 88,
+    6, 6, 0, 6, 6, 6, 0, 0, 117, 118, 7, 117, 117, 118, 7, 0,
+    0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 1, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_14_bolditalicLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -5226,6 +5360,11 @@ static const EpdLigaturePair bookerly_14_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_14_bolditalicLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_14_bolditalic = {
     bookerly_14_bolditalicBitmaps,
     bookerly_14_bolditalicGlyphs,
@@ -5237,6 +5376,7 @@ static const EpdFontData bookerly_14_bolditalic = {
     true,
     bookerly_14_bolditalicGroups,
     14,
+    bookerly_14_bolditalicGlyphGroups,
     bookerly_14_bolditalicKernLeftClasses,
     bookerly_14_bolditalicKernRightClasses,
     bookerly_14_bolditalicKernMatrix,
@@ -5246,4 +5386,7 @@ static const EpdFontData bookerly_14_bolditalic = {
     118,
     bookerly_14_bolditalicLigaturePairs,
     5,
+    bookerly_14_bolditalicKernLeftDirect,
+    bookerly_14_bolditalicKernRightDirect,
+    bookerly_14_bolditalicLigatureStartFilter,
 };
@@ -3275,6 +3275,68 @@ static const EpdFontGroup bookerly_14_regularGroups[] = {
     { 35585, 133, 196, 1, 937 },
 };
 
+static const uint8_t bookerly_14_regularGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_14_regularKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0027, 1 }, // '
@@ -4759,6 +4821,78 @@ static const int8_t bookerly_14_regularKernMatrix[] = {
        0,    0,    0,    0,   -3,    0,   -3,    0,    0,    0,   -3,    0,   -2,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,   -2,    0,   -2,    0,   -3,    0,    0,    0,    0,    0,   -3,    0,    0,    0,    0,    0,   -1,    0,    0,    0,    0,   -5,    0,   -2,   -2,   -2,    0,    0,    0,    0,   -2,   -2,    0,    1,    0,    0,   -3,   -1,    0,   -3,    0,    0,    0,    0,    0,    0,   -2,   -1,    0,   -3,    0,   -3,   -3,   -1,    0,    0,    0,    0,    0,    0,   -2,   -2,    0,    0,   -3,   -2,    0,    0,   -3,    0,    0,    0,    0,    0,   -3,    0,   -3,    0,    0,    0,    0,    0,    0,   -2,   -5,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t bookerly_14_regularKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 5, 4, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0,
+    8, 9, 10, 11, 12, 0, 13, 14, 15, 15, 16, 17, 18, 19, 20, 12,
+    21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 31, 32, 0, 0, 0,
+    0, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 40, 40, 34,
+    34, 45, 46, 47, 48, 49, 50, 50, 51, 50, 52, 53, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 57,
+    9, 9, 9, 9, 9, 9, 0, 11, 0, 0, 0, 0, 15, 15, 15, 15,
+    12, 20, 12, 12, 12, 12, 12, 0, 58, 26, 26, 26, 26, 29, 59, 60,
+    33, 33, 33, 33, 33, 33, 37, 35, 37, 37, 37, 37, 41, 41, 61, 61,
+    62, 40, 34, 34, 34, 34, 34, 0, 63, 49, 49, 49, 49, 50, 34, 50,
+    9, 33, 9, 33, 64, 65, 11, 35, 11, 35, 11, 35, 11, 35, 12, 66,
+    12, 36, 0, 37, 0, 37, 0, 37, 0, 37, 0, 37, 14, 39, 14, 39,
+    14, 39, 14, 39, 15, 40, 15, 40, 15, 61, 15, 61, 15, 61, 15, 67,
+    15, 41, 16, 42, 16, 68, 17, 43, 43, 18, 44, 18, 44, 0, 66, 0,
+    0, 18, 69, 20, 40, 20, 40, 20, 40, 40, 20, 40, 12, 34, 12, 34,
+    12, 34, 0, 37, 23, 46, 23, 46, 23, 46, 24, 47, 24, 47, 24, 47,
+    24, 47, 25, 48, 25, 0, 25, 48, 26, 49, 26, 49, 26, 49, 26, 49,
+    26, 49, 26, 70, 27, 50, 29, 50, 29, 30, 52, 30, 52, 30, 52, 0,
+    78, 78, 79, 0, 80, 81, 82, 82, 83, 84, 84, 85, 86, 82, 87, 82,
+    88, 89, 90, 91, 92, 78, 86, 90, 82, 82, 86, 82, 93, 82, 94, 82,
+    95, 96, 91, 87, 97, 98, 92, 82, 82, 92, 84, 82, 84, 94, 94, 82,
+    99, 100, 101, 102, 103, 104, 105, 106, 107, 107, 105, 107, 107, 107, 100, 107,
+    100, 108, 102, 109, 100, 110, 103, 107, 107, 103, 111, 107, 111, 100, 100, 107,
+    104, 104, 112, 102, 0, 113, 114, 115, 116, 111, 111, 117, 105, 107, 109, 107,
+    5, 5, 0, 5, 5, 5, 0, 0, 141, 142, 4, 141, 141, 142, 4, 141,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 56, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_14_regularKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4, 0, 5, 6, 7, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 10,
+    0, 11, 12, 13, 12, 12, 12, 13, 12, 12, 14, 12, 12, 15, 12, 13,
+    12, 13, 12, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23, 24, 0, 0,
+    0, 25, 26, 27, 27, 27, 28, 29, 30, 31, 32, 30, 30, 33, 33, 27,
+    34, 27, 33, 35, 36, 37, 38, 38, 39, 40, 41, 0, 0, 42, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 45,
+    11, 11, 11, 11, 11, 11, 46, 13, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 13, 13, 13, 13, 13, 0, 13, 18, 18, 18, 18, 21, 12, 47,
+    25, 25, 25, 48, 49, 25, 25, 27, 27, 27, 27, 50, 51, 31, 52, 53,
+    27, 33, 27, 27, 27, 27, 27, 0, 27, 37, 37, 37, 37, 40, 54, 40,
+    11, 55, 11, 56, 11, 25, 13, 27, 13, 27, 13, 27, 13, 27, 12, 27,
+    12, 27, 12, 27, 12, 27, 12, 27, 12, 27, 12, 27, 13, 29, 13, 29,
+    13, 29, 13, 29, 12, 30, 12, 57, 12, 53, 12, 53, 12, 53, 12, 31,
+    12, 31, 12, 31, 14, 58, 12, 30, 33, 12, 30, 12, 30, 12, 30, 12,
+    30, 12, 59, 12, 33, 12, 33, 12, 33, 33, 12, 33, 13, 27, 13, 27,
+    13, 27, 13, 27, 12, 33, 12, 33, 12, 60, 16, 35, 16, 35, 16, 35,
+    16, 61, 17, 36, 17, 36, 17, 36, 18, 37, 18, 37, 18, 37, 18, 37,
+    18, 37, 18, 37, 19, 38, 21, 40, 21, 22, 41, 22, 41, 22, 62, 47,
+    69, 69, 70, 69, 71, 72, 69, 69, 73, 74, 69, 70, 69, 69, 75, 69,
+    76, 69, 69, 69, 77, 69, 78, 79, 69, 69, 69, 74, 80, 69, 71, 69,
+    69, 71, 70, 75, 81, 82, 69, 83, 69, 69, 70, 69, 69, 84, 69, 85,
+    86, 87, 88, 88, 89, 90, 91, 92, 88, 88, 88, 93, 88, 88, 90, 88,
+    94, 90, 95, 96, 90, 97, 88, 98, 88, 88, 95, 88, 88, 92, 88, 99,
+    90, 90, 100, 88, 90, 101, 0, 102, 103, 93, 88, 100, 88, 88, 104, 88,
+    6, 6, 0, 6, 6, 6, 0, 0, 114, 115, 7, 114, 114, 115, 7, 114,
+    0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 0, 1, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_14_regularLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -4767,6 +4901,11 @@ static const EpdLigaturePair bookerly_14_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_14_regularLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_14_regular = {
     bookerly_14_regularBitmaps,
     bookerly_14_regularGlyphs,
@@ -4778,6 +4917,7 @@ static const EpdFontData bookerly_14_regular = {
     true,
     bookerly_14_regularGroups,
     14,
+    bookerly_14_regularGlyphGroups,
     bookerly_14_regularKernLeftClasses,
     bookerly_14_regularKernRightClasses,
     bookerly_14_regularKernMatrix,
@@ -4787,4 +4927,7 @@ static const EpdFontData bookerly_14_regular = {
     115,
     bookerly_14_regularLigaturePairs,
     5,
+    bookerly_14_regularKernLeftDirect,
+    bookerly_14_regularKernRightDirect,
+    bookerly_14_regularLigatureStartFilter,
 };
@@ -3922,6 +3922,68 @@ static const EpdFontGroup bookerly_16_boldGroups[] = {
     { 45918, 148, 256, 1, 937 },
 };
 
+static const uint8_t bookerly_16_boldGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_16_boldKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0027, 1 }, // '
@@ -5402,6 +5464,78 @@ static const int8_t bookerly_16_boldKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    1,    0,   -2,    1,    0,    0,   -3,   -2,   -5,    0,   -3,    0,    0,    0,    0,    0,   -1,    0,    0,    0,    0,    0,   -1,   -1,    0,   -1,   -2,   -3,    0,   -4,    0,    0,    0,    0,    0,    0,   -2,    0,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -3,   -2,    0,    1,    0,   -2,    1,    0,    0,    0,    0,   -1,    0,   -4,    0,    0,    0,    0,    0,    0,   -1,    0,    0,    0,   -1,   -2,   -4,    0,   -3,    0,    0,    0,    0,    0,    0,   -4,   -5,    0,   -3,   -3,   -2,    0,    0,    0,    0,   -4,   -3,   -2,
 };
 
+static const uint8_t bookerly_16_boldKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 5, 4, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0,
+    8, 9, 10, 11, 12, 0, 13, 14, 15, 15, 16, 17, 18, 19, 20, 12,
+    21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 31, 32, 0, 0, 0,
+    0, 33, 34, 35, 36, 37, 38, 39, 40, 36, 41, 42, 43, 40, 40, 34,
+    34, 44, 45, 46, 47, 48, 49, 49, 50, 49, 51, 52, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 56,
+    9, 9, 9, 9, 9, 9, 0, 11, 0, 0, 0, 0, 15, 15, 15, 15,
+    12, 20, 12, 12, 12, 12, 12, 0, 57, 26, 26, 26, 26, 29, 58, 59,
+    33, 33, 33, 33, 33, 33, 37, 35, 37, 37, 37, 37, 36, 36, 60, 60,
+    34, 40, 34, 34, 34, 34, 34, 0, 34, 48, 48, 48, 48, 49, 34, 49,
+    9, 33, 9, 33, 61, 62, 11, 35, 11, 35, 11, 35, 11, 35, 12, 63,
+    12, 36, 0, 37, 0, 37, 0, 37, 0, 64, 0, 37, 14, 39, 14, 39,
+    14, 39, 14, 39, 15, 40, 15, 40, 15, 60, 15, 60, 15, 60, 15, 65,
+    15, 36, 16, 41, 16, 66, 17, 42, 42, 18, 43, 18, 43, 0, 63, 0,
+    0, 18, 67, 20, 40, 20, 40, 20, 40, 40, 20, 40, 12, 34, 12, 34,
+    12, 34, 0, 37, 23, 45, 23, 45, 23, 45, 24, 46, 24, 46, 24, 46,
+    24, 46, 25, 68, 25, 0, 25, 47, 26, 48, 26, 48, 26, 48, 26, 48,
+    26, 48, 26, 69, 27, 49, 29, 49, 29, 30, 51, 30, 51, 30, 51, 0,
+    77, 77, 78, 0, 79, 80, 81, 81, 82, 83, 83, 84, 85, 81, 86, 81,
+    87, 88, 89, 90, 91, 77, 85, 89, 81, 81, 85, 81, 92, 81, 93, 81,
+    94, 95, 90, 86, 96, 97, 91, 81, 81, 91, 83, 81, 83, 93, 93, 81,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 106, 104, 106, 106, 106, 99, 106,
+    99, 107, 101, 108, 99, 109, 102, 106, 106, 102, 110, 106, 110, 99, 99, 106,
+    103, 103, 111, 101, 0, 112, 113, 114, 0, 110, 110, 115, 104, 106, 108, 106,
+    5, 5, 0, 5, 5, 5, 0, 0, 139, 140, 141, 139, 139, 140, 4, 139,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_16_boldKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 0, 2, 3, 0, 4, 5, 6, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 9, 0, 0, 0, 10,
+    0, 11, 12, 13, 12, 12, 12, 13, 12, 12, 14, 12, 12, 15, 12, 13,
+    12, 13, 12, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23, 24, 0, 0,
+    0, 25, 26, 27, 27, 27, 28, 29, 30, 31, 32, 30, 30, 33, 33, 27,
+    34, 27, 33, 35, 36, 37, 38, 38, 39, 40, 41, 0, 0, 42, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 45,
+    11, 11, 11, 11, 11, 11, 46, 13, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 13, 13, 13, 13, 13, 0, 47, 18, 18, 18, 18, 21, 12, 48,
+    25, 25, 25, 49, 50, 25, 25, 27, 27, 27, 27, 51, 52, 31, 53, 54,
+    27, 33, 27, 27, 27, 27, 27, 0, 27, 37, 37, 37, 37, 40, 55, 40,
+    11, 56, 11, 57, 11, 25, 13, 27, 13, 27, 13, 27, 13, 27, 12, 27,
+    12, 27, 12, 51, 12, 27, 12, 27, 12, 27, 12, 27, 13, 29, 13, 58,
+    13, 29, 13, 29, 12, 30, 12, 59, 12, 54, 12, 54, 12, 54, 12, 31,
+    12, 31, 12, 31, 14, 60, 12, 30, 33, 12, 30, 12, 30, 12, 30, 12,
+    30, 12, 61, 12, 33, 12, 33, 12, 33, 33, 12, 33, 13, 27, 13, 27,
+    13, 27, 13, 27, 12, 33, 12, 33, 12, 62, 16, 35, 16, 63, 16, 35,
+    16, 64, 17, 36, 17, 36, 17, 36, 18, 37, 18, 37, 18, 37, 18, 37,
+    18, 37, 18, 37, 19, 38, 21, 40, 21, 22, 41, 22, 41, 22, 65, 48,
+    72, 72, 73, 72, 74, 75, 72, 72, 76, 77, 72, 73, 72, 72, 78, 72,
+    79, 72, 72, 72, 80, 72, 81, 82, 72, 72, 72, 77, 83, 72, 74, 72,
+    72, 74, 73, 78, 84, 85, 72, 86, 72, 72, 73, 72, 72, 87, 72, 88,
+    89, 90, 91, 91, 92, 93, 94, 95, 91, 91, 91, 96, 91, 91, 93, 91,
+    97, 93, 98, 99, 93, 100, 91, 101, 91, 91, 98, 91, 91, 102, 91, 103,
+    93, 93, 104, 91, 93, 105, 0, 106, 107, 96, 91, 104, 91, 91, 108, 91,
+    5, 5, 0, 5, 5, 5, 0, 0, 119, 120, 6, 119, 119, 120, 6, 119,
+    0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_16_boldLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -5410,6 +5544,11 @@ static const EpdLigaturePair bookerly_16_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_16_boldLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_16_bold = {
     bookerly_16_boldBitmaps,
     bookerly_16_boldGlyphs,
@@ -5421,6 +5560,7 @@ static const EpdFontData bookerly_16_bold = {
     true,
     bookerly_16_boldGroups,
     14,
+    bookerly_16_boldGlyphGroups,
     bookerly_16_boldKernLeftClasses,
     bookerly_16_boldKernRightClasses,
     bookerly_16_boldKernMatrix,
@@ -5430,4 +5570,7 @@ static const EpdFontData bookerly_16_bold = {
     120,
     bookerly_16_boldLigaturePairs,
     5,
+    bookerly_16_boldKernLeftDirect,
+    bookerly_16_boldKernRightDirect,
+    bookerly_16_boldLigatureStartFilter,
 };
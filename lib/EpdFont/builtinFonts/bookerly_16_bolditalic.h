@@ -4083,6 +4083,68 @@ static const EpdFontGroup bookerly_16_bolditalicGroups[] = {
     { 48503, 148, 256, 1, 937 },
 };
 
+static const uint8_t bookerly_16_bolditalicGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_16_bolditalicKernLeftClasses[] = {
     { 0x0028, 1 }, // (
     { 0x002A, 2 }, // *
@@ -5594,6 +5656,78 @@ static const int8_t bookerly_16_bolditalicKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    1,    3,    0,    0,   -2,   -2,   -4,    1,   -2,    0,    0,    0,    0,    0,    3,    0,    0,   -1,    3,    0,    0,   -1,   -1,   -2,    0,   -1,    0,    0,    0,   -2,    0,    0,    1,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    2,    0,    0,    0,    0,    1,   -2,   -1,    0,    3,    1,    0,    0,    0,    1,    1,    0,    0,   -1,    1,   -3,    0,    1,    0,   -1,    0,    0,    0,    0,   -1,    0,    0,    0,    0,   -2,    0,   -2,   -3,    0,    0,    0,   -1,    0,    3,    0,   -4,   -2,    0,   -1,    0,   -2,   -4,   -1,    0,    1,    0,    0,    0,    0,   -4,   -4,
 };
 
+static const uint8_t bookerly_16_bolditalicKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 3, 4, 3, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0,
+    0, 7, 8, 9, 10, 11, 12, 13, 14, 14, 15, 16, 17, 18, 19, 10,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 0,
+    0, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 0, 40, 40, 34,
+    34, 44, 45, 46, 47, 33, 48, 48, 49, 48, 50, 51, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 54,
+    7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11, 14, 14, 14, 14,
+    10, 19, 10, 10, 10, 10, 10, 0, 10, 25, 25, 25, 25, 29, 55, 56,
+    33, 33, 33, 33, 33, 33, 37, 57, 37, 37, 37, 37, 41, 58, 59, 59,
+    34, 40, 34, 34, 34, 34, 34, 0, 60, 33, 33, 33, 33, 48, 34, 48,
+    7, 33, 7, 33, 61, 62, 9, 35, 9, 35, 9, 35, 9, 35, 10, 63,
+    10, 36, 11, 37, 11, 37, 11, 37, 64, 65, 11, 37, 13, 39, 13, 39,
+    13, 39, 13, 39, 14, 40, 66, 40, 14, 59, 14, 59, 14, 59, 67, 68,
+    14, 33, 15, 42, 15, 69, 16, 43, 70, 17, 0, 17, 71, 0, 63, 0,
+    0, 17, 72, 19, 40, 19, 40, 19, 40, 40, 19, 42, 10, 34, 10, 34,
+    10, 34, 11, 37, 22, 45, 22, 45, 22, 45, 23, 46, 23, 46, 23, 73,
+    23, 46, 24, 74, 24, 0, 24, 47, 25, 33, 25, 33, 25, 33, 25, 33,
+    25, 33, 25, 62, 26, 48, 29, 48, 29, 30, 50, 30, 50, 30, 50, 0,
+    84, 84, 85, 0, 86, 87, 88, 88, 89, 90, 90, 91, 92, 88, 93, 88,
+    94, 95, 96, 97, 98, 84, 92, 96, 88, 88, 92, 88, 99, 88, 100, 88,
+    101, 102, 103, 93, 104, 105, 98, 88, 88, 98, 90, 88, 90, 100, 100, 88,
+    106, 107, 108, 70, 109, 110, 111, 108, 106, 106, 112, 106, 106, 106, 113, 114,
+    113, 115, 114, 116, 109, 117, 118, 106, 106, 118, 119, 106, 120, 113, 113, 106,
+    110, 110, 121, 70, 115, 122, 41, 123, 124, 120, 120, 114, 112, 106, 116, 106,
+    4, 4, 0, 4, 4, 4, 0, 0, 150, 151, 152, 150, 150, 151, 3, 0,
+    0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_16_bolditalicKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4, 0, 5, 6, 7, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10, 0, 0, 0, 11,
+    0, 12, 13, 14, 13, 15, 15, 14, 15, 15, 16, 15, 15, 17, 15, 14,
+    13, 14, 13, 18, 19, 20, 21, 21, 22, 23, 24, 0, 25, 26, 0, 0,
+    0, 27, 28, 27, 27, 27, 29, 30, 31, 32, 33, 31, 31, 34, 34, 27,
+    34, 27, 34, 35, 36, 37, 38, 38, 39, 40, 41, 0, 0, 42, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 46,
+    12, 12, 12, 12, 12, 12, 47, 14, 15, 15, 15, 15, 15, 15, 15, 15,
+    13, 15, 14, 14, 14, 14, 14, 0, 14, 20, 20, 20, 20, 23, 15, 48,
+    27, 27, 27, 27, 49, 27, 27, 27, 27, 27, 27, 27, 50, 32, 51, 51,
+    27, 34, 27, 27, 27, 27, 27, 0, 52, 37, 37, 37, 37, 38, 31, 38,
+    12, 27, 12, 27, 12, 27, 14, 27, 14, 27, 14, 27, 14, 49, 13, 27,
+    13, 27, 15, 27, 15, 27, 15, 27, 15, 27, 15, 27, 14, 30, 14, 30,
+    14, 30, 14, 30, 15, 31, 15, 53, 15, 51, 15, 51, 15, 51, 15, 32,
+    15, 34, 15, 32, 16, 54, 15, 31, 34, 15, 31, 15, 31, 15, 31, 15,
+    31, 15, 55, 15, 34, 15, 34, 15, 34, 34, 15, 34, 14, 27, 14, 27,
+    14, 27, 14, 27, 13, 34, 13, 34, 13, 34, 18, 35, 18, 35, 18, 35,
+    18, 56, 19, 36, 19, 36, 19, 36, 20, 37, 20, 37, 20, 37, 20, 37,
+    20, 37, 20, 37, 21, 38, 23, 38, 23, 24, 41, 24, 41, 24, 57, 48,
+    64, 64, 65, 64, 66, 67, 64, 64, 68, 69, 64, 65, 64, 64, 70, 64,
+    71, 64, 72, 64, 73, 64, 74, 75, 64, 64, 64, 69, 76, 64, 66, 64,
+    72, 66, 65, 70, 77, 78, 64, 79, 64, 64, 65, 64, 64, 80, 64, 81,
+    82, 83, 82, 84, 85, 82, 86, 87, 88, 88, 89, 90, 91, 89, 82, 89,
+    92, 82, 89, 93, 82, 94, 88, 95, 88, 88, 96, 88, 88, 87, 89, 97,
+    82, 82, 98, 84, 82, 99, 100, 101, 102, 90, 89, 103, 89, 88, 93, 88,
+    6, 6, 0, 6, 6, 6, 0, 0, 118, 119, 7, 118, 118, 119, 7, 0,
+    0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 1, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_16_bolditalicLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -5602,6 +5736,11 @@ static const EpdLigaturePair bookerly_16_bolditalicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_16_bolditalicLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_16_bolditalic = {
     bookerly_16_bolditalicBitmaps,
     bookerly_16_bolditalicGlyphs,
@@ -5613,6 +5752,7 @@ static const EpdFontData bookerly_16_bolditalic = {
     true,
     bookerly_16_bolditalicGroups,
     14,
+    bookerly_16_bolditalicGlyphGroups,
     bookerly_16_bolditalicKernLeftClasses,
     bookerly_16_bolditalicKernRightClasses,
     bookerly_16_bolditalicKernMatrix,
@@ -5622,4 +5762,7 @@ static const EpdFontData bookerly_16_bolditalic = {
     119,
     bookerly_16_bolditalicLigaturePairs,
     5,
+    bookerly_16_bolditalicKernLeftDirect,
+    bookerly_16_bolditalicKernRightDirect,
+    bookerly_16_bolditalicLigatureStartFilter,
 };
@@ -3875,6 +3875,68 @@ static const EpdFontGroup bookerly_16_regularGroups[] = {
     { 45168, 148, 256, 1, 937 },
 };
 
+static const uint8_t bookerly_16_regularGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_16_regularKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0027, 1 }, // '
@@ -5363,6 +5425,78 @@ static const int8_t bookerly_16_regularKernMatrix[] = {
        0,    0,    0,    0,   -3,    0,   -3,    0,    0,    0,    0,   -4,    0,   -2,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,   -2,    0,   -2,    0,   -3,    0,    0,    0,    0,    0,   -3,    0,    0,    0,    0,    0,   -1,    0,    0,    0,    0,   -6,    0,   -2,   -2,   -2,    0,    0,    0,    0,   -2,   -2,    0,    1,    0,    0,   -3,   -1,    0,   -3,    0,    0,    0,    0,    0,    0,   -2,   -1,    0,   -3,    0,   -4,   -3,   -1,    0,    0,    0,    0,    0,    0,   -2,   -2,    0,    0,   -3,   -2,    0,    0,   -3,    0,    0,    0,    0,    0,   -3,    0,   -3,    0,    0,    0,    0,    0,    0,   -2,   -6,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t bookerly_16_regularKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 5, 4, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0,
+    8, 9, 10, 11, 12, 0, 13, 14, 15, 15, 16, 17, 18, 19, 20, 12,
+    21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 31, 32, 0, 0, 0,
+    0, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 40, 40, 34,
+    34, 45, 46, 47, 48, 49, 50, 50, 51, 50, 52, 53, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 57,
+    9, 9, 9, 9, 9, 9, 0, 11, 0, 0, 0, 0, 15, 15, 15, 15,
+    12, 20, 12, 12, 12, 12, 12, 0, 58, 26, 26, 26, 26, 29, 59, 60,
+    33, 33, 33, 33, 33, 33, 37, 35, 37, 37, 37, 37, 41, 41, 61, 61,
+    62, 40, 34, 34, 34, 34, 34, 0, 63, 49, 49, 49, 49, 50, 34, 50,
+    9, 33, 9, 33, 64, 65, 11, 35, 11, 35, 11, 35, 11, 35, 12, 66,
+    12, 36, 0, 37, 0, 37, 0, 37, 67, 68, 0, 37, 14, 39, 14, 39,
+    14, 39, 14, 39, 15, 40, 15, 40, 15, 61, 15, 61, 15, 61, 69, 70,
+    15, 41, 16, 42, 16, 71, 17, 43, 43, 18, 44, 18, 44, 0, 66, 0,
+    0, 18, 72, 20, 40, 20, 40, 20, 40, 40, 20, 40, 12, 34, 12, 34,
+    12, 34, 0, 37, 23, 46, 23, 46, 23, 46, 24, 47, 24, 47, 24, 47,
+    24, 47, 25, 48, 25, 0, 25, 48, 26, 49, 26, 49, 26, 49, 26, 49,
+    26, 49, 26, 73, 27, 50, 29, 50, 29, 30, 52, 30, 52, 30, 52, 0,
+    81, 81, 82, 0, 83, 84, 85, 85, 86, 87, 87, 88, 89, 85, 90, 85,
+    91, 92, 93, 94, 95, 81, 89, 93, 85, 85, 89, 85, 96, 85, 97, 85,
+    98, 99, 94, 90, 100, 101, 95, 85, 85, 95, 87, 85, 87, 97, 97, 85,
+    102, 103, 104, 105, 106, 107, 108, 109, 110, 110, 108, 110, 110, 110, 103, 110,
+    103, 111, 105, 112, 103, 113, 106, 110, 110, 106, 114, 110, 114, 103, 103, 110,
+    107, 107, 115, 105, 0, 116, 117, 118, 119, 114, 114, 120, 108, 110, 112, 110,
+    5, 5, 0, 5, 5, 5, 0, 0, 144, 145, 4, 144, 144, 145, 4, 144,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 56, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_16_regularKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4, 0, 5, 6, 7, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10, 0, 0, 0, 11,
+    0, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15, 13, 13, 16, 13, 14,
+    13, 14, 13, 17, 18, 19, 20, 20, 21, 22, 23, 0, 24, 25, 0, 0,
+    0, 26, 27, 28, 28, 28, 29, 30, 31, 32, 33, 31, 31, 34, 34, 28,
+    35, 28, 34, 36, 37, 38, 39, 39, 40, 41, 42, 0, 0, 43, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 46,
+    12, 12, 12, 12, 12, 12, 47, 14, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 14, 14, 14, 14, 14, 0, 14, 19, 19, 19, 19, 22, 13, 48,
+    26, 26, 26, 49, 50, 26, 26, 28, 28, 28, 28, 51, 52, 32, 53, 54,
+    28, 34, 28, 28, 28, 28, 28, 0, 28, 38, 38, 38, 38, 41, 55, 41,
+    12, 56, 12, 57, 12, 26, 14, 28, 14, 28, 14, 28, 14, 28, 13, 28,
+    13, 28, 13, 28, 13, 28, 13, 28, 13, 28, 13, 28, 14, 30, 14, 30,
+    14, 30, 14, 30, 13, 31, 13, 58, 13, 54, 13, 54, 13, 54, 13, 32,
+    13, 32, 13, 32, 15, 59, 13, 31, 34, 13, 31, 13, 31, 13, 31, 13,
+    31, 13, 60, 13, 34, 13, 34, 13, 34, 34, 13, 34, 14, 28, 14, 28,
+    14, 28, 14, 28, 13, 34, 13, 34, 13, 61, 17, 36, 17, 36, 17, 36,
+    17, 62, 18, 37, 18, 37, 18, 37, 19, 38, 19, 38, 19, 38, 19, 38,
+    19, 38, 19, 38, 20, 39, 22, 41, 22, 23, 42, 23, 42, 23, 63, 48,
+    70, 70, 71, 70, 72, 73, 70, 70, 74, 75, 70, 71, 70, 70, 76, 70,
+    77, 70, 70, 70, 78, 70, 79, 80, 70, 70, 70, 75, 81, 70, 72, 70,
+    70, 72, 71, 76, 82, 83, 70, 84, 70, 70, 71, 70, 70, 85, 70, 86,
+    87, 88, 89, 89, 90, 91, 92, 93, 89, 89, 89, 94, 89, 89, 91, 89,
+    95, 91, 96, 97, 91, 98, 89, 99, 89, 89, 96, 89, 89, 93, 89, 100,
+    91, 91, 101, 89, 91, 102, 0, 103, 104, 94, 89, 101, 89, 89, 105, 89,
+    6, 6, 0, 6, 6, 6, 0, 0, 115, 116, 7, 115, 115, 116, 7, 115,
+    0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 1, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_16_regularLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -5371,6 +5505,11 @@ static const EpdLigaturePair bookerly_16_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_16_regularLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_16_regular = {
     bookerly_16_regularBitmaps,
     bookerly_16_regularGlyphs,
@@ -5382,6 +5521,7 @@ static const EpdFontData bookerly_16_regular = {
     true,
     bookerly_16_regularGroups,
     14,
+    bookerly_16_regularGlyphGroups,
     bookerly_16_regularKernLeftClasses,
     bookerly_16_regularKernRightClasses,
     bookerly_16_regularKernMatrix,
@@ -5391,4 +5531,7 @@ static const EpdFontData bookerly_16_regular = {
     116,
     bookerly_16_regularLigaturePairs,
     5,
+    bookerly_16_regularKernLeftDirect,
+    bookerly_16_regularKernRightDirect,
+    bookerly_16_regularLigatureStartFilter,
 };
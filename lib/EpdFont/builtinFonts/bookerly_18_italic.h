@@ -4341,6 +4341,68 @@ static const EpdFontGroup bookerly_18_italicGroups[] = {
     { 52609, 168, 324, 1, 937 },
 };
 
+static const uint8_t bookerly_18_italicGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_18_italicKernLeftClasses[] = {
     { 0x0028, 1 }, // (
     { 0x002A, 2 }, // *
@@ -5827,6 +5889,78 @@ static const int8_t bookerly_18_italicKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    1,    0,   -2,    0,    2,    0,    0,   -2,   -3,   -4,    1,   -3,    0,    0,    0,   -1,    0,    3,    0,    0,    3,   -1,    0,   -1,   -1,   -3,    0,   -2,    0,    0,    0,    0,    0,    1,    0,    0,    0,   -1,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    3,    0,    0,    0,    0,    0,   -2,   -2,    0,    2,    1,    0,    1,    0,    1,    0,    0,    0,   -1,    1,   -4,    0,    1,   -1,   -1,    0,   -1,    0,    0,   -1,   -1,    0,    0,   -3,    0,   -5,   -3,    0,    0,    0,    0,    0,    3,    0,   -4,   -2,    0,   -3,   -5,   -2,    0,    1,    0,    0,    0,   -4,   -4,
 };
 
+static const uint8_t bookerly_18_italicKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 3, 4, 3, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 7, 8, 9, 10, 11, 12, 13, 13, 14, 15, 16, 17, 18, 9,
+    19, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28, 29, 30, 0, 0, 0,
+    0, 31, 32, 33, 0, 34, 35, 36, 37, 0, 38, 39, 0, 37, 37, 32,
+    32, 40, 41, 42, 43, 31, 44, 44, 45, 44, 46, 47, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 51,
+    6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10, 13, 13, 13, 13,
+    9, 18, 9, 9, 9, 9, 9, 0, 9, 24, 24, 24, 24, 27, 52, 53,
+    31, 31, 31, 31, 31, 31, 34, 54, 34, 34, 34, 34, 0, 0, 55, 55,
+    32, 37, 32, 32, 32, 32, 32, 0, 56, 31, 31, 31, 31, 44, 32, 44,
+    6, 31, 6, 31, 57, 58, 8, 33, 8, 33, 8, 33, 8, 33, 9, 59,
+    9, 0, 10, 34, 10, 34, 10, 34, 60, 61, 10, 34, 12, 36, 12, 36,
+    12, 36, 12, 36, 13, 37, 13, 37, 13, 62, 13, 55, 13, 55, 63, 64,
+    13, 31, 14, 38, 14, 65, 15, 39, 66, 16, 0, 16, 67, 0, 59, 0,
+    0, 16, 68, 18, 37, 18, 37, 18, 37, 37, 18, 69, 9, 32, 9, 32,
+    9, 32, 10, 34, 21, 41, 21, 41, 21, 41, 22, 42, 22, 42, 22, 70,
+    22, 42, 23, 71, 23, 0, 23, 43, 24, 31, 24, 31, 24, 31, 24, 31,
+    24, 31, 24, 72, 25, 44, 27, 44, 27, 28, 46, 28, 46, 28, 46, 0,
+    81, 81, 82, 0, 83, 84, 85, 85, 86, 87, 87, 88, 89, 85, 90, 85,
+    91, 92, 93, 94, 95, 81, 89, 93, 85, 85, 89, 85, 96, 85, 97, 85,
+    98, 99, 100, 90, 101, 102, 95, 85, 85, 95, 87, 85, 87, 97, 97, 85,
+    103, 104, 105, 0, 106, 107, 108, 105, 103, 103, 109, 103, 103, 103, 106, 110,
+    106, 111, 110, 112, 106, 113, 114, 103, 103, 114, 115, 103, 115, 106, 106, 103,
+    107, 107, 116, 0, 111, 117, 0, 118, 119, 115, 115, 110, 109, 103, 112, 103,
+    4, 4, 0, 4, 4, 4, 0, 0, 143, 144, 145, 143, 143, 144, 3, 0,
+    0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_18_italicKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 4, 5, 6, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 9, 0, 0, 0, 10,
+    0, 11, 12, 13, 12, 14, 14, 13, 14, 14, 15, 14, 14, 16, 14, 13,
+    12, 13, 12, 17, 18, 19, 20, 20, 21, 22, 23, 0, 24, 25, 0, 0,
+    0, 26, 27, 26, 26, 26, 28, 29, 27, 30, 31, 27, 27, 32, 32, 26,
+    32, 26, 32, 33, 34, 35, 36, 36, 37, 38, 39, 0, 0, 40, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 43,
+    11, 11, 11, 11, 11, 11, 44, 13, 14, 14, 14, 14, 14, 14, 14, 14,
+    12, 14, 13, 13, 13, 13, 13, 0, 13, 19, 19, 19, 19, 22, 14, 45,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 46, 30, 47, 47,
+    26, 32, 26, 26, 26, 26, 26, 0, 48, 35, 35, 35, 35, 36, 49, 36,
+    11, 26, 11, 26, 11, 26, 13, 26, 13, 26, 13, 26, 13, 50, 12, 26,
+    12, 26, 14, 26, 14, 26, 14, 26, 14, 26, 14, 26, 13, 29, 13, 29,
+    13, 29, 13, 29, 14, 27, 14, 51, 14, 52, 14, 47, 14, 47, 14, 30,
+    14, 32, 14, 30, 15, 53, 14, 27, 32, 14, 27, 14, 27, 14, 27, 14,
+    27, 14, 54, 14, 32, 14, 32, 14, 32, 32, 14, 32, 13, 26, 13, 26,
+    13, 26, 13, 26, 12, 32, 12, 32, 12, 32, 17, 33, 17, 33, 17, 33,
+    17, 55, 18, 34, 18, 34, 18, 34, 19, 35, 19, 35, 19, 35, 19, 35,
+    19, 35, 19, 35, 20, 36, 22, 36, 22, 23, 39, 23, 39, 23, 56, 45,
+    63, 63, 64, 63, 65, 66, 63, 63, 67, 68, 63, 64, 63, 63, 69, 63,
+    70, 63, 71, 63, 72, 63, 73, 74, 63, 63, 63, 68, 75, 63, 65, 63,
+    71, 65, 64, 69, 76, 77, 63, 78, 63, 63, 64, 63, 63, 79, 63, 80,
+    81, 82, 81, 83, 84, 81, 85, 86, 87, 87, 88, 89, 90, 88, 81, 88,
+    88, 81, 88, 91, 81, 92, 87, 93, 87, 87, 94, 87, 87, 86, 88, 95,
+    81, 81, 96, 83, 81, 97, 98, 99, 100, 89, 88, 101, 88, 87, 91, 87,
+    5, 5, 0, 5, 5, 5, 0, 0, 113, 114, 6, 113, 113, 114, 6, 0,
+    0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 1, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_18_italicLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -5835,6 +5969,11 @@ static const EpdLigaturePair bookerly_18_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_18_italicLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_18_italic = {
     bookerly_18_italicBitmaps,
     bookerly_18_italicGlyphs,
@@ -5846,6 +5985,7 @@ static const EpdFontData bookerly_18_italic = {
     true,
     bookerly_18_italicGroups,
     14,
+    bookerly_18_italicGlyphGroups,
     bookerly_18_italicKernLeftClasses,
     bookerly_18_italicKernRightClasses,
     bookerly_18_italicKernMatrix,
@@ -5855,4 +5995,7 @@ static const EpdFontData bookerly_18_italic = {
     114,
     bookerly_18_italicLigaturePairs,
     5,
+    bookerly_18_italicKernLeftDirect,
+    bookerly_18_italicKernRightDirect,
+    bookerly_18_italicLigatureStartFilter,
 };
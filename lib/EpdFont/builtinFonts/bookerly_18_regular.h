@@ -4156,6 +4156,68 @@ static const EpdFontGroup bookerly_18_regularGroups[] = {
     { 49654, 168, 324, 1, 937 },
 };
 
+static const uint8_t bookerly_18_regularGlyphGroups[938] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 12, 12, 12, 13,
+};
+
 static const EpdKernClassEntry bookerly_18_regularKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0027, 1 }, // '
@@ -5644,6 +5706,78 @@ static const int8_t bookerly_18_regularKernMatrix[] = {
        0,    0,    0,    0,   -3,    0,   -3,    0,    0,    0,    0,   -4,    0,   -2,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,   -2,    0,   -2,    0,   -4,    0,    0,    0,    0,    0,   -3,    0,    0,    0,    0,    0,   -1,    0,    0,    0,    0,   -7,   -2,    0,   -2,   -2,   -2,    0,    0,    0,    0,   -2,   -2,    0,    1,    0,    0,   -3,   -1,    0,   -4,    0,    0,   -2,    0,    0,    0,    0,   -2,   -1,    0,   -3,    0,   -4,   -3,   -1,    0,    0,    0,    0,    0,    0,   -2,   -2,    0,    0,   -3,   -2,    0,    0,   -3,    0,    0,    0,    0,    0,   -3,    0,   -3,    0,    0,    0,    0,    0,    0,   -2,   -7,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t bookerly_18_regularKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3, 0, 4, 5, 4, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0,
+    8, 9, 10, 11, 12, 0, 13, 14, 15, 15, 16, 17, 18, 19, 20, 12,
+    21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 31, 32, 0, 0, 0,
+    0, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 40, 40, 34,
+    34, 45, 46, 47, 48, 49, 50, 50, 51, 50, 52, 53, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 57,
+    9, 9, 9, 9, 9, 9, 0, 11, 0, 0, 0, 0, 15, 15, 15, 15,
+    12, 20, 12, 12, 12, 12, 12, 0, 58, 26, 26, 26, 26, 29, 59, 60,
+    33, 33, 33, 33, 33, 33, 37, 35, 37, 37, 37, 37, 41, 41, 61, 61,
+    62, 40, 34, 34, 34, 34, 34, 0, 63, 49, 49, 49, 49, 50, 34, 50,
+    9, 33, 9, 33, 64, 65, 11, 35, 11, 35, 11, 35, 11, 35, 12, 66,
+    12, 36, 0, 37, 0, 37, 0, 37, 67, 68, 0, 37, 14, 39, 14, 39,
+    14, 39, 14, 39, 15, 40, 15, 40, 15, 61, 15, 61, 15, 61, 69, 70,
+    15, 41, 16, 42, 16, 71, 17, 43, 43, 18, 44, 18, 44, 0, 66, 0,
+    0, 18, 72, 20, 40, 20, 40, 20, 40, 40, 20, 40, 12, 34, 12, 34,
+    12, 34, 0, 37, 23, 46, 23, 46, 23, 46, 24, 47, 24, 47, 24, 47,
+    24, 47, 25, 48, 25, 0, 25, 48, 26, 49, 26, 49, 26, 49, 26, 49,
+    26, 49, 26, 73, 27, 50, 29, 50, 29, 30, 52, 30, 52, 30, 52, 0,
+    81, 81, 82, 0, 83, 84, 85, 85, 86, 87, 87, 88, 89, 85, 90, 85,
+    91, 92, 93, 94, 95, 81, 89, 93, 85, 85, 89, 85, 96, 85, 97, 85,
+    98, 99, 94, 90, 100, 101, 95, 85, 85, 95, 87, 85, 87, 97, 97, 85,
+    102, 103, 104, 105, 106, 107, 108, 109, 110, 110, 108, 110, 110, 110, 103, 110,
+    103, 111, 105, 112, 103, 113, 106, 110, 110, 106, 114, 110, 114, 103, 103, 110,
+    107, 107, 115, 105, 0, 116, 117, 118, 119, 114, 114, 120, 108, 110, 112, 110,
+    5, 5, 0, 5, 5, 5, 0, 0, 144, 145, 4, 144, 144, 145, 4, 144,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 56, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_18_regularKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4, 0, 5, 6, 7, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10, 0, 0, 0, 11,
+    0, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15, 13, 13, 16, 13, 14,
+    13, 14, 13, 17, 18, 19, 20, 20, 21, 22, 23, 0, 24, 25, 0, 0,
+    0, 26, 27, 28, 28, 28, 29, 30, 31, 32, 33, 31, 31, 34, 34, 28,
+    35, 28, 34, 36, 37, 38, 39, 39, 40, 41, 42, 0, 0, 43, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 46,
+    12, 12, 12, 12, 12, 12, 47, 14, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 14, 14, 14, 14, 14, 0, 48, 19, 19, 19, 19, 22, 13, 49,
+    26, 26, 26, 50, 51, 26, 26, 28, 28, 28, 28, 52, 53, 32, 54, 55,
+    28, 34, 28, 28, 28, 28, 28, 0, 28, 38, 38, 38, 38, 41, 56, 41,
+    12, 57, 12, 58, 12, 26, 14, 28, 14, 28, 14, 28, 14, 28, 13, 28,
+    13, 28, 13, 28, 13, 28, 13, 28, 13, 28, 13, 28, 14, 30, 14, 30,
+    14, 30, 14, 30, 13, 31, 13, 59, 13, 55, 13, 55, 13, 55, 13, 32,
+    13, 32, 13, 32, 15, 60, 13, 31, 34, 13, 31, 13, 31, 13, 31, 13,
+    31, 13, 61, 13, 34, 13, 34, 13, 34, 34, 13, 34, 14, 28, 14, 28,
+    14, 28, 14, 28, 13, 34, 13, 34, 13, 62, 17, 36, 17, 36, 17, 36,
+    17, 63, 18, 37, 18, 37, 18, 37, 19, 38, 19, 38, 19, 38, 19, 38,
+    19, 38, 19, 38, 20, 39, 22, 41, 22, 23, 42, 23, 42, 23, 64, 49,
+    72, 72, 73, 72, 74, 75, 72, 72, 76, 77, 72, 73, 72, 72, 78, 72,
+    79, 72, 72, 72, 80, 72, 81, 82, 72, 72, 72, 77, 83, 72, 74, 72,
+    72, 74, 73, 78, 84, 85, 72, 86, 72, 72, 73, 72, 72, 87, 72, 88,
+    89, 90, 91, 91, 92, 93, 94, 95, 91, 91, 91, 96, 91, 91, 93, 91,
+    97, 93, 98, 99, 93, 100, 91, 101, 91, 91, 98, 91, 91, 95, 91, 102,
+    93, 93, 103, 91, 93, 104, 0, 105, 106, 96, 91, 103, 91, 91, 107, 91,
+    6, 6, 0, 6, 6, 6, 0, 0, 117, 118, 7, 117, 117, 118, 7, 117,
+    0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 1, 0, 0, 0,
+};
+
 static const EpdLigaturePair bookerly_18_regularLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -5652,6 +5786,11 @@ static const EpdLigaturePair bookerly_18_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t bookerly_18_regularLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData bookerly_18_regular = {
     bookerly_18_regularBitmaps,
     bookerly_18_regularGlyphs,
@@ -5663,6 +5802,7 @@ static const EpdFontData bookerly_18_regular = {
     true,
     bookerly_18_regularGroups,
     14,
+    bookerly_18_regularGlyphGroups,
     bookerly_18_regularKernLeftClasses,
     bookerly_18_regularKernRightClasses,
     bookerly_18_regularKernMatrix,
@@ -5672,4 +5812,7 @@ static const EpdFontData bookerly_18_regular = {
     118,
     bookerly_18_regularLigaturePairs,
     5,
+    bookerly_18_regularKernLeftDirect,
+    bookerly_18_regularKernRightDirect,
+    bookerly_18_regularLigatureStartFilter,
 };
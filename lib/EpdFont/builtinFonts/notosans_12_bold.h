@@ -3086,6 +3086,76 @@ static const EpdFontGroup notosans_12_boldGroups[] = {
     { 31303, 90, 133, 1, 1069 },
 };
 
+static const uint8_t notosans_12_boldGlyphGroups[1070] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 10, 11, 11, 11, 11, 11, 11, 11, 12,
+};
+
 static const EpdKernClassEntry notosans_12_boldKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0026, 2 }, // &
@@ -4109,6 +4179,78 @@ static const int8_t notosans_12_boldKernMatrix[] = {
        0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t notosans_12_boldKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0, 9, 13, 0, 0, 10,
+    14, 10, 15, 0, 16, 17, 18, 18, 9, 19, 9, 3, 0, 0, 0, 20,
+    0, 21, 22, 0, 0, 22, 23, 0, 21, 0, 0, 0, 0, 21, 21, 22,
+    22, 0, 24, 0, 0, 0, 25, 25, 26, 25, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 30,
+    7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11, 0, 0, 0, 0,
+    10, 0, 10, 10, 10, 10, 10, 0, 10, 17, 17, 17, 17, 19, 14, 0,
+    21, 21, 21, 21, 21, 21, 22, 0, 22, 22, 22, 22, 0, 0, 31, 31,
+    22, 0, 22, 22, 22, 22, 22, 0, 22, 0, 0, 0, 0, 25, 22, 25,
+    7, 21, 7, 21, 32, 21, 9, 0, 9, 0, 9, 0, 9, 0, 10, 33,
+    10, 0, 11, 22, 11, 22, 11, 22, 11, 22, 11, 22, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 21, 0, 0, 0, 34, 0, 31, 0, 0, 11, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 26, 13, 0, 13, 0, 13, 33, 13,
+    0, 13, 0, 0, 21, 0, 21, 0, 0, 21, 0, 21, 10, 22, 10, 22,
+    10, 22, 11, 22, 0, 24, 0, 24, 0, 24, 0, 0, 0, 0, 0, 0,
+    0, 0, 16, 0, 16, 35, 16, 0, 17, 0, 17, 0, 17, 0, 17, 0,
+    17, 0, 17, 0, 18, 25, 19, 25, 19, 9, 0, 9, 0, 9, 0, 0,
+    39, 39, 40, 41, 42, 43, 0, 0, 0, 44, 44, 40, 45, 0, 46, 0,
+    47, 48, 49, 41, 50, 39, 45, 49, 0, 0, 45, 0, 0, 0, 51, 0,
+    52, 42, 41, 46, 53, 45, 50, 0, 0, 50, 44, 0, 44, 51, 51, 0,
+    54, 55, 56, 57, 58, 59, 60, 56, 61, 61, 60, 61, 61, 61, 59, 61,
+    59, 62, 57, 63, 59, 60, 58, 61, 61, 58, 64, 61, 64, 59, 59, 61,
+    59, 59, 65, 57, 62, 66, 0, 67, 0, 64, 64, 68, 60, 61, 63, 61,
+    0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 29, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t notosans_12_boldKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 8,
+    0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0, 0, 10,
+    0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 17, 0, 0, 4, 0, 0,
+    0, 18, 0, 19, 19, 19, 20, 18, 0, 0, 21, 0, 0, 22, 22, 19,
+    22, 19, 22, 22, 20, 22, 23, 23, 23, 23, 24, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 27, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0, 0,
+    19, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 0, 0, 0, 0,
+    0, 0, 19, 19, 19, 19, 19, 0, 19, 22, 22, 22, 22, 23, 0, 23,
+    9, 18, 9, 18, 9, 18, 10, 19, 10, 19, 10, 19, 10, 19, 0, 19,
+    0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 10, 18, 10, 18,
+    10, 18, 10, 18, 0, 0, 0, 28, 0, 29, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 22, 0, 22, 0, 0, 0, 0, 22, 10, 19, 10, 19,
+    10, 19, 10, 19, 0, 22, 0, 22, 0, 0, 0, 22, 0, 0, 0, 22,
+    0, 0, 12, 20, 12, 20, 12, 20, 13, 22, 13, 22, 13, 22, 13, 22,
+    13, 22, 13, 22, 14, 23, 16, 23, 16, 17, 24, 17, 24, 17, 24, 0,
+    0, 0, 30, 0, 31, 32, 0, 0, 33, 34, 0, 30, 0, 0, 35, 0,
+    36, 0, 0, 0, 37, 0, 38, 39, 0, 0, 0, 34, 0, 0, 31, 0,
+    0, 31, 30, 35, 40, 38, 0, 41, 0, 0, 30, 0, 0, 39, 0, 42,
+    43, 44, 45, 45, 46, 47, 48, 49, 45, 45, 45, 50, 45, 45, 47, 45,
+    45, 47, 51, 52, 47, 48, 45, 53, 45, 45, 51, 45, 45, 49, 45, 54,
+    47, 47, 55, 45, 47, 45, 0, 0, 56, 50, 45, 55, 45, 45, 52, 45,
+    0, 0, 0, 6, 6, 6, 0, 0, 70, 2, 5, 0, 70, 2, 5, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 26, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair notosans_12_boldLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -4117,6 +4259,11 @@ static const EpdLigaturePair notosans_12_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t notosans_12_boldLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData notosans_12_bold = {
     notosans_12_boldBitmaps,
     notosans_12_boldGlyphs,
@@ -4128,6 +4275,7 @@ static const EpdFontData notosans_12_bold = {
     true,
     notosans_12_boldGroups,
     13,
+    notosans_12_boldGlyphGroups,
     notosans_12_boldKernLeftClasses,
     notosans_12_boldKernRightClasses,
     notosans_12_boldKernMatrix,
@@ -4137,4 +4285,7 @@ static const EpdFontData notosans_12_bold = {
     70,
     notosans_12_boldLigaturePairs,
     5,
+    notosans_12_boldKernLeftDirect,
+    notosans_12_boldKernRightDirect,
+    notosans_12_boldLigatureStartFilter,
 };
@@ -3151,6 +3151,76 @@ static const EpdFontGroup notosans_12_italicGroups[] = {
     { 32373, 90, 133, 1, 1068 },
 };
 
+static const uint8_t notosans_12_italicGlyphGroups[1069] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 10, 11, 11, 11, 11, 11, 11, 11, 12,
+};
+
 static const EpdKernClassEntry notosans_12_italicKernLeftClasses[] = {
     { 0x0020, 1 }, // U+0020
     { 0x0022, 2 }, // "
@@ -4178,6 +4248,78 @@ static const int8_t notosans_12_italicKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
 };
 
+static const uint8_t notosans_12_italicKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 2, 0, 0, 0, 3, 2, 4, 0, 0, 0, 5, 6, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0, 13, 14, 0, 0, 10,
+    15, 10, 16, 0, 17, 18, 19, 19, 13, 20, 9, 4, 0, 0, 0, 21,
+    0, 22, 23, 0, 0, 23, 24, 0, 0, 0, 0, 25, 0, 0, 0, 23,
+    23, 0, 26, 0, 0, 0, 27, 27, 25, 27, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 31,
+    7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11, 0, 0, 0, 0,
+    10, 0, 10, 10, 10, 10, 10, 0, 10, 18, 18, 18, 18, 20, 15, 0,
+    22, 22, 22, 22, 22, 22, 23, 0, 23, 23, 23, 23, 0, 0, 0, 32,
+    23, 0, 23, 23, 23, 23, 23, 0, 23, 0, 0, 0, 0, 27, 23, 27,
+    7, 22, 7, 22, 7, 22, 9, 0, 9, 0, 9, 0, 9, 0, 10, 33,
+    10, 0, 11, 23, 11, 23, 11, 23, 11, 23, 11, 23, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 32, 0, 0, 11, 0,
+    0, 0, 0, 0, 0, 0, 13, 25, 25, 14, 0, 14, 0, 14, 33, 14,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 23, 10, 23,
+    10, 23, 11, 23, 0, 26, 0, 26, 0, 26, 0, 0, 0, 0, 0, 0,
+    0, 0, 17, 0, 17, 24, 17, 0, 18, 0, 18, 0, 18, 0, 18, 0,
+    18, 0, 18, 0, 19, 27, 20, 27, 20, 9, 0, 9, 0, 9, 0, 0,
+    0, 0, 39, 40, 41, 42, 0, 0, 43, 39, 39, 44, 45, 0, 46, 0,
+    47, 48, 49, 40, 50, 0, 45, 49, 0, 0, 45, 0, 0, 0, 51, 0,
+    52, 41, 40, 46, 53, 45, 50, 0, 0, 50, 39, 0, 39, 51, 51, 0,
+    54, 55, 56, 57, 58, 57, 59, 56, 54, 54, 60, 54, 54, 54, 61, 62,
+    61, 59, 62, 63, 61, 60, 64, 54, 54, 64, 65, 54, 65, 61, 61, 54,
+    57, 57, 66, 57, 59, 67, 0, 68, 69, 65, 65, 62, 60, 54, 63, 54,
+    0, 0, 0, 6, 6, 6, 0, 0, 2, 2, 5, 0, 2, 2, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 30, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t notosans_12_italicKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 8,
+    0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0, 0, 10,
+    0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 17, 0, 0, 4, 0, 0,
+    0, 18, 0, 19, 19, 19, 20, 21, 0, 0, 22, 0, 0, 23, 23, 19,
+    23, 19, 23, 24, 25, 23, 26, 26, 0, 26, 27, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 30, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0, 22,
+    19, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 0, 0, 0, 0,
+    0, 23, 19, 19, 19, 19, 19, 0, 19, 23, 23, 23, 23, 26, 0, 26,
+    9, 18, 9, 18, 9, 18, 10, 19, 10, 19, 10, 19, 10, 19, 0, 19,
+    0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 10, 21, 10, 21,
+    10, 21, 10, 21, 0, 0, 0, 1, 0, 31, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 22, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, 0, 23, 0, 23, 0, 0, 23, 10, 19, 10, 19,
+    10, 19, 10, 19, 0, 23, 0, 23, 0, 0, 0, 24, 0, 24, 0, 24,
+    0, 24, 12, 25, 12, 25, 12, 25, 13, 23, 13, 23, 13, 23, 13, 23,
+    13, 23, 13, 23, 14, 26, 16, 26, 16, 17, 27, 17, 27, 17, 27, 0,
+    0, 0, 32, 0, 33, 34, 0, 0, 35, 36, 0, 32, 0, 0, 37, 0,
+    38, 0, 0, 0, 39, 0, 40, 41, 0, 0, 0, 36, 0, 0, 33, 0,
+    0, 33, 32, 37, 42, 40, 0, 43, 0, 0, 32, 0, 0, 41, 0, 44,
+    45, 46, 45, 47, 48, 45, 49, 47, 50, 50, 51, 52, 51, 51, 45, 51,
+    51, 45, 51, 53, 45, 54, 50, 55, 50, 50, 56, 50, 50, 49, 51, 57,
+    45, 45, 58, 47, 45, 59, 0, 60, 61, 52, 51, 58, 51, 50, 53, 50,
+    0, 0, 0, 6, 6, 6, 0, 0, 77, 2, 5, 0, 77, 2, 5, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 29, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair notosans_12_italicLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -4186,6 +4328,11 @@ static const EpdLigaturePair notosans_12_italicLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t notosans_12_italicLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData notosans_12_italic = {
     notosans_12_italicBitmaps,
     notosans_12_italicGlyphs,
@@ -4197,6 +4344,7 @@ static const EpdFontData notosans_12_italic = {
     true,
     notosans_12_italicGroups,
     13,
+    notosans_12_italicGlyphGroups,
     notosans_12_italicKernLeftClasses,
     notosans_12_italicKernRightClasses,
     notosans_12_italicKernMatrix,
@@ -4206,4 +4354,7 @@ static const EpdFontData notosans_12_italic = {
     79,
     notosans_12_italicLigaturePairs,
     5,
+    notosans_12_italicKernLeftDirect,
+    notosans_12_italicKernRightDirect,
+    notosans_12_italicLigatureStartFilter,
 };
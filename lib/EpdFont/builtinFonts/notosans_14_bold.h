@@ -3557,6 +3557,76 @@ static const EpdFontGroup notosans_14_boldGroups[] = {
     { 38821, 112, 189, 1, 1069 },
 };
 
+static const uint8_t notosans_14_boldGlyphGroups[1070] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 10, 11, 11, 11, 11, 11, 11, 11, 12,
+};
+
 static const EpdKernClassEntry notosans_14_boldKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0026, 2 }, // &
@@ -4579,6 +4649,78 @@ static const int8_t notosans_14_boldKernMatrix[] = {
        0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t notosans_14_boldKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0, 9, 13, 0, 0, 10,
+    14, 10, 15, 0, 16, 17, 18, 18, 9, 19, 9, 3, 0, 0, 0, 20,
+    0, 21, 22, 0, 0, 22, 23, 0, 21, 0, 0, 0, 0, 21, 21, 22,
+    22, 0, 24, 0, 0, 0, 25, 25, 26, 25, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 30,
+    7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11, 0, 0, 0, 0,
+    10, 0, 10, 10, 10, 10, 10, 0, 10, 17, 17, 17, 17, 19, 14, 0,
+    21, 21, 21, 21, 21, 21, 22, 0, 22, 22, 22, 22, 0, 0, 31, 31,
+    22, 0, 22, 22, 22, 22, 22, 0, 22, 0, 0, 0, 0, 25, 22, 25,
+    7, 21, 7, 21, 32, 21, 9, 0, 9, 0, 9, 0, 9, 0, 10, 33,
+    10, 0, 11, 22, 11, 22, 11, 22, 11, 22, 11, 22, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 21, 0, 0, 0, 34, 0, 31, 0, 0, 11, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 26, 13, 0, 13, 0, 13, 33, 13,
+    0, 13, 0, 0, 21, 0, 21, 0, 0, 21, 0, 21, 10, 22, 10, 22,
+    10, 22, 11, 22, 0, 24, 0, 24, 0, 24, 0, 0, 0, 0, 0, 0,
+    0, 0, 16, 0, 16, 35, 16, 0, 17, 0, 17, 0, 17, 0, 17, 0,
+    17, 0, 17, 0, 18, 25, 19, 25, 19, 9, 0, 9, 0, 9, 0, 0,
+    39, 39, 40, 41, 42, 43, 0, 0, 0, 44, 44, 40, 45, 0, 46, 0,
+    47, 48, 49, 41, 50, 39, 45, 49, 0, 0, 45, 0, 0, 0, 51, 0,
+    52, 42, 41, 46, 53, 45, 50, 0, 0, 50, 44, 0, 44, 51, 51, 0,
+    54, 55, 56, 57, 58, 55, 59, 56, 60, 60, 59, 60, 60, 60, 55, 60,
+    55, 61, 57, 62, 55, 59, 58, 60, 60, 58, 63, 60, 63, 55, 55, 60,
+    55, 55, 64, 57, 61, 65, 0, 66, 0, 63, 63, 67, 59, 60, 62, 60,
+    0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 29, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t notosans_14_boldKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 8,
+    0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0, 0, 10,
+    0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 17, 0, 0, 4, 0, 0,
+    0, 18, 0, 19, 19, 19, 20, 21, 0, 0, 22, 0, 0, 23, 23, 19,
+    23, 19, 23, 24, 20, 23, 25, 25, 25, 25, 26, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 29, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0, 0,
+    19, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 0, 0, 0, 0,
+    0, 0, 19, 19, 19, 19, 19, 0, 19, 23, 23, 23, 23, 25, 0, 25,
+    9, 18, 9, 18, 9, 18, 10, 19, 10, 19, 10, 19, 10, 19, 0, 19,
+    0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 10, 21, 10, 21,
+    10, 21, 10, 21, 0, 0, 0, 30, 0, 31, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, 0, 23, 0, 0, 0, 0, 23, 10, 19, 10, 19,
+    10, 19, 10, 19, 0, 23, 0, 23, 0, 0, 0, 24, 0, 0, 0, 24,
+    0, 0, 12, 20, 12, 20, 12, 20, 13, 23, 13, 23, 13, 23, 13, 23,
+    13, 23, 13, 23, 14, 25, 16, 25, 16, 17, 26, 17, 26, 17, 26, 0,
+    0, 0, 32, 0, 33, 34, 0, 0, 35, 36, 0, 32, 0, 0, 37, 0,
+    38, 0, 0, 0, 39, 0, 40, 41, 0, 0, 0, 36, 0, 0, 33, 0,
+    0, 33, 32, 37, 42, 40, 0, 43, 0, 0, 32, 0, 0, 41, 0, 44,
+    45, 46, 47, 47, 48, 49, 50, 51, 47, 47, 47, 52, 47, 47, 49, 47,
+    47, 49, 53, 54, 49, 50, 47, 55, 47, 47, 53, 47, 47, 51, 47, 56,
+    49, 49, 57, 47, 49, 47, 0, 0, 58, 52, 47, 57, 47, 47, 54, 47,
+    0, 0, 0, 6, 6, 6, 0, 0, 71, 2, 5, 0, 71, 2, 5, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair notosans_14_boldLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -4587,6 +4729,11 @@ static const EpdLigaturePair notosans_14_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t notosans_14_boldLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData notosans_14_bold = {
     notosans_14_boldBitmaps,
     notosans_14_boldGlyphs,
@@ -4598,6 +4745,7 @@ static const EpdFontData notosans_14_bold = {
     true,
     notosans_14_boldGroups,
     13,
+    notosans_14_boldGlyphGroups,
     notosans_14_boldKernLeftClasses,
     notosans_14_boldKernRightClasses,
     notosans_14_boldKernMatrix,
@@ -4607,4 +4755,7 @@ static const EpdFontData notosans_14_bold = {
     71,
     notosans_14_boldLigaturePairs,
     5,
+    notosans_14_boldKernLeftDirect,
+    notosans_14_boldKernRightDirect,
+    notosans_14_boldLigatureStartFilter,
 };
@@ -3843,6 +3843,76 @@ static const EpdFontGroup notosans_16_boldGroups[] = {
     { 43392, 125, 248, 1, 1069 },
 };
 
+static const uint8_t notosans_16_boldGlyphGroups[1070] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 10, 11, 11, 11, 11, 11, 11, 11, 12,
+};
+
 static const EpdKernClassEntry notosans_16_boldKernLeftClasses[] = {
     { 0x0022, 1 }, // "
     { 0x0026, 2 }, // &
@@ -4879,6 +4949,78 @@ static const int8_t notosans_16_boldKernMatrix[] = {
        0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t notosans_16_boldKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0, 9, 13, 0, 0, 10,
+    14, 10, 15, 0, 16, 17, 18, 18, 9, 19, 9, 3, 0, 0, 0, 20,
+    0, 21, 22, 0, 0, 22, 23, 0, 21, 0, 0, 0, 0, 21, 21, 22,
+    22, 0, 24, 0, 0, 0, 25, 25, 26, 25, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 30,
+    7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11, 0, 0, 0, 0,
+    10, 0, 10, 10, 10, 10, 10, 0, 10, 17, 17, 17, 17, 19, 14, 0,
+    21, 21, 21, 21, 21, 21, 22, 0, 22, 22, 22, 22, 0, 0, 31, 31,
+    22, 0, 22, 22, 22, 22, 22, 0, 22, 0, 0, 0, 0, 25, 22, 25,
+    7, 21, 7, 21, 32, 21, 9, 0, 9, 0, 9, 0, 9, 0, 10, 33,
+    10, 0, 11, 22, 11, 22, 11, 22, 11, 22, 11, 22, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 21, 0, 0, 0, 34, 0, 31, 0, 0, 35, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 26, 13, 0, 13, 0, 13, 33, 13,
+    0, 13, 0, 0, 21, 0, 21, 0, 0, 21, 0, 21, 10, 22, 10, 22,
+    10, 22, 11, 22, 0, 24, 0, 24, 0, 24, 0, 0, 0, 0, 0, 0,
+    0, 0, 16, 0, 16, 36, 16, 0, 17, 0, 17, 0, 17, 0, 17, 0,
+    17, 0, 17, 0, 18, 25, 19, 25, 19, 9, 0, 9, 0, 9, 0, 0,
+    40, 40, 41, 42, 43, 44, 0, 0, 0, 45, 45, 41, 46, 0, 47, 0,
+    48, 49, 50, 42, 51, 40, 46, 50, 0, 0, 46, 0, 0, 0, 52, 0,
+    53, 43, 42, 47, 54, 46, 51, 0, 0, 51, 45, 0, 45, 52, 52, 0,
+    55, 56, 57, 58, 59, 56, 60, 57, 61, 61, 60, 61, 61, 61, 56, 61,
+    56, 62, 58, 63, 56, 60, 59, 61, 61, 59, 64, 61, 64, 56, 56, 61,
+    56, 56, 65, 58, 62, 66, 0, 67, 40, 64, 64, 68, 60, 61, 63, 61,
+    0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 29, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t notosans_16_boldKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 8,
+    0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0, 0, 10,
+    0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 17, 0, 0, 4, 0, 0,
+    0, 18, 19, 20, 20, 20, 21, 22, 19, 0, 23, 19, 19, 24, 24, 20,
+    24, 20, 24, 25, 21, 24, 26, 26, 26, 26, 27, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 30, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0, 0,
+    20, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 0, 0, 0, 0,
+    0, 0, 20, 20, 20, 20, 20, 0, 20, 24, 24, 24, 24, 26, 19, 26,
+    9, 18, 9, 18, 9, 18, 10, 20, 10, 20, 10, 20, 10, 20, 0, 20,
+    0, 20, 0, 20, 0, 20, 0, 20, 0, 20, 0, 20, 10, 22, 10, 22,
+    10, 22, 10, 22, 0, 19, 0, 31, 0, 32, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 19, 24, 0, 19, 0, 19, 0, 19, 0,
+    19, 0, 0, 0, 24, 0, 24, 0, 0, 0, 0, 24, 10, 20, 10, 20,
+    10, 20, 10, 20, 0, 24, 0, 24, 0, 0, 0, 25, 0, 0, 0, 25,
+    0, 0, 12, 21, 12, 21, 12, 21, 13, 24, 13, 24, 13, 24, 13, 24,
+    13, 24, 13, 24, 14, 26, 16, 26, 16, 17, 27, 17, 27, 17, 27, 0,
+    0, 0, 33, 0, 34, 35, 0, 0, 36, 37, 0, 33, 0, 0, 38, 0,
+    39, 0, 0, 0, 40, 0, 41, 42, 0, 0, 0, 37, 0, 0, 34, 0,
+    0, 34, 33, 38, 43, 41, 0, 44, 0, 0, 33, 0, 0, 42, 0, 45,
+    46, 47, 48, 48, 49, 50, 51, 52, 48, 48, 48, 53, 48, 48, 50, 48,
+    48, 50, 54, 55, 50, 51, 48, 56, 48, 48, 54, 48, 48, 52, 48, 57,
+    50, 50, 58, 48, 50, 48, 0, 59, 60, 53, 48, 58, 48, 48, 55, 48,
+    0, 0, 0, 6, 6, 6, 0, 0, 73, 2, 5, 0, 73, 2, 5, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 29, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair notosans_16_boldLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -4887,6 +5029,11 @@ static const EpdLigaturePair notosans_16_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t notosans_16_boldLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData notosans_16_bold = {
     notosans_16_boldBitmaps,
     notosans_16_boldGlyphs,
@@ -4898,6 +5045,7 @@ static const EpdFontData notosans_16_bold = {
     true,
     notosans_16_boldGroups,
     13,
+    notosans_16_boldGlyphGroups,
     notosans_16_boldKernLeftClasses,
     notosans_16_boldKernRightClasses,
     notosans_16_boldKernMatrix,
@@ -4907,4 +5055,7 @@ static const EpdFontData notosans_16_bold = {
     73,
     notosans_16_boldLigaturePairs,
     5,
+    notosans_16_boldKernLeftDirect,
+    notosans_16_boldKernRightDirect,
+    notosans_16_boldLigatureStartFilter,
 };
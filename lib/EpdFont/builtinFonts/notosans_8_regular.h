@@ -3030,6 +3030,78 @@ static const int8_t notosans_8_regularKernMatrix[] = {
        0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    0,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t notosans_8_regularKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,
+    0, 7, 8, 9, 10, 11, 12, 0, 0, 0, 0, 9, 13, 0, 0, 10,
+    14, 10, 15, 0, 16, 12, 17, 17, 9, 18, 9, 3, 0, 0, 0, 11,
+    0, 19, 20, 0, 0, 20, 21, 0, 19, 0, 0, 0, 0, 19, 19, 20,
+    20, 0, 22, 0, 0, 0, 8, 8, 23, 8, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 26,
+    7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11, 0, 0, 0, 0,
+    10, 0, 10, 10, 10, 10, 10, 0, 10, 12, 12, 12, 12, 18, 14, 0,
+    19, 19, 19, 19, 19, 19, 20, 0, 20, 20, 20, 20, 0, 0, 0, 0,
+    20, 0, 20, 20, 20, 20, 20, 0, 20, 0, 0, 0, 0, 8, 20, 8,
+    7, 19, 7, 19, 27, 19, 9, 0, 9, 0, 9, 0, 9, 0, 10, 28,
+    10, 0, 11, 20, 11, 20, 11, 20, 11, 20, 11, 20, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 19, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 23, 13, 0, 13, 0, 13, 28, 13,
+    0, 13, 0, 0, 19, 0, 19, 0, 0, 19, 0, 19, 10, 20, 10, 20,
+    10, 20, 11, 20, 0, 22, 0, 22, 0, 22, 0, 0, 0, 0, 0, 0,
+    0, 0, 16, 0, 16, 30, 16, 0, 12, 0, 12, 0, 12, 0, 12, 0,
+    12, 0, 12, 0, 17, 8, 18, 8, 18, 9, 0, 9, 0, 9, 0, 0,
+    0, 0, 33, 34, 35, 36, 0, 0, 0, 37, 37, 33, 38, 0, 39, 0,
+    40, 41, 42, 34, 43, 0, 38, 42, 0, 0, 38, 0, 0, 0, 44, 0,
+    45, 35, 34, 39, 46, 38, 43, 0, 0, 43, 37, 0, 37, 44, 44, 0,
+    47, 48, 49, 50, 51, 48, 52, 49, 53, 53, 52, 53, 53, 53, 48, 53,
+    48, 54, 50, 55, 48, 52, 51, 53, 53, 51, 56, 53, 56, 48, 48, 53,
+    48, 48, 57, 50, 54, 58, 0, 0, 0, 56, 56, 59, 52, 53, 55, 53,
+    0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 25, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t notosans_8_regularKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 8,
+    0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0, 0, 10,
+    0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 17, 0, 0, 4, 0, 0,
+    0, 18, 0, 19, 19, 19, 0, 18, 0, 0, 0, 0, 0, 20, 20, 19,
+    20, 19, 20, 20, 0, 20, 21, 21, 21, 21, 22, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 25, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0, 0,
+    19, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 0, 0, 0, 0,
+    0, 0, 19, 19, 19, 19, 19, 0, 19, 20, 20, 20, 20, 21, 0, 21,
+    9, 18, 9, 18, 9, 18, 10, 19, 10, 19, 10, 19, 10, 19, 0, 19,
+    0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 10, 18, 10, 18,
+    10, 18, 10, 18, 0, 0, 0, 26, 0, 27, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 20, 0, 20, 0, 0, 0, 0, 20, 10, 19, 10, 19,
+    10, 19, 10, 19, 0, 20, 0, 20, 0, 0, 0, 20, 0, 0, 0, 20,
+    0, 0, 12, 0, 12, 0, 12, 0, 13, 20, 13, 20, 13, 20, 13, 20,
+    13, 20, 13, 20, 14, 21, 16, 21, 16, 17, 22, 17, 22, 17, 22, 0,
+    0, 0, 28, 0, 29, 30, 0, 0, 31, 32, 0, 28, 0, 0, 33, 0,
+    34, 0, 0, 0, 32, 0, 35, 36, 0, 0, 0, 32, 0, 0, 29, 0,
+    0, 29, 28, 33, 37, 35, 0, 38, 0, 0, 28, 0, 0, 36, 0, 39,
+    40, 41, 42, 42, 43, 44, 45, 46, 42, 42, 42, 47, 42, 42, 44, 42,
+    42, 44, 48, 49, 44, 45, 42, 50, 42, 42, 48, 42, 42, 46, 42, 51,
+    44, 44, 52, 42, 44, 42, 0, 0, 53, 47, 42, 52, 42, 42, 49, 42,
+    0, 0, 0, 6, 6, 6, 0, 0, 66, 2, 5, 0, 66, 2, 5, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair notosans_8_regularLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -3038,6 +3110,11 @@ static const EpdLigaturePair notosans_8_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t notosans_8_regularLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData notosans_8_regular = {
     notosans_8_regularBitmaps,
     notosans_8_regularGlyphs,
@@ -3049,6 +3126,7 @@ static const EpdFontData notosans_8_regular = {
     false,
     nullptr,
     0,
+    nullptr,
     notosans_8_regularKernLeftClasses,
     notosans_8_regularKernRightClasses,
     notosans_8_regularKernMatrix,
@@ -3058,4 +3136,7 @@ static const EpdFontData notosans_8_regular = {
     66,
     notosans_8_regularLigaturePairs,
     5,
+    notosans_8_regularKernLeftDirect,
+    notosans_8_regularKernRightDirect,
+    notosans_8_regularLigatureStartFilter,
 };
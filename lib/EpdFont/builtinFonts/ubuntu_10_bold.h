@@ -3050,6 +3050,78 @@ static const int8_t ubuntu_10_boldKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    0,   -1,    0,   -2,   -1,   -3,   -2,    0,   -3,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,   -1,    0,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t ubuntu_10_boldKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 4, 5, 0, 6, 7, 6, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 18, 19, 20, 21, 22, 18, 14,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 0, 0,
+    0, 37, 38, 39, 40, 0, 41, 42, 43, 44, 45, 46, 47, 43, 43, 38,
+    38, 42, 48, 49, 50, 51, 52, 52, 53, 52, 54, 55, 0, 56, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 59,
+    11, 11, 11, 11, 11, 11, 15, 13, 15, 15, 15, 15, 18, 18, 18, 18,
+    14, 18, 14, 14, 14, 14, 14, 0, 14, 28, 28, 28, 28, 32, 60, 61,
+    37, 37, 37, 37, 37, 37, 0, 39, 0, 0, 0, 0, 44, 44, 44, 44,
+    62, 43, 38, 38, 38, 38, 38, 0, 38, 51, 51, 51, 51, 52, 63, 52,
+    11, 37, 11, 37, 11, 37, 13, 39, 13, 39, 13, 39, 13, 39, 14, 64,
+    14, 40, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 17, 42, 17, 42,
+    17, 42, 17, 42, 18, 43, 18, 43, 18, 44, 18, 44, 18, 44, 18, 44,
+    18, 44, 19, 45, 19, 45, 20, 46, 46, 21, 47, 21, 47, 21, 64, 21,
+    47, 21, 47, 18, 43, 18, 43, 18, 43, 43, 0, 65, 14, 38, 14, 38,
+    14, 38, 15, 0, 25, 48, 25, 48, 25, 48, 26, 49, 26, 49, 26, 49,
+    26, 49, 27, 50, 27, 50, 27, 50, 28, 51, 28, 51, 28, 51, 28, 51,
+    28, 51, 28, 51, 30, 52, 32, 52, 32, 33, 54, 33, 54, 33, 54, 41,
+    70, 70, 71, 72, 73, 74, 18, 18, 75, 76, 76, 77, 78, 18, 79, 18,
+    80, 71, 81, 72, 82, 70, 83, 84, 18, 18, 78, 0, 85, 18, 86, 18,
+    87, 73, 88, 79, 89, 90, 82, 0, 18, 82, 76, 18, 76, 86, 86, 0,
+    91, 92, 91, 93, 94, 95, 96, 97, 0, 0, 98, 99, 100, 99, 101, 99,
+    102, 103, 104, 105, 106, 107, 94, 99, 99, 94, 108, 99, 108, 109, 101, 99,
+    95, 95, 110, 93, 111, 112, 113, 113, 114, 108, 108, 115, 98, 0, 105, 99,
+    0, 0, 0, 7, 7, 0, 0, 0, 133, 134, 135, 0, 133, 134, 135, 0,
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 58, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t ubuntu_10_boldKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 4, 5, 0, 6, 7, 6, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 10,
+    11, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15, 13, 13, 16, 13, 17,
+    13, 17, 13, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0, 0,
+    0, 29, 30, 31, 31, 31, 32, 31, 30, 30, 33, 30, 30, 34, 34, 31,
+    34, 31, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 0, 44, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0,
+    12, 12, 12, 12, 12, 12, 47, 14, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 17, 17, 17, 17, 17, 0, 17, 20, 20, 20, 20, 24, 0, 32,
+    29, 29, 29, 29, 48, 29, 29, 31, 31, 31, 31, 31, 49, 30, 50, 51,
+    52, 34, 31, 31, 31, 31, 31, 0, 31, 37, 37, 37, 37, 41, 0, 41,
+    12, 29, 12, 29, 12, 29, 14, 31, 14, 31, 14, 31, 14, 31, 13, 31,
+    0, 31, 13, 31, 13, 31, 13, 31, 13, 31, 13, 31, 14, 31, 14, 31,
+    14, 31, 14, 31, 13, 30, 13, 30, 13, 53, 13, 53, 13, 53, 13, 30,
+    13, 30, 13, 30, 15, 33, 13, 30, 0, 13, 30, 13, 30, 13, 30, 13,
+    30, 13, 30, 13, 34, 13, 34, 13, 34, 34, 54, 55, 17, 31, 17, 31,
+    17, 31, 17, 31, 13, 34, 13, 34, 13, 34, 18, 35, 18, 35, 18, 35,
+    18, 35, 19, 36, 19, 36, 19, 36, 20, 37, 20, 37, 20, 37, 20, 37,
+    20, 37, 20, 37, 22, 39, 24, 41, 24, 25, 42, 25, 42, 25, 42, 32,
+    0, 0, 60, 0, 61, 62, 0, 0, 63, 64, 0, 60, 0, 0, 65, 0,
+    66, 0, 0, 0, 67, 0, 68, 69, 0, 0, 0, 64, 70, 0, 71, 0,
+    0, 61, 60, 65, 72, 73, 0, 74, 0, 0, 0, 0, 0, 75, 0, 76,
+    77, 78, 79, 79, 80, 81, 82, 83, 79, 79, 79, 84, 85, 79, 86, 79,
+    87, 88, 89, 90, 91, 92, 79, 93, 79, 79, 94, 79, 79, 95, 96, 97,
+    81, 81, 98, 79, 99, 100, 0, 101, 102, 84, 79, 103, 79, 79, 90, 79,
+    0, 0, 0, 7, 7, 0, 0, 0, 116, 117, 118, 0, 116, 117, 118, 0,
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair ubuntu_10_boldLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -3058,6 +3130,11 @@ static const EpdLigaturePair ubuntu_10_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t ubuntu_10_boldLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData ubuntu_10_bold = {
     ubuntu_10_boldBitmaps,
     ubuntu_10_boldGlyphs,
@@ -3069,6 +3146,7 @@ static const EpdFontData ubuntu_10_bold = {
     false,
     nullptr,
     0,
+    nullptr,
     ubuntu_10_boldKernLeftClasses,
     ubuntu_10_boldKernRightClasses,
     ubuntu_10_boldKernMatrix,
@@ -3078,4 +3156,7 @@ static const EpdFontData ubuntu_10_bold = {
     118,
     ubuntu_10_boldLigaturePairs,
     5,
+    ubuntu_10_boldKernLeftDirect,
+    ubuntu_10_boldKernRightDirect,
+    ubuntu_10_boldLigatureStartFilter,
 };
@@ -2720,6 +2720,78 @@ static const int8_t ubuntu_10_regularKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    0,   -1,    0,   -2,   -1,   -2,   -1,    0,   -2,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -2,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -2,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t ubuntu_10_regularKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 3, 4, 0, 5, 6, 5, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0,
+    9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 17, 18, 19, 20, 0, 13,
+    21, 22, 23, 0, 24, 25, 26, 27, 28, 29, 30, 31, 0, 32, 0, 0,
+    0, 33, 34, 35, 0, 0, 36, 0, 37, 0, 0, 38, 0, 37, 37, 39,
+    39, 0, 40, 0, 41, 0, 42, 43, 44, 0, 45, 46, 0, 47, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 51,
+    10, 10, 10, 10, 10, 10, 14, 12, 14, 14, 14, 14, 0, 0, 0, 0,
+    13, 0, 13, 13, 13, 13, 13, 0, 13, 25, 25, 25, 25, 29, 52, 53,
+    33, 33, 33, 33, 33, 33, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0,
+    54, 37, 39, 39, 39, 39, 39, 0, 39, 0, 0, 0, 0, 0, 39, 0,
+    10, 33, 10, 33, 10, 33, 12, 35, 12, 35, 12, 35, 12, 35, 13, 55,
+    13, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 0, 37, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17, 0, 17, 0, 18, 38, 38, 19, 0, 19, 0, 19, 55, 19,
+    0, 19, 0, 0, 37, 0, 37, 0, 37, 37, 56, 57, 13, 39, 13, 39,
+    13, 39, 14, 0, 23, 40, 23, 40, 23, 40, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 41, 24, 41, 24, 41, 25, 0, 25, 0, 25, 0, 25, 0,
+    25, 0, 25, 0, 27, 43, 29, 0, 29, 30, 45, 30, 45, 30, 45, 36,
+    61, 61, 62, 63, 64, 65, 0, 0, 0, 0, 0, 66, 67, 0, 68, 0,
+    69, 62, 70, 63, 71, 61, 0, 72, 0, 0, 67, 0, 73, 0, 74, 0,
+    75, 64, 76, 68, 77, 78, 71, 0, 0, 71, 0, 0, 0, 79, 74, 0,
+    80, 81, 82, 83, 84, 85, 86, 82, 0, 0, 87, 0, 0, 0, 88, 0,
+    89, 90, 91, 92, 93, 94, 95, 0, 0, 95, 96, 0, 96, 97, 97, 0,
+    85, 85, 98, 83, 99, 100, 0, 0, 0, 96, 96, 101, 87, 0, 92, 0,
+    0, 0, 0, 6, 6, 0, 0, 0, 118, 0, 119, 0, 118, 0, 119, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t ubuntu_10_regularKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 2, 3, 4, 5, 0, 6, 7, 6, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 10,
+    11, 12, 0, 13, 0, 0, 0, 13, 0, 0, 14, 0, 0, 15, 0, 16,
+    0, 16, 0, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 0, 0,
+    0, 28, 29, 30, 31, 32, 33, 31, 29, 29, 34, 29, 0, 35, 35, 36,
+    35, 37, 35, 38, 39, 40, 41, 42, 43, 44, 45, 46, 0, 47, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0,
+    12, 12, 12, 12, 12, 12, 50, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 16, 16, 16, 16, 16, 0, 16, 19, 19, 19, 19, 23, 0, 29,
+    28, 28, 28, 28, 28, 28, 28, 30, 32, 32, 32, 32, 51, 29, 51, 52,
+    53, 35, 36, 36, 36, 36, 36, 0, 36, 40, 40, 40, 40, 44, 29, 44,
+    12, 28, 12, 28, 12, 28, 13, 30, 13, 30, 13, 30, 13, 30, 0, 31,
+    0, 31, 0, 32, 0, 32, 0, 32, 0, 32, 0, 32, 13, 31, 13, 31,
+    13, 31, 13, 31, 0, 29, 0, 29, 0, 54, 0, 52, 0, 51, 0, 29,
+    0, 29, 0, 29, 14, 34, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 35, 0, 35, 0, 35, 35, 55, 56, 16, 36, 16, 36,
+    16, 36, 16, 36, 0, 35, 0, 35, 0, 35, 17, 38, 17, 38, 17, 38,
+    17, 38, 18, 39, 18, 39, 18, 39, 19, 40, 19, 40, 19, 40, 19, 40,
+    19, 40, 19, 40, 21, 42, 23, 44, 23, 24, 45, 24, 45, 24, 45, 33,
+    0, 0, 61, 0, 62, 63, 0, 0, 64, 65, 0, 61, 0, 0, 66, 0,
+    67, 0, 0, 0, 68, 0, 69, 70, 0, 0, 0, 65, 71, 0, 72, 0,
+    0, 62, 61, 66, 73, 74, 0, 75, 0, 0, 61, 0, 0, 76, 0, 77,
+    78, 79, 80, 81, 82, 83, 84, 85, 81, 81, 81, 86, 87, 81, 88, 81,
+    89, 83, 90, 91, 92, 93, 81, 94, 81, 95, 96, 81, 81, 97, 80, 98,
+    83, 83, 99, 81, 100, 101, 102, 102, 103, 86, 81, 104, 81, 81, 91, 95,
+    0, 0, 0, 7, 7, 0, 0, 0, 118, 119, 120, 0, 118, 119, 120, 0,
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair ubuntu_10_regularLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -2728,6 +2800,11 @@ static const EpdLigaturePair ubuntu_10_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t ubuntu_10_regularLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData ubuntu_10_regular = {
     ubuntu_10_regularBitmaps,
     ubuntu_10_regularGlyphs,
@@ -2739,6 +2816,7 @@ static const EpdFontData ubuntu_10_regular = {
     false,
     nullptr,
     0,
+    nullptr,
     ubuntu_10_regularKernLeftClasses,
     ubuntu_10_regularKernRightClasses,
     ubuntu_10_regularKernMatrix,
@@ -2748,4 +2826,7 @@ static const EpdFontData ubuntu_10_regular = {
     120,
     ubuntu_10_regularLigaturePairs,
     5,
+    ubuntu_10_regularKernLeftDirect,
+    ubuntu_10_regularKernRightDirect,
+    ubuntu_10_regularLigatureStartFilter,
 };
@@ -3439,6 +3439,78 @@ static const int8_t ubuntu_12_boldKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    0,   -1,    0,   -2,   -1,   -4,   -2,    0,   -3,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -2,   -1,    0,   -2,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t ubuntu_12_boldKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 4, 5, 0, 6, 7, 6, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 18, 19, 20, 21, 22, 18, 14,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 0, 0,
+    0, 37, 38, 39, 40, 0, 41, 42, 43, 44, 45, 46, 47, 43, 43, 38,
+    38, 48, 49, 50, 51, 52, 53, 54, 55, 53, 56, 57, 0, 58, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 61,
+    11, 11, 11, 11, 11, 11, 15, 13, 15, 15, 15, 15, 18, 18, 18, 18,
+    14, 18, 14, 14, 14, 14, 14, 0, 14, 28, 28, 28, 28, 32, 62, 63,
+    37, 37, 37, 37, 37, 37, 0, 39, 0, 0, 0, 0, 44, 44, 44, 44,
+    64, 43, 38, 38, 38, 38, 38, 0, 38, 52, 52, 52, 52, 53, 65, 53,
+    11, 37, 11, 37, 11, 37, 13, 39, 13, 39, 13, 39, 13, 39, 14, 66,
+    14, 40, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 17, 42, 17, 42,
+    17, 42, 17, 42, 18, 43, 18, 43, 18, 44, 18, 44, 18, 44, 18, 44,
+    18, 44, 19, 45, 19, 45, 20, 46, 46, 21, 47, 21, 47, 21, 66, 21,
+    47, 21, 47, 18, 43, 18, 43, 18, 43, 43, 0, 67, 14, 38, 14, 38,
+    14, 38, 15, 0, 25, 49, 25, 49, 25, 49, 26, 50, 26, 50, 26, 50,
+    26, 50, 27, 51, 27, 51, 27, 51, 28, 52, 28, 52, 28, 52, 28, 52,
+    28, 52, 28, 52, 30, 54, 32, 53, 32, 33, 56, 33, 56, 33, 56, 41,
+    72, 72, 73, 74, 75, 76, 18, 18, 77, 78, 78, 79, 80, 18, 81, 18,
+    82, 73, 83, 74, 84, 72, 85, 86, 18, 18, 80, 0, 87, 18, 88, 18,
+    89, 75, 90, 81, 91, 92, 84, 0, 18, 84, 78, 18, 78, 88, 88, 0,
+    93, 94, 93, 95, 96, 97, 98, 99, 0, 0, 100, 101, 102, 101, 103, 101,
+    104, 105, 106, 107, 108, 109, 96, 101, 101, 96, 110, 101, 110, 111, 103, 101,
+    97, 97, 112, 95, 113, 114, 115, 115, 116, 110, 110, 117, 100, 0, 107, 101,
+    0, 0, 0, 7, 7, 0, 0, 0, 136, 137, 138, 0, 136, 137, 138, 0,
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 60, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t ubuntu_12_boldKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 2, 1, 3, 4, 5, 0, 6, 7, 6, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 10,
+    11, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15, 13, 13, 16, 13, 17,
+    13, 17, 13, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0, 0,
+    0, 29, 30, 31, 32, 31, 33, 31, 30, 30, 34, 30, 30, 35, 35, 32,
+    35, 31, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 0, 45, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0,
+    12, 12, 12, 12, 12, 12, 48, 14, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 17, 17, 17, 17, 17, 0, 17, 20, 20, 20, 20, 24, 0, 33,
+    29, 29, 29, 29, 49, 29, 29, 31, 31, 31, 31, 31, 50, 30, 51, 52,
+    53, 35, 32, 32, 32, 32, 32, 0, 32, 38, 38, 38, 38, 42, 0, 42,
+    12, 29, 12, 29, 12, 29, 14, 31, 14, 31, 14, 31, 14, 31, 13, 32,
+    0, 32, 13, 31, 13, 31, 13, 31, 13, 31, 13, 31, 14, 31, 14, 31,
+    14, 31, 14, 31, 13, 30, 13, 30, 13, 54, 13, 55, 13, 55, 13, 30,
+    13, 30, 13, 30, 15, 34, 13, 30, 0, 13, 30, 13, 30, 13, 30, 13,
+    30, 13, 30, 13, 35, 13, 35, 13, 35, 35, 56, 57, 17, 32, 17, 32,
+    17, 32, 17, 32, 13, 35, 13, 35, 13, 35, 18, 36, 18, 36, 18, 36,
+    18, 36, 19, 37, 19, 37, 19, 37, 20, 38, 20, 38, 20, 38, 20, 38,
+    20, 38, 20, 38, 22, 40, 24, 42, 24, 25, 43, 25, 43, 25, 43, 33,
+    0, 0, 62, 0, 63, 64, 0, 0, 65, 66, 0, 62, 0, 0, 67, 0,
+    68, 0, 0, 0, 69, 0, 70, 71, 0, 0, 0, 66, 72, 0, 73, 0,
+    0, 63, 62, 67, 74, 75, 0, 76, 0, 0, 0, 0, 0, 77, 0, 78,
+    79, 80, 81, 81, 82, 83, 84, 85, 81, 81, 81, 86, 87, 81, 88, 81,
+    89, 83, 90, 91, 92, 93, 81, 94, 81, 81, 95, 81, 81, 96, 97, 98,
+    83, 83, 99, 81, 100, 101, 0, 102, 103, 86, 81, 104, 81, 81, 91, 81,
+    0, 0, 0, 7, 7, 0, 0, 0, 117, 118, 119, 0, 117, 118, 119, 0,
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 47, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair ubuntu_12_boldLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -3447,6 +3519,11 @@ static const EpdLigaturePair ubuntu_12_boldLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t ubuntu_12_boldLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData ubuntu_12_bold = {
     ubuntu_12_boldBitmaps,
     ubuntu_12_boldGlyphs,
@@ -3458,6 +3535,7 @@ static const EpdFontData ubuntu_12_bold = {
     false,
     nullptr,
     0,
+    nullptr,
     ubuntu_12_boldKernLeftClasses,
     ubuntu_12_boldKernRightClasses,
     ubuntu_12_boldKernMatrix,
@@ -3467,4 +3545,7 @@ static const EpdFontData ubuntu_12_bold = {
     119,
     ubuntu_12_boldLigaturePairs,
     5,
+    ubuntu_12_boldKernLeftDirect,
+    ubuntu_12_boldKernRightDirect,
+    ubuntu_12_boldLigatureStartFilter,
 };
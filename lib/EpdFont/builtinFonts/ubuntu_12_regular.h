@@ -3083,6 +3083,78 @@ static const int8_t ubuntu_12_regularKernMatrix[] = {
        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,    0,    0,   -1,    0,   -2,   -1,   -2,   -1,    0,   -2,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -2,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -1,   -1,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   -2,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 };
 
+static const uint8_t ubuntu_12_regularKernLeftDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 2, 3, 4, 0, 5, 6, 5, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0,
+    9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 17, 18, 19, 20, 0, 21,
+    22, 23, 24, 0, 25, 26, 27, 28, 29, 30, 31, 32, 0, 33, 0, 0,
+    0, 34, 35, 36, 0, 0, 37, 0, 38, 0, 0, 39, 0, 38, 38, 40,
+    40, 0, 41, 0, 42, 0, 43, 44, 45, 0, 46, 47, 0, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 52,
+    10, 10, 10, 10, 10, 10, 14, 12, 14, 14, 14, 14, 0, 0, 0, 0,
+    13, 0, 21, 21, 21, 21, 21, 0, 21, 26, 26, 26, 26, 30, 53, 54,
+    34, 34, 34, 34, 34, 34, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0,
+    55, 38, 40, 40, 40, 40, 40, 0, 40, 0, 0, 0, 0, 0, 40, 0,
+    10, 34, 10, 34, 10, 34, 12, 36, 12, 36, 12, 36, 12, 36, 13, 56,
+    13, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 0, 38, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17, 0, 17, 0, 18, 39, 39, 19, 0, 19, 0, 19, 56, 19,
+    0, 19, 0, 0, 38, 0, 38, 0, 38, 38, 57, 58, 21, 40, 21, 40,
+    21, 40, 14, 0, 24, 41, 24, 41, 24, 41, 0, 0, 0, 0, 0, 0,
+    0, 0, 25, 42, 25, 42, 25, 42, 26, 0, 26, 0, 26, 0, 26, 0,
+    26, 0, 26, 0, 28, 44, 30, 0, 30, 31, 46, 31, 46, 31, 46, 37,
+    62, 62, 63, 64, 65, 66, 0, 0, 0, 0, 0, 67, 68, 0, 69, 0,
+    70, 63, 71, 64, 72, 62, 0, 73, 0, 0, 68, 0, 74, 0, 75, 0,
+    76, 65, 77, 69, 78, 79, 72, 0, 0, 72, 0, 0, 0, 80, 75, 0,
+    81, 82, 83, 84, 85, 86, 87, 83, 0, 0, 88, 0, 0, 0, 89, 0,
+    90, 91, 92, 93, 94, 95, 96, 0, 0, 96, 97, 0, 97, 98, 98, 0,
+    86, 86, 99, 84, 100, 101, 0, 0, 0, 97, 97, 102, 88, 0, 93, 0,
+    0, 0, 0, 6, 6, 0, 0, 0, 120, 0, 121, 0, 120, 0, 121, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 51, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t ubuntu_12_regularKernRightDirect[528] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 0, 0, 0, 0, 2, 3, 4, 5, 0, 6, 7, 6, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 10,
+    11, 12, 0, 13, 0, 0, 0, 13, 0, 0, 14, 0, 0, 15, 0, 16,
+    0, 16, 0, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 0, 0,
+    0, 28, 29, 30, 31, 32, 33, 31, 29, 29, 34, 29, 0, 35, 35, 36,
+    35, 37, 35, 38, 39, 40, 41, 42, 43, 44, 45, 46, 0, 47, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0,
+    12, 12, 12, 12, 12, 12, 50, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 16, 16, 16, 16, 16, 0, 16, 19, 19, 19, 19, 23, 0, 29,
+    28, 28, 28, 28, 28, 28, 28, 30, 32, 32, 32, 32, 51, 29, 52, 53,
+    54, 35, 36, 36, 36, 36, 36, 0, 36, 40, 40, 40, 40, 44, 29, 44,
+    12, 28, 12, 28, 12, 28, 13, 30, 13, 30, 13, 30, 13, 30, 0, 31,
+    0, 31, 0, 32, 0, 32, 0, 32, 0, 32, 0, 32, 13, 31, 13, 31,
+    13, 31, 13, 31, 0, 29, 0, 29, 0, 55, 0, 52, 0, 56, 0, 29,
+    0, 29, 0, 29, 14, 34, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 35, 0, 35, 0, 35, 35, 57, 58, 16, 36, 16, 36,
+    16, 36, 16, 36, 0, 35, 0, 35, 0, 35, 17, 38, 17, 38, 17, 38,
+    17, 38, 18, 39, 18, 39, 18, 39, 19, 40, 19, 40, 19, 40, 19, 40,
+    19, 40, 19, 40, 21, 42, 23, 44, 23, 24, 45, 24, 45, 24, 45, 33,
+    0, 0, 63, 0, 64, 65, 0, 0, 66, 67, 0, 63, 0, 0, 68, 0,
+    69, 0, 0, 0, 70, 0, 71, 72, 0, 0, 0, 67, 73, 0, 74, 0,
+    0, 64, 63, 68, 75, 76, 0, 77, 0, 0, 63, 0, 0, 78, 0, 79,
+    80, 81, 82, 82, 83, 84, 85, 86, 82, 82, 82, 87, 88, 82, 89, 82,
+    90, 84, 91, 92, 93, 94, 82, 95, 82, 96, 97, 82, 82, 98, 82, 99,
+    84, 84, 100, 82, 101, 102, 103, 104, 105, 87, 82, 106, 82, 82, 92, 96,
+    0, 0, 0, 7, 7, 0, 0, 0, 121, 122, 123, 0, 121, 122, 123, 0,
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0,
+};
+
 static const EpdLigaturePair ubuntu_12_regularLigaturePairs[] = {
     { 0x00660066, 0xFB00 }, // f f -> U+FB00
     { 0x00660069, 0xFB01 }, // f i -> U+FB01
@@ -3091,6 +3163,11 @@ static const EpdLigaturePair ubuntu_12_regularLigaturePairs[] = {
     { 0xFB00006C, 0xFB04 }, // U+FB00 l -> U+FB04
 };
 
+static const uint8_t ubuntu_12_regularLigatureStartFilter[32] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
 static const EpdFontData ubuntu_12_regular = {
     ubuntu_12_regularBitmaps,
     ubuntu_12_regularGlyphs,
@@ -3102,6 +3179,7 @@ static const EpdFontData ubuntu_12_regular = {
     false,
     nullptr,
     0,
+    nullptr,
     ubuntu_12_regularKernLeftClasses,
     ubuntu_12_regularKernRightClasses,
     ubuntu_12_regularKernMatrix,
@@ -3111,4 +3189,7 @@ static const EpdFontData ubuntu_12_regular = {
     123,
     ubuntu_12_regularLigaturePairs,
     5,
+    ubuntu_12_regularKernLeftDirect,
+    ubuntu_12_regularKernRightDirect,
+    ubuntu_12_regularLigatureStartFilter,
 };
@@ -490,6 +490,15 @@ if kern_map:
     print(f"kerning: {kern_left_class_count} left classes, {kern_right_class_count} right classes, "
           f"{matrix_size + entries_size} bytes", file=sys.stderr)
 
+# Codepoint ranges of the direct-indexed class maps, concatenated (EPD_KERN_DIRECT_RANGES in EpdFontData.h):
+# Basic Latin through Latin Extended-A, basic Cyrillic, and the General Punctuation dashes and quotes.
+KERN_DIRECT_RANGES = [(0x0000, 0x017F), (0x0400, 0x045F), (0x2010, 0x203F)]
+
+def kern_direct_map(classes):
+    """Expand a sorted (codepoint, classId) list into a class per codepoint of KERN_DIRECT_RANGES."""
+    class_of = dict(classes)
+    return [class_of.get(cp, 0) for start, end in KERN_DIRECT_RANGES for cp in range(start, end + 1)]
+
 # --- Ligature pair extraction ---
 # Parse the OpenType GSUB table for LigatureSubst (type 4) lookups.
 # Multi-character ligatures (3+ codepoints) are decomposed into chained
@@ -709,6 +718,11 @@ if compress:
     if group_count > 0:
         groups.append((group_start, group_count))
 
+    # The glyph -> group table stores group indices as uint8_t
+    if len(groups) > 256:
+        print(f"ERROR: {len(groups)} compression groups exceed the uint8_t glyph group table", file=sys.stderr)
+        sys.exit(1)
+
     # Compress each group
     compressed_groups = []  # list of (compressed_bytes, uncompressed_size, glyph_count, first_glyph_index)
     compressed_bitmap_data = []
@@ -797,6 +811,16 @@ if compress:
         compressed_offset += len(compressed)
     print("};\n")
 
+    # Glyph index -> group index, so the decompressor can find a glyph's group without searching
+    glyph_groups = [0] * len(glyph_props)
+    for group_index, (_compressed, _uncompressed_size, count, first_idx) in enumerate(compressed_groups):
+        for gi in range(first_idx, first_idx + count):
+            glyph_groups[gi] = group_index
+    print(f"static const uint8_t {font_name}GlyphGroups[{len(glyph_groups)}] = {{")
+    for c in chunks(glyph_groups, 16):
+        print("    " + " ".join(f"{g}," for g in c))
+    print("};\n")
+
 if kern_map:
     print(f"static const EpdKernClassEntry {font_name}KernLeftClasses[] = {{")
     for cp, cls in kern_left_classes:
@@ -815,12 +839,32 @@ if kern_map:
         print("    " + ", ".join(f"{v:4d}" for v in row_vals) + ",")
     print("};\n")
 
+    # Direct-indexed copies of the class maps for the common scripts, so most lookups are a single load.
+    # Must match EPD_KERN_DIRECT_RANGES in EpdFontData.h.
+    for side, classes in (("Left", kern_left_classes), ("Right", kern_right_classes)):
+        direct = kern_direct_map(classes)
+        print(f"static const uint8_t {font_name}Kern{side}Direct[{len(direct)}] = {{")
+        for c in chunks(direct, 16):
+            print("    " + " ".join(f"{v}," for v in c))
+        print("};\n")
+
 if ligature_pairs:
     print(f"static const EpdLigaturePair {font_name}LigaturePairs[] = {{")
     for packed_pair, lig_cp in ligature_pairs:
         print(f"    {{ 0x{packed_pair:08X}, 0x{lig_cp:04X} }}, // {cp_label(packed_pair >> 16)} {cp_label(packed_pair & 0xFFFF)} -> {cp_label(lig_cp)}")
     print("};\n")
 
+    # One bit per low byte of the pairs' left codepoints: lets the renderer skip the pair search for most text.
+    # Must match EPD_LIGATURE_FILTER_BYTES in EpdFontData.h.
+    ligature_filter = [0] * 32
+    for packed_pair, _lig_cp in ligature_pairs:
+        low = (packed_pair >> 16) & 0xFF
+        ligature_filter[low >> 3] |= 1 << (low & 7)
+    print(f"static const uint8_t {font_name}LigatureStartFilter[{len(ligature_filter)}] = {{")
+    for c in chunks(ligature_filter, 16):
+        print("    " + " ".join(f"0x{b:02X}," for b in c))
+    print("};\n")
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -833,9 +877,11 @@ print(f"    {'true' if is2Bit else 'false'},")
 if compress:
     print(f"    {font_name}Groups,")
     print(f"    {len(compressed_groups)},")
+    print(f"    {font_name}GlyphGroups,")
 else:
     print(f"    nullptr,")
     print(f"    0,")
+    print(f"    nullptr,")
 if kern_map:
     print(f"    {font_name}KernLeftClasses,")
     print(f"    {font_name}KernRightClasses,")
@@ -858,4 +904,14 @@ if ligature_pairs:
 else:
     print(f"    nullptr,")
     print(f"    0,")
+if kern_map:
+    print(f"    {font_name}KernLeftDirect,")
+    print(f"    {font_name}KernRightDirect,")
+else:
+    print(f"    nullptr,")
+    print(f"    nullptr,")
+if ligature_pairs:
+    print(f"    {font_name}LigatureStartFilter,")
+else:
+    print(f"    nullptr,")
 print("};")
@@ -4,7 +4,8 @@ Round-trip verification for compressed font headers.
 
 Parses each generated .h file in the given directory, identifies compressed fonts
 (those with a Groups array), decompresses each group, and verifies that
-decompression succeeds and all glyph offsets/lengths fall within bounds.
+decompression succeeds, all glyph offsets/lengths fall within bounds and the
+glyph -> group table agrees with the groups.
 """
 import os
 import re
@@ -92,6 +93,18 @@ def verify_font_file(filepath):
 
     glyphs = parse_glyphs(glyphs_match.group(1))
 
+    # Extract glyph -> group table
+    glyph_groups_match = re.search(
+        r'static const uint8_t ' + re.escape(font_name) + r'GlyphGroups\[\d+\]\s*=\s*\{([^}]+)\}',
+        content, re.DOTALL
+    )
+    if not glyph_groups_match:
+        return (font_name, False, "could not find GlyphGroups array")
+
+    glyph_groups = [int(v) for v in re.findall(r'\d+', glyph_groups_match.group(1))]
+    if len(glyph_groups) != len(glyphs):
+        return (font_name, False, f"GlyphGroups has {len(glyph_groups)} entries, expected {len(glyphs)}")
+
     # Verify each group
     for gi, group in enumerate(groups):
         # Extract compressed chunk
@@ -115,6 +128,10 @@ def verify_font_file(filepath):
             if glyph_idx >= len(glyphs):
                 return (font_name, False, f"group {gi}: glyph index {glyph_idx} out of range")
 
+            if glyph_groups[glyph_idx] != gi:
+                return (font_name, False, f"glyph {glyph_idx}: GlyphGroups says group {glyph_groups[glyph_idx]}, "
+                        f"expected {gi}")
+
             glyph = glyphs[glyph_idx]
             offset = glyph['dataOffset']
             length = glyph['dataLength']
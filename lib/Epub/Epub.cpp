@@ -344,6 +344,8 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
 
   // Try to load existing cache first
   if (bookMetadataCache->load()) {
+    // Caches written before the zip index existed get one now
+    buildZipIndexIfMissing();
     if (!skipLoadingCss) {
       // Rebuild CSS cache when missing or when cache version changed (loadFromCache removes stale file)
       if (!cssParser->hasCache() || !cssParser->loadFromCache()) {
@@ -374,6 +376,9 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
 
   const uint32_t indexingStart = millis();
 
+  // Index the central directory first so every item read below can use it
+  buildZipIndexIfMissing();
+
   // Begin building cache - stream entries to disk immediately
   if (!bookMetadataCache->beginWrite()) {
     LOG_ERR("EBP", "Could not begin writing cache");
@@ -488,6 +493,22 @@ void Epub::setupCacheDir() const {
   Storage.mkdir(cachePath.c_str());
 }
 
+std::string Epub::getZipIndexPath() const { return cachePath + "/zip.idx"; }
+
+void Epub::buildZipIndexIfMissing() const {
+  const std::string indexPath = getZipIndexPath();
+  if (Storage.exists(indexPath.c_str())) {
+    return;
+  }
+
+  const uint32_t start = millis();
+  if (!ZipFile(filepath, indexPath).buildIndex()) {
+    LOG_ERR("EBP", "Could not build zip index, item lookups will scan the central directory");
+    return;
+  }
+  LOG_DBG("EBP", "Zip index built in %lu ms", millis() - start);
+}
+
 const std::string& Epub::getCachePath() const { return cachePath; }
 
 const std::string& Epub::getPath() const { return filepath; }
@@ -719,7 +740,7 @@ uint8_t* Epub::readItemContentsToBytes(const std::string& itemHref, size_t* size
 
   const std::string path = FsHelpers::normalisePath(itemHref);
 
-  const auto content = ZipFile(filepath).readFileToMemory(path.c_str(), size, trailingNullByte);
+  const auto content = ZipFile(filepath, getZipIndexPath()).readFileToMemory(path.c_str(), size, trailingNullByte);
   if (!content) {
     LOG_DBG("EBP", "Failed to read item %s", path.c_str());
     return nullptr;
@@ -735,12 +756,28 @@ bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, con
   }
 
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize);
+  return ZipFile(filepath, getZipIndexPath()).readFileToStream(path.c_str(), out, chunkSize);
+}
+
+std::unique_ptr<ZipFile> Epub::openItemStream(const std::string& itemHref, const size_t chunkSize,
+                                              size_t* size) const {
+  if (itemHref.empty()) {
+    LOG_DBG("EBP", "Failed to open item stream, empty href");
+    return nullptr;
+  }
+
+  const std::string path = FsHelpers::normalisePath(itemHref);
+  auto zip = std::unique_ptr<ZipFile>(new ZipFile(filepath, getZipIndexPath()));
+  if (!zip->beginEntryStream(path.c_str(), chunkSize, size)) {
+    LOG_DBG("EBP", "Failed to open item stream %s", path.c_str());
+    return nullptr;
+  }
+  return zip;
 }
 
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).getInflatedFileSize(path.c_str(), size);
+  return ZipFile(filepath, getZipIndexPath()).getInflatedFileSize(path.c_str(), size);
 }
 
 int Epub::getSpineItemsCount() const {
@@ -750,7 +787,36 @@ int Epub::getSpineItemsCount() const {
   return bookMetadataCache->getSpineCount();
 }
 
-size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const { return getSpineItem(spineIndex).cumulativeSize; }
+bool Epub::loadResidentTables() const {
+  // A few KB for typical books; the cap keeps huge spines on the SD path, the reserve keeps room for layout
+  constexpr size_t MAX_RESIDENT_TABLES_BYTES = 48 * 1024;       // 48KB
+  constexpr size_t MIN_HEAP_AFTER_RESIDENT_TABLES = 64 * 1024;  // 64KB
+
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    return false;
+  }
+  const uint32_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap <= MIN_HEAP_AFTER_RESIDENT_TABLES) {
+    LOG_DBG("EBP", "Not enough heap to keep the spine resident (%u free)", freeHeap);
+    return false;
+  }
+  return bookMetadataCache->loadResident(
+      std::min<size_t>(MAX_RESIDENT_TABLES_BYTES, freeHeap - MIN_HEAP_AFTER_RESIDENT_TABLES));
+}
+
+size_t Epub::getCumulativeSpineItemSize(const int spineIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    LOG_ERR("EBP", "getCumulativeSpineItemSize called but cache not loaded");
+    return 0;
+  }
+
+  if (spineIndex < 0 || spineIndex >= bookMetadataCache->getSpineCount()) {
+    LOG_ERR("EBP", "getCumulativeSpineItemSize index:%d is out of range", spineIndex);
+    return bookMetadataCache->getSpineCumulativeSize(0);
+  }
+
+  return bookMetadataCache->getSpineCumulativeSize(spineIndex);
+}
 
 BookMetadataCache::SpineEntry Epub::getSpineItem(const int spineIndex) const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
@@ -800,7 +866,7 @@ int Epub::getSpineIndexForTocIndex(const int tocIndex) const {
     return 0;
   }
 
-  const int spineIndex = bookMetadataCache->getTocEntry(tocIndex).spineIndex;
+  const int spineIndex = bookMetadataCache->getTocSpineIndex(tocIndex);
   if (spineIndex < 0) {
     LOG_DBG("EBP", "Section not found for TOC index %d", tocIndex);
     return 0;
@@ -809,7 +875,19 @@ int Epub::getSpineIndexForTocIndex(const int tocIndex) const {
   return spineIndex;
 }
 
-int Epub::getTocIndexForSpineIndex(const int spineIndex) const { return getSpineItem(spineIndex).tocIndex; }
+int Epub::getTocIndexForSpineIndex(const int spineIndex) const {
+  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
+    LOG_ERR("EBP", "getTocIndexForSpineIndex called but cache not loaded");
+    return -1;
+  }
+
+  if (spineIndex < 0 || spineIndex >= bookMetadataCache->getSpineCount()) {
+    LOG_ERR("EBP", "getTocIndexForSpineIndex index:%d is out of range", spineIndex);
+    return bookMetadataCache->getSpineTocIndex(0);
+  }
+
+  return bookMetadataCache->getSpineTocIndex(spineIndex);
+}
 
 size_t Epub::getBookSize() const {
   if (!bookMetadataCache || !bookMetadataCache->isLoaded() || bookMetadataCache->getSpineCount() == 0) {
@@ -833,13 +911,11 @@ int Epub::getSpineIndexForTextReference() const {
     return 0;
   }
 
-  // loop through spine items to get the correct index matching the text href
-  for (size_t i = 0; i < getSpineItemsCount(); i++) {
-    if (getSpineItem(i).href == bookMetadataCache->coreMetadata.textReferenceHref) {
-      LOG_DBG("EBP", "Text reference %s found at index %d", bookMetadataCache->coreMetadata.textReferenceHref.c_str(),
-              i);
-      return i;
-    }
+  const int spineIndex = bookMetadataCache->findSpineIndex(bookMetadataCache->coreMetadata.textReferenceHref, false);
+  if (spineIndex >= 0) {
+    LOG_DBG("EBP", "Text reference %s found at index %d", bookMetadataCache->coreMetadata.textReferenceHref.c_str(),
+            spineIndex);
+    return spineIndex;
   }
   // This should not happen, as we checked for empty textReferenceHref earlier
   LOG_DBG("EBP", "Section not found for text reference");
@@ -870,18 +946,6 @@ int Epub::resolveHrefToSpineIndex(const std::string& href) const {
   // Same-file reference (anchor-only)
   if (target.empty()) return -1;
 
-  // Extract just the filename for comparison
-  size_t targetSlash = target.find_last_of('/');
-  std::string targetFilename = (targetSlash != std::string::npos) ? target.substr(targetSlash + 1) : target;
-
-  for (int i = 0; i < getSpineItemsCount(); i++) {
-    const auto& spineHref = getSpineItem(i).href;
-    // Try exact match first
-    if (spineHref == target) return i;
-    // Then filename-only match
-    size_t spineSlash = spineHref.find_last_of('/');
-    std::string spineFilename = (spineSlash != std::string::npos) ? spineHref.substr(spineSlash + 1) : spineHref;
-    if (spineFilename == targetFilename) return i;
-  }
-  return -1;
+  // First spine item with the same file name (an exact href match has it too)
+  return bookMetadataCache->findSpineIndex(target, true);
 }
@@ -35,6 +35,9 @@ class Epub {
   bool parseTocNcxFile() const;
   bool parseTocNavFile() const;
   void parseCssFiles() const;
+  // Sorted central directory index shared by every ZipFile opened on this book (see ZipFile::buildIndex)
+  std::string getZipIndexPath() const;
+  void buildZipIndexIfMissing() const;
 
  public:
   explicit Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
@@ -44,6 +47,8 @@ class Epub {
   ~Epub() = default;
   std::string& getBasePath() { return contentBasePath; }
   bool load(bool buildIfMissing = true, bool skipLoadingCss = false);
+  // Keeps the spine and TOC tables in RAM when the heap allows, for lookups without SD reads while reading
+  bool loadResidentTables() const;
   bool clearCache() const;
   void setupCacheDir() const;
   const std::string& getCachePath() const;
@@ -59,6 +64,8 @@ class Epub {
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
+  // Open an item for pull-based reading (see ZipFile::beginEntryStream). Returns nullptr on failure.
+  std::unique_ptr<ZipFile> openItemStream(const std::string& itemHref, size_t chunkSize, size_t* size = nullptr) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
@@ -4,6 +4,8 @@
 #include <Serialization.h>
 #include <ZipFile.h>
 
+#include <cstring>
+#include <new>
 #include <vector>
 
 #include "FsHelpers.h"
@@ -390,6 +392,152 @@ bool BookMetadataCache::load() {
   return true;
 }
 
+bool BookMetadataCache::loadResident(const size_t budgetBytes) {
+  if (!loaded) {
+    LOG_ERR("BMC", "loadResident called but cache not loaded");
+    return false;
+  }
+  if (isSpineResident()) {
+    return true;
+  }
+
+  // The spine and TOC records follow the two LUTs back to back, in index order (see buildBookBin). A first pass reads
+  // only the string lengths, so the pool is allocated once at its final size.
+  const uint32_t entriesStart = lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * tocCount;
+  const size_t fileSize = bookFile.size();
+  size_t spinePoolSize = 0;
+  size_t tocPoolSize = 0;
+  size_t maxTocHrefLength = 0;
+  bookFile.seek(entriesStart);
+  for (int i = 0; i < spineCount; i++) {
+    uint32_t hrefLength;
+    serialization::readPod(bookFile, hrefLength);
+    if (hrefLength > fileSize) return false;
+    spinePoolSize += hrefLength;
+    bookFile.seekCur(hrefLength + sizeof(SpineEntry::cumulativeSize) + sizeof(SpineEntry::tocIndex));
+  }
+  for (int i = 0; i < tocCount; i++) {
+    uint32_t titleLength, hrefLength, anchorLength;
+    int16_t spineIndex;
+    serialization::readPod(bookFile, titleLength);
+    bookFile.seekCur(titleLength);
+    serialization::readPod(bookFile, hrefLength);
+    bookFile.seekCur(hrefLength);
+    serialization::readPod(bookFile, anchorLength);
+    bookFile.seekCur(anchorLength + sizeof(TocEntry::level));
+    serialization::readPod(bookFile, spineIndex);
+    if (titleLength > fileSize || hrefLength > fileSize || anchorLength > fileSize) return false;
+    // An href that resolved to a spine item is the same string as that item's href
+    tocPoolSize += titleLength + anchorLength + (spineIndex >= 0 && spineIndex < spineCount ? 0 : hrefLength);
+    maxTocHrefLength = std::max<size_t>(maxTocHrefLength, hrefLength);
+  }
+
+  const size_t spineBytes = spineCount * (sizeof(ResidentSpineEntry) + 2 * sizeof(uint16_t)) + spinePoolSize;
+  // Each TOC href is read into the pool before its spine index is known, so the pool has room for one more
+  const size_t tocBytes = tocCount * sizeof(ResidentTocEntry) + tocPoolSize + maxTocHrefLength;
+  if (spineBytes > budgetBytes || spinePoolSize > UINT16_MAX) {
+    LOG_DBG("BMC", "Spine needs %zu bytes, over the resident budget of %zu", spineBytes, budgetBytes);
+    return false;
+  }
+  const bool withToc =
+      spineBytes + tocBytes <= budgetBytes && spinePoolSize + tocPoolSize + maxTocHrefLength <= UINT16_MAX;
+  const size_t poolSize = spinePoolSize + (withToc ? tocPoolSize + maxTocHrefLength : 0);
+
+  residentPool.reset(new (std::nothrow) char[poolSize > 0 ? poolSize : 1]);
+  if (!residentPool) {
+    LOG_ERR("BMC", "Could not allocate %zu bytes for the resident spine", poolSize);
+    return false;
+  }
+  char* pool = residentPool.get();
+  uint16_t poolUsed = 0;
+  const auto readIntoPool = [&](uint16_t& offset, uint16_t& length) {
+    uint32_t stringLength;
+    serialization::readPod(bookFile, stringLength);
+    offset = poolUsed;
+    length = static_cast<uint16_t>(stringLength);
+    bookFile.read(pool + poolUsed, stringLength);
+    poolUsed += length;
+  };
+
+  residentSpine.resize(spineCount);
+  bookFile.seek(entriesStart);
+  for (auto& entry : residentSpine) {
+    SpineEntry fields;
+    readIntoPool(entry.hrefOffset, entry.hrefLength);
+    serialization::readPod(bookFile, fields.cumulativeSize);
+    serialization::readPod(bookFile, fields.tocIndex);
+    entry.cumulativeSize = static_cast<uint32_t>(fields.cumulativeSize);
+    entry.tocIndex = fields.tocIndex;
+
+    const char* href = pool + entry.hrefOffset;
+    size_t nameStart = entry.hrefLength;
+    while (nameStart > 0 && href[nameStart - 1] != '/') nameStart--;
+    entry.hrefHash = fnvHash32(href, entry.hrefLength);
+    entry.fileNameHash = fnvHash32(href + nameStart, entry.hrefLength - nameStart);
+  }
+
+  spineByHref.resize(spineCount);
+  for (int i = 0; i < spineCount; i++) {
+    spineByHref[i] = static_cast<uint16_t>(i);
+  }
+  spineByFileName = spineByHref;
+  std::sort(spineByHref.begin(), spineByHref.end(), [this](const uint16_t a, const uint16_t b) {
+    return residentSpine[a].hrefHash < residentSpine[b].hrefHash ||
+           (residentSpine[a].hrefHash == residentSpine[b].hrefHash && a < b);
+  });
+  std::sort(spineByFileName.begin(), spineByFileName.end(), [this](const uint16_t a, const uint16_t b) {
+    return residentSpine[a].fileNameHash < residentSpine[b].fileNameHash ||
+           (residentSpine[a].fileNameHash == residentSpine[b].fileNameHash && a < b);
+  });
+
+  if (withToc) {
+    residentToc.resize(tocCount);
+    for (auto& entry : residentToc) {
+      readIntoPool(entry.titleOffset, entry.titleLength);
+      readIntoPool(entry.hrefOffset, entry.hrefLength);
+      readIntoPool(entry.anchorOffset, entry.anchorLength);
+      serialization::readPod(bookFile, entry.level);
+      serialization::readPod(bookFile, entry.spineIndex);
+      if (entry.spineIndex >= 0 && entry.spineIndex < spineCount) {
+        // Drop the copy just read (it sits last in the pool, after the anchor) and share the spine item's href
+        const uint16_t hrefBytes = entry.hrefLength;
+        memmove(pool + entry.hrefOffset, pool + entry.anchorOffset, entry.anchorLength);
+        entry.anchorOffset = entry.hrefOffset;
+        poolUsed -= hrefBytes;
+        entry.hrefOffset = residentSpine[entry.spineIndex].hrefOffset;
+      }
+    }
+    // Every lookup is now served from RAM
+    bookFile.close();
+  }
+
+  LOG_DBG("BMC", "Resident spine%s: %zu bytes", withToc ? " and TOC" : "", spineBytes + (withToc ? tocBytes : 0));
+  return true;
+}
+
+int BookMetadataCache::findResidentSpine(const std::vector<uint16_t>& order, const bool byFileName,
+                                         const uint32_t hash, const char* text, const size_t length) const {
+  const auto hashOf = [this, byFileName](const uint16_t index) {
+    return byFileName ? residentSpine[index].fileNameHash : residentSpine[index].hrefHash;
+  };
+  auto it = std::lower_bound(order.begin(), order.end(), hash,
+                             [&hashOf](const uint16_t index, const uint32_t value) { return hashOf(index) < value; });
+  // Entries with the same hash are in index order, so the first one that really matches is the first in the spine
+  for (; it != order.end() && hashOf(*it) == hash; ++it) {
+    const ResidentSpineEntry& entry = residentSpine[*it];
+    const char* href = residentPool.get() + entry.hrefOffset;
+    size_t start = 0;
+    if (byFileName) {
+      start = entry.hrefLength;
+      while (start > 0 && href[start - 1] != '/') start--;
+    }
+    if (entry.hrefLength - start == length && memcmp(href + start, text, length) == 0) {
+      return *it;
+    }
+  }
+  return -1;
+}
+
 BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index) {
   if (!loaded) {
     LOG_ERR("BMC", "getSpineEntry called but cache not loaded");
@@ -401,6 +549,11 @@ BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index)
     return {};
   }
 
+  if (isSpineResident()) {
+    const ResidentSpineEntry& entry = residentSpine[index];
+    return SpineEntry(residentString(entry.hrefOffset, entry.hrefLength), entry.cumulativeSize, entry.tocIndex);
+  }
+
   // Seek to spine LUT item, read from LUT and get out data
   bookFile.seek(lutOffset + sizeof(uint32_t) * index);
   uint32_t spineEntryPos;
@@ -420,6 +573,13 @@ BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
     return {};
   }
 
+  if (isTocResident()) {
+    const ResidentTocEntry& entry = residentToc[index];
+    return TocEntry(residentString(entry.titleOffset, entry.titleLength),
+                    residentString(entry.hrefOffset, entry.hrefLength),
+                    residentString(entry.anchorOffset, entry.anchorLength), entry.level, entry.spineIndex);
+  }
+
   // Seek to TOC LUT item, read from LUT and get out data
   bookFile.seek(lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * index);
   uint32_t tocEntryPos;
@@ -428,6 +588,55 @@ BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
   return readTocEntry(bookFile);
 }
 
+uint32_t BookMetadataCache::getSpineCumulativeSize(const int index) {
+  if (isSpineResident() && index >= 0 && index < static_cast<int>(spineCount)) {
+    return residentSpine[index].cumulativeSize;
+  }
+  return getSpineEntry(index).cumulativeSize;
+}
+
+int16_t BookMetadataCache::getSpineTocIndex(const int index) {
+  if (isSpineResident() && index >= 0 && index < static_cast<int>(spineCount)) {
+    return residentSpine[index].tocIndex;
+  }
+  return getSpineEntry(index).tocIndex;
+}
+
+int16_t BookMetadataCache::getTocSpineIndex(const int index) {
+  if (isTocResident() && index >= 0 && index < static_cast<int>(tocCount)) {
+    return residentToc[index].spineIndex;
+  }
+  return getTocEntry(index).spineIndex;
+}
+
+int BookMetadataCache::findSpineIndex(const std::string& href, const bool matchFileName) {
+  if (!loaded) {
+    return -1;
+  }
+
+  const size_t slash = href.find_last_of('/');
+  const size_t nameStart = slash == std::string::npos ? 0 : slash + 1;
+  if (isSpineResident()) {
+    if (matchFileName) {
+      const char* name = href.c_str() + nameStart;
+      const size_t nameLength = href.size() - nameStart;
+      return findResidentSpine(spineByFileName, true, fnvHash32(name, nameLength), name, nameLength);
+    }
+    return findResidentSpine(spineByHref, false, fnvHash32(href.c_str(), href.size()), href.c_str(), href.size());
+  }
+
+  for (int i = 0; i < spineCount; i++) {
+    const std::string spineHref = getSpineEntry(i).href;
+    if (spineHref == href) return i;
+    if (matchFileName) {
+      const size_t spineSlash = spineHref.find_last_of('/');
+      const size_t spineNameStart = spineSlash == std::string::npos ? 0 : spineSlash + 1;
+      if (spineHref.compare(spineNameStart, std::string::npos, href, nameStart, std::string::npos) == 0) return i;
+    }
+  }
+  return -1;
+}
+
 BookMetadataCache::SpineEntry BookMetadataCache::readSpineEntry(FsFile& file) const {
   SpineEntry entry;
   serialization::readString(file, entry.href);
@@ -3,6 +3,7 @@
 #include <HalStorage.h>
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -44,7 +45,7 @@ class BookMetadataCache {
 
  private:
   std::string cachePath;
-  size_t lutOffset;
+  uint32_t lutOffset;
   uint16_t spineCount;
   uint16_t tocCount;
   bool loaded;
@@ -76,6 +77,47 @@ class BookMetadataCache {
     return hash;
   }
 
+  // Resident copy of the spine and TOC (see loadResident). Records are fixed size and their strings live in one pool;
+  // a TOC entry that points at a spine item shares that item's href.
+  struct ResidentSpineEntry {
+    uint32_t cumulativeSize;
+    uint32_t hrefHash;      // FNV-1a of the whole href
+    uint32_t fileNameHash;  // FNV-1a of the href after its last '/'
+    uint16_t hrefOffset;    // Into residentPool
+    uint16_t hrefLength;
+    int16_t tocIndex;
+  };
+  struct ResidentTocEntry {
+    uint16_t titleOffset;
+    uint16_t titleLength;
+    uint16_t hrefOffset;
+    uint16_t hrefLength;
+    uint16_t anchorOffset;
+    uint16_t anchorLength;
+    int16_t spineIndex;
+    uint8_t level;
+  };
+  std::vector<ResidentSpineEntry> residentSpine;
+  std::vector<ResidentTocEntry> residentToc;
+  std::unique_ptr<char[]> residentPool;
+  // Spine indexes ordered by hash, for binary search by href and by file name
+  std::vector<uint16_t> spineByHref;
+  std::vector<uint16_t> spineByFileName;
+
+  static uint32_t fnvHash32(const char* s, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+      hash ^= static_cast<uint8_t>(s[i]);
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+  std::string residentString(uint16_t offset, uint16_t length) const {
+    return std::string(residentPool.get() + offset, length);
+  }
+  int findResidentSpine(const std::vector<uint16_t>& order, bool byFileName, uint32_t hash, const char* text,
+                        size_t length) const;
+
   uint32_t writeSpineEntry(FsFile& file, const SpineEntry& entry) const;
   uint32_t writeTocEntry(FsFile& file, const TocEntry& entry) const;
   SpineEntry readSpineEntry(FsFile& file) const;
@@ -104,8 +146,19 @@ class BookMetadataCache {
 
   // Reading phase (read mode)
   bool load();
+  // Copies the spine, and the TOC if it also fits, into RAM when they take at most `budgetBytes`, so the lookups below
+  // stop reading book.bin. Returns false if not even the spine fits.
+  bool loadResident(size_t budgetBytes);
+  bool isSpineResident() const { return !residentSpine.empty(); }
+  bool isTocResident() const { return !residentToc.empty(); }
   SpineEntry getSpineEntry(int index);
   TocEntry getTocEntry(int index);
+  uint32_t getSpineCumulativeSize(int index);
+  int16_t getSpineTocIndex(int index);
+  int16_t getTocSpineIndex(int index);
+  // First spine index whose href equals `href`, or, if `matchFileName`, whose file name equals the file name of `href`.
+  // Returns -1 if there is none.
+  int findSpineIndex(const std::string& href, bool matchFileName);
   int getSpineCount() const { return spineCount; }
   int getTocCount() const { return tocCount; }
   bool isLoaded() const { return loaded; }
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "hyphenation/Hyphenator.h"
+
+class WordWidthCache;
+
+// Box/glue/penalty model of one paragraph. Words are boxes, the gaps in front of them are glue, and every place a line
+// may end is a breakpoint: the end of a word (unless the next word attaches to it) or a hyphenation point inside a
+// word, which carries a penalty. Line widths come from prefix sums, so each candidate line is measured in O(1).
+// Each parse owns one (see ChapterHtmlSlimParser) and its buffers are reused from one paragraph to the next.
+struct LayoutScratch {
+  enum : uint8_t {
+    CAN_BREAK = 1 << 0,        // A line may end here
+    SPLIT = 1 << 1,            // Hyphenation point inside the word rather than its end
+    INSERTED_HYPHEN = 1 << 2,  // The split shows a '-' that is not part of the word
+  };
+
+  // Node 0 is the paragraph start. The rest follow text order: a word's hyphenation points by offset, then its end.
+  struct Breakpoint {
+    uint32_t word;
+    uint32_t prev;         // Breakpoint ending the previous line on the best path
+    int32_t cost;          // Least demerits from the start of the paragraph to here
+    uint16_t splitOffset;  // SPLIT only: byte offset of the break inside the word
+    uint16_t prefixWidth;  // SPLIT only: the word up to the break, hyphen included
+    uint16_t suffixWidth;  // SPLIT only: the rest of the word
+    uint8_t flags;
+    int32_t startX;        // Where the line after this breakpoint starts on the single-line paragraph
+  };
+
+  std::vector<uint16_t> wordWidths;
+  std::vector<int16_t> gaps;    // Glue in front of each word: space plus kerning, or just kerning for attached words
+  std::vector<int32_t> wordX;   // Where each word would start if the whole paragraph were a single line
+  std::vector<Breakpoint> nodes;
+  std::vector<uint32_t> lineEnds;  // Breakpoint ending each output line
+  enum : uint8_t { SPLIT_MARKED = 1, SPLIT_MEASURED = 2 };
+  std::vector<uint8_t> splitWords;  // Words that get hyphenation points: 0, SPLIT_MARKED or SPLIT_MEASURED
+  // Hyphenation points of the split words, measured once per paragraph and copied into `nodes` on every pass. Each
+  // word's points are the range [splitBegin, splitEnd) of splitPoints.
+  std::vector<Breakpoint> splitPoints;
+  std::vector<uint32_t> splitBegin;
+  std::vector<uint32_t> splitEnd;
+  std::string piece;  // Measuring buffer for split words
+  std::vector<Hyphenator::BreakInfo> breaks;  // Hyphenator output for the word being measured
+  WordWidthCache* widthCache = nullptr;       // The caller's, for the paragraph being laid out
+
+  // Position on the single-line paragraph where a line starting after breakpoint `index` begins
+  int32_t lineStart(const size_t index) const { return nodes[index].startX; }
+
+  // Position on the single-line paragraph where a line ending at breakpoint `index` ends
+  int32_t lineEnd(const size_t index) const {
+    const Breakpoint& node = nodes[index];
+    return wordX[node.word] + ((node.flags & SPLIT) ? node.prefixWidth : wordWidths[node.word]);
+  }
+};
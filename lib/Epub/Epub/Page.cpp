@@ -3,125 +3,294 @@
 #include <Logging.h>
 #include <Serialization.h>
 
-void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
-}
+#include <algorithm>
+#include <limits>
+#include <new>
 
-bool PageLine::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+#include "blocks/ImageBlock.h"
 
-  // serialize TextBlock pointed to by PageLine
-  return block->serialize(file);
-}
+namespace {
+// Record arrays are laid out back to back, so each record must keep the next one aligned
+static_assert(sizeof(PageHeader) % 4 == 0, "PageHeader must keep the records aligned");
+static_assert(sizeof(PageLineRecord) % 4 == 0, "PageLineRecord must keep the records aligned");
+static_assert(sizeof(PageImageRecord) % 4 == 0, "PageImageRecord must keep the records aligned");
+static_assert(sizeof(PageWordRecord) % 4 == 0, "PageWordRecord must keep the records aligned");
+static_assert(sizeof(FootnoteEntry) % 4 == 0, "FootnoteEntry must keep the records aligned");
 
-std::unique_ptr<PageLine> PageLine::deserialize(FsFile& file) {
-  int16_t xPos;
-  int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
+// Sanity limit for a page blob read from disk
+constexpr uint32_t MAX_PAGE_BYTES = 64 * 1024;
 
-  auto tb = TextBlock::deserialize(file);
-  return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
-}
+// Record counts and pool offsets are 16 bit
+constexpr size_t MAX_RECORDS = std::numeric_limits<uint16_t>::max();
+constexpr size_t MAX_POOL_BYTES = std::numeric_limits<uint16_t>::max();
+
+// Em space used as the fallback paragraph indent
+constexpr char EM_SPACE_UTF8[] = "\xe2\x80\x83";
+constexpr size_t EM_SPACE_BYTES = 3;
+}  // namespace
 
-void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  // Images don't use fontId or text rendering
-  imageBlock->render(renderer, xPos + xOffset, yPos + yOffset);
+bool PageBuilder::appendToPool(const std::string& text, uint16_t& offset) {
+  if (pool.size() + text.size() + 1 > MAX_POOL_BYTES) {
+    return false;
+  }
+  offset = static_cast<uint16_t>(pool.size());
+  pool.append(text);
+  pool.push_back('\0');
+  return true;
 }
 
-bool PageImage::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+bool PageBuilder::addLine(const TextBlock& line, const int16_t xPos, const int16_t yPos) {
+  const auto& lineWords = line.getWords();
+  const auto& lineXpos = line.getWordXpos();
+  const auto& lineStyles = line.getWordStyles();
+  if (lineWords.size() != lineXpos.size() || lineWords.size() != lineStyles.size()) {
+    LOG_ERR("PGE", "Line skipped: size mismatch (words=%u, xpos=%u, styles=%u)", (uint32_t)lineWords.size(),
+            (uint32_t)lineXpos.size(), (uint32_t)lineStyles.size());
+    return false;
+  }
+  if (lines.size() >= MAX_RECORDS || words.size() + lineWords.size() > MAX_RECORDS) {
+    LOG_ERR("PGE", "Page record limit reached");
+    return false;
+  }
 
-  // serialize ImageBlock
-  return imageBlock->serialize(file);
+  const PageLineRecord record{xPos, yPos, static_cast<uint16_t>(words.size()),
+                              static_cast<uint16_t>(lineWords.size())};
+  for (size_t i = 0; i < lineWords.size(); i++) {
+    PageWordRecord word{};
+    if (!appendToPool(lineWords[i], word.offset)) {
+      LOG_ERR("PGE", "Page string pool full");
+      words.resize(record.firstWord);
+      return false;
+    }
+    word.length = static_cast<uint16_t>(lineWords[i].size());
+    word.x = lineXpos[i];
+    word.style = static_cast<uint8_t>(lineStyles[i]);
+    words.push_back(word);
+  }
+  lines.push_back(record);
+  return true;
 }
 
-std::unique_ptr<PageImage> PageImage::deserialize(FsFile& file) {
-  int16_t xPos;
-  int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
-
-  auto ib = ImageBlock::deserialize(file);
-  return std::unique_ptr<PageImage>(new PageImage(std::move(ib), xPos, yPos));
+bool PageBuilder::addImage(const std::string& imagePath, const int16_t xPos, const int16_t yPos, const int16_t width,
+                           const int16_t height) {
+  PageImageRecord record{xPos, yPos, width, height, 0, static_cast<uint16_t>(imagePath.size())};
+  if (images.size() >= MAX_RECORDS || !appendToPool(imagePath, record.pathOffset)) {
+    LOG_ERR("PGE", "No room for image %s", imagePath.c_str());
+    return false;
+  }
+  images.push_back(record);
+  return true;
 }
 
-void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
-  for (auto& element : elements) {
-    element->render(renderer, fontId, xOffset, yOffset);
+bool PageBuilder::serialize(FsFile& file) const {
+  // Clamp to MAX_FOOTNOTES_PER_PAGE to match addFootnote/deserialize limits
+  const PageHeader header{static_cast<uint16_t>(lines.size()), static_cast<uint16_t>(images.size()),
+                          static_cast<uint16_t>(words.size()),
+                          std::min<uint16_t>(footnotes.size(), MAX_FOOTNOTES_PER_PAGE),
+                          static_cast<uint32_t>(pool.size())};
+  const uint32_t size = sizeof(header) + lines.size() * sizeof(PageLineRecord) +
+                        images.size() * sizeof(PageImageRecord) + words.size() * sizeof(PageWordRecord) +
+                        header.footnoteCount * sizeof(FootnoteEntry) + pool.size();
+  if (size > MAX_PAGE_BYTES) {
+    LOG_ERR("PGE", "Page too large: %u bytes", size);
+    return false;
   }
+
+  const auto writeBytes = [&file](const void* data, const size_t length) {
+    return length == 0 || file.write(reinterpret_cast<const uint8_t*>(data), length) == length;
+  };
+  serialization::writePod(file, size);
+  if (!writeBytes(&header, sizeof(header)) || !writeBytes(lines.data(), lines.size() * sizeof(PageLineRecord)) ||
+      !writeBytes(images.data(), images.size() * sizeof(PageImageRecord)) ||
+      !writeBytes(words.data(), words.size() * sizeof(PageWordRecord)) ||
+      !writeBytes(footnotes.data(), header.footnoteCount * sizeof(FootnoteEntry)) ||
+      !writeBytes(pool.data(), pool.size())) {
+    LOG_ERR("PGE", "Failed to write page");
+    return false;
+  }
+  return true;
 }
 
-bool Page::serialize(FsFile& file) const {
-  const uint16_t count = elements.size();
-  serialization::writePod(file, count);
+// Points the record views into the blob and checks that every record stays inside it, so rendering can trust them
+bool Page::bind(const uint32_t size) {
+  if (size < sizeof(PageHeader)) {
+    return false;
+  }
+  header = reinterpret_cast<const PageHeader*>(blob.get());
+  if (header->footnoteCount > PageBuilder::MAX_FOOTNOTES_PER_PAGE) {
+    LOG_ERR("PGE", "Invalid footnote count %u", header->footnoteCount);
+    return false;
+  }
 
-  for (const auto& el : elements) {
-    // Use getTag() method to determine type
-    serialization::writePod(file, static_cast<uint8_t>(el->getTag()));
+  size_t offset = sizeof(PageHeader);
+  lines = reinterpret_cast<const PageLineRecord*>(blob.get() + offset);
+  offset += header->lineCount * sizeof(PageLineRecord);
+  images = reinterpret_cast<const PageImageRecord*>(blob.get() + offset);
+  offset += header->imageCount * sizeof(PageImageRecord);
+  words = reinterpret_cast<const PageWordRecord*>(blob.get() + offset);
+  offset += header->wordCount * sizeof(PageWordRecord);
+  footnotes = reinterpret_cast<const FootnoteEntry*>(blob.get() + offset);
+  offset += header->footnoteCount * sizeof(FootnoteEntry);
+  pool = reinterpret_cast<const char*>(blob.get() + offset);
+  if (offset + header->poolSize != size) {
+    LOG_ERR("PGE", "Page size mismatch: %u records, %u bytes", (uint32_t)offset, size);
+    return false;
+  }
 
-    if (!el->serialize(file)) {
+  // Every string in the pool is NUL-terminated, which is what lets words be drawn straight from the blob
+  const auto validString = [this](const uint16_t stringOffset, const uint16_t length) {
+    return static_cast<uint32_t>(stringOffset) + length < header->poolSize && pool[stringOffset + length] == '\0';
+  };
+  for (uint16_t i = 0; i < header->lineCount; i++) {
+    if (static_cast<uint32_t>(lines[i].firstWord) + lines[i].wordCount > header->wordCount) {
+      LOG_ERR("PGE", "Line %u out of range", i);
       return false;
     }
   }
-
-  // Serialize footnotes (clamp to MAX_FOOTNOTES_PER_PAGE to match addFootnote/deserialize limits)
-  const uint16_t fnCount = std::min<uint16_t>(footnotes.size(), MAX_FOOTNOTES_PER_PAGE);
-  serialization::writePod(file, fnCount);
-  for (uint16_t i = 0; i < fnCount; i++) {
-    const auto& fn = footnotes[i];
-    if (file.write(fn.number, sizeof(fn.number)) != sizeof(fn.number) ||
-        file.write(fn.href, sizeof(fn.href)) != sizeof(fn.href)) {
-      LOG_ERR("PGE", "Failed to write footnote");
+  for (uint16_t i = 0; i < header->wordCount; i++) {
+    if (!validString(words[i].offset, words[i].length)) {
+      LOG_ERR("PGE", "Word %u out of range", i);
+      return false;
+    }
+  }
+  for (uint16_t i = 0; i < header->imageCount; i++) {
+    if (!validString(images[i].pathOffset, images[i].pathLength)) {
+      LOG_ERR("PGE", "Image %u out of range", i);
       return false;
     }
   }
-
   return true;
 }
 
 std::unique_ptr<Page> Page::deserialize(FsFile& file) {
+  uint32_t size;
+  serialization::readPod(file, size);
+  if (size < sizeof(PageHeader) || size > MAX_PAGE_BYTES) {
+    LOG_ERR("PGE", "Deserialization failed: invalid page size %u", size);
+    return nullptr;
+  }
+
   auto page = std::unique_ptr<Page>(new Page());
+  page->blob.reset(new (std::nothrow) uint8_t[size]);
+  if (!page->blob) {
+    LOG_ERR("PGE", "Failed to allocate %u bytes for page", size);
+    return nullptr;
+  }
+  if (file.read(page->blob.get(), size) != static_cast<int>(size)) {
+    LOG_ERR("PGE", "Failed to read page");
+    return nullptr;
+  }
+  page->blobSize = size;
+  if (!page->bind(size)) {
+    LOG_ERR("PGE", "Deserialization failed: corrupt page");
+    return nullptr;
+  }
+  return page;
+}
+
+void Page::shapeWords(const GfxRenderer& renderer, const int fontId) const {
+  shapedGlyphs.clear();
+  shapedWordEnds.clear();
+  shapedWordEnds.reserve(header->wordCount);
+  // A glyph takes at least one byte of UTF-8, so the pool size bounds the glyph count and the runs never regrow
+  shapedGlyphs.reserve(header->poolSize);
+  for (uint16_t i = 0; i < header->wordCount; i++) {
+    renderer.shapeText(fontId, pool + words[i].offset, static_cast<EpdFontFamily::Style>(words[i].style),
+                       shapedGlyphs);
+    shapedWordEnds.push_back(static_cast<uint16_t>(shapedGlyphs.size()));
+  }
+  shapedFontId = fontId;
+}
+
+void Page::renderUnderline(const GfxRenderer& renderer, const int fontId, const PageWordRecord& word,
+                           const int wordX, const int y) const {
+  const auto style = static_cast<EpdFontFamily::Style>(word.style);
+  const char* text = pool + word.offset;
+  // y is the top of the text line; add ascender to reach baseline, then offset 2px below
+  const int underlineY = y + renderer.getFontAscenderSize(fontId) + 2;
+
+  int startX = wordX;
+  int underlineWidth;
+  // if word starts with em-space ("\xe2\x80\x83"), account for the additional indent before drawing the line
+  if (word.length >= EM_SPACE_BYTES && std::memcmp(text, EM_SPACE_UTF8, EM_SPACE_BYTES) == 0) {
+    startX += renderer.getTextAdvanceX(fontId, EM_SPACE_UTF8, style);
+    underlineWidth = renderer.getTextWidth(fontId, text + EM_SPACE_BYTES, style);
+  } else {
+    underlineWidth = renderer.getTextWidth(fontId, text, style);
+  }
+
+  renderer.drawLine(startX, underlineY, startX + underlineWidth, underlineY, true);
+}
 
-  uint16_t count;
-  serialization::readPod(file, count);
-
-  for (uint16_t i = 0; i < count; i++) {
-    uint8_t tag;
-    serialization::readPod(file, tag);
-
-    if (tag == TAG_PageLine) {
-      auto pl = PageLine::deserialize(file);
-      page->elements.push_back(std::move(pl));
-    } else if (tag == TAG_PageImage) {
-      auto pi = PageImage::deserialize(file);
-      page->elements.push_back(std::move(pi));
-    } else {
-      LOG_ERR("PGE", "Deserialization failed: Unknown tag %u", tag);
-      return nullptr;
+void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
+  if (shapedFontId != fontId) {
+    shapeWords(renderer, fontId);
+  }
+
+  for (uint16_t l = 0; l < header->lineCount; l++) {
+    const PageLineRecord& line = lines[l];
+    const int lineX = line.x + xOffset;
+    const int lineY = line.y + yOffset;
+    size_t glyphStart = line.firstWord > 0 ? shapedWordEnds[line.firstWord - 1] : 0;
+    for (uint16_t i = line.firstWord; i < line.firstWord + line.wordCount; i++) {
+      const PageWordRecord& word = words[i];
+      const auto style = static_cast<EpdFontFamily::Style>(word.style);
+      const int wordX = lineX + word.x;
+      const size_t glyphEnd = shapedWordEnds[i];
+      renderer.drawShapedText(fontId, wordX, lineY, shapedGlyphs.data() + glyphStart, glyphEnd - glyphStart, true,
+                              style);
+      glyphStart = glyphEnd;
+
+      if ((style & EpdFontFamily::UNDERLINE) != 0) {
+        renderUnderline(renderer, fontId, word, wordX, lineY);
+      }
     }
   }
 
-  // Deserialize footnotes
-  uint16_t fnCount;
-  serialization::readPod(file, fnCount);
-  if (fnCount > MAX_FOOTNOTES_PER_PAGE) {
-    LOG_ERR("PGE", "Invalid footnote count %u", fnCount);
-    return nullptr;
+  for (uint16_t i = 0; i < header->imageCount; i++) {
+    const PageImageRecord& image = images[i];
+    ImageBlock(std::string(pool + image.pathOffset, image.pathLength), image.width, image.height)
+        .render(renderer, image.x + xOffset, image.y + yOffset);
   }
-  page->footnotes.resize(fnCount);
-  for (uint16_t i = 0; i < fnCount; i++) {
-    auto& entry = page->footnotes[i];
-    if (file.read(entry.number, sizeof(entry.number)) != sizeof(entry.number) ||
-        file.read(entry.href, sizeof(entry.href)) != sizeof(entry.href)) {
-      LOG_ERR("PGE", "Failed to read footnote %u", i);
-      return nullptr;
+}
+
+size_t Page::getMemoryUsage() const {
+  return sizeof(Page) + blobSize + shapedGlyphs.capacity() * sizeof(ShapedGlyph) +
+         shapedWordEnds.capacity() * sizeof(uint16_t);
+}
+
+void Page::releaseShapedGlyphs() const {
+  std::vector<ShapedGlyph>().swap(shapedGlyphs);
+  std::vector<uint16_t>().swap(shapedWordEnds);
+  shapedFontId = -1;
+}
+
+std::string Page::getText() const {
+  std::string text;
+  for (uint16_t l = 0; l < header->lineCount; l++) {
+    for (uint16_t i = lines[l].firstWord; i < lines[l].firstWord + lines[l].wordCount; i++) {
+      if (!text.empty()) text += ' ';
+      text.append(pool + words[i].offset, words[i].length);
     }
-    entry.number[sizeof(entry.number) - 1] = '\0';
-    entry.href[sizeof(entry.href) - 1] = '\0';
   }
+  return text;
+}
 
-  return page;
+bool Page::getImageBoundingBox(int16_t& outX, int16_t& outY, int16_t& outW, int16_t& outH) const {
+  if (header->imageCount == 0) {
+    return false;
+  }
+  int16_t minX = INT16_MAX, minY = INT16_MAX, maxX = INT16_MIN, maxY = INT16_MIN;
+  for (uint16_t i = 0; i < header->imageCount; i++) {
+    const PageImageRecord& image = images[i];
+    minX = std::min(minX, image.x);
+    minY = std::min(minY, image.y);
+    maxX = std::max(maxX, static_cast<int16_t>(image.x + image.width));
+    maxY = std::max(maxY, static_cast<int16_t>(image.y + image.height));
+  }
+  outX = minX;
+  outY = minY;
+  outW = maxX - minX;
+  outH = maxY - minY;
+  return true;
 }
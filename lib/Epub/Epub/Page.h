@@ -1,66 +1,77 @@
 #pragma once
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
 #include <HalStorage.h>
 
-#include <algorithm>
-#include <utility>
+#include <cstring>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "FootnoteEntry.h"
-#include "blocks/ImageBlock.h"
 #include "blocks/TextBlock.h"
 
-enum PageElementTag : uint8_t {
-  TAG_PageLine = 1,
-  TAG_PageImage = 2,  // New tag
+// A page is stored in the section file as one contiguous blob: a header, fixed-size records and a string pool holding
+// every word and image path NUL-terminated. Loading a page is a single read into one buffer and rendering walks the
+// records in place, so a page load costs two allocations instead of several per word.
+//
+// Blob layout (record arrays follow each other without padding; every record size is a multiple of 4):
+//   PageHeader
+//   PageLineRecord[lineCount]
+//   PageImageRecord[imageCount]
+//   PageWordRecord[wordCount]
+//   FootnoteEntry[footnoteCount]
+//   char pool[poolSize]
+struct PageHeader {
+  uint16_t lineCount;
+  uint16_t imageCount;
+  uint16_t wordCount;
+  uint16_t footnoteCount;
+  uint32_t poolSize;
 };
 
-// represents something that has been added to a page
-class PageElement {
- public:
-  int16_t xPos;
-  int16_t yPos;
-  explicit PageElement(const int16_t xPos, const int16_t yPos) : xPos(xPos), yPos(yPos) {}
-  virtual ~PageElement() = default;
-  virtual void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) = 0;
-  virtual bool serialize(FsFile& file) = 0;
-  virtual PageElementTag getTag() const = 0;  // Add type identification
+// A line of text: its position on the page and the range of word records it owns
+struct PageLineRecord {
+  int16_t x;
+  int16_t y;
+  uint16_t firstWord;
+  uint16_t wordCount;
 };
 
-// a line from a block element
-class PageLine final : public PageElement {
-  std::shared_ptr<TextBlock> block;
+struct PageImageRecord {
+  int16_t x;
+  int16_t y;
+  int16_t width;
+  int16_t height;
+  uint16_t pathOffset;  // Into the string pool
+  uint16_t pathLength;
+};
 
- public:
-  PageLine(std::shared_ptr<TextBlock> block, const int16_t xPos, const int16_t yPos)
-      : PageElement(xPos, yPos), block(std::move(block)) {}
-  const std::shared_ptr<TextBlock>& getBlock() const { return block; }
-  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
-  bool serialize(FsFile& file) override;
-  PageElementTag getTag() const override { return TAG_PageLine; }
-  static std::unique_ptr<PageLine> deserialize(FsFile& file);
+struct PageWordRecord {
+  uint16_t offset;  // Into the string pool
+  uint16_t length;
+  uint16_t x;  // Relative to the line
+  uint8_t style;
+  uint8_t reserved;
 };
 
-// New PageImage class
-class PageImage final : public PageElement {
-  std::shared_ptr<ImageBlock> imageBlock;
+// Collects the lines, images and footnotes of a page while a chapter is laid out, and writes them as a page blob
+class PageBuilder {
+  std::vector<PageLineRecord> lines;
+  std::vector<PageImageRecord> images;
+  std::vector<PageWordRecord> words;
+  std::vector<FootnoteEntry> footnotes;
+  std::string pool;
 
- public:
-  PageImage(std::shared_ptr<ImageBlock> block, const int16_t xPos, const int16_t yPos)
-      : PageElement(xPos, yPos), imageBlock(std::move(block)) {}
-  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
-  bool serialize(FsFile& file) override;
-  PageElementTag getTag() const override { return TAG_PageImage; }
-  static std::unique_ptr<PageImage> deserialize(FsFile& file);
-  const ImageBlock& getImageBlock() const { return *imageBlock; }
-};
+  bool appendToPool(const std::string& text, uint16_t& offset);
 
-class Page {
  public:
-  // the list of block index and line numbers on this page
-  std::vector<std::shared_ptr<PageElement>> elements;
-  std::vector<FootnoteEntry> footnotes;
   static constexpr uint16_t MAX_FOOTNOTES_PER_PAGE = 16;
 
+  // Both return false if the page has run out of record or string pool space
+  bool addLine(const TextBlock& line, int16_t xPos, int16_t yPos);
+  bool addImage(const std::string& imagePath, int16_t xPos, int16_t yPos, int16_t width, int16_t height);
+
   void addFootnote(const char* number, const char* href) {
     if (footnotes.size() >= MAX_FOOTNOTES_PER_PAGE) return;  // Cap per-page footnotes
     FootnoteEntry entry;
@@ -71,41 +82,49 @@ class Page {
     footnotes.push_back(entry);
   }
 
-  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
+  bool isEmpty() const { return lines.empty() && images.empty(); }
   bool serialize(FsFile& file) const;
+};
+
+// A page loaded from the section file. Every accessor reads the blob in place.
+class Page {
+  std::unique_ptr<uint8_t[]> blob;
+  uint32_t blobSize = 0;
+  const PageHeader* header = nullptr;
+  const PageLineRecord* lines = nullptr;
+  const PageImageRecord* images = nullptr;
+  const PageWordRecord* words = nullptr;
+  const FootnoteEntry* footnotes = nullptr;
+  const char* pool = nullptr;
+
+  // Glyph runs shaped on the first render and reused by the following passes over the same page (the anti-aliasing
+  // path renders every page three times), so UTF-8 decoding, ligatures, kerning and glyph lookup happen once
+  mutable std::vector<ShapedGlyph> shapedGlyphs;
+  mutable std::vector<uint16_t> shapedWordEnds;  // Exclusive end index into shapedGlyphs for each word
+  mutable int shapedFontId = -1;
+
+  Page() = default;
+  bool bind(uint32_t size);
+  void shapeWords(const GfxRenderer& renderer, int fontId) const;
+  void renderUnderline(const GfxRenderer& renderer, int fontId, const PageWordRecord& word, int wordX, int y) const;
+
+ public:
+  const FootnoteEntry* getFootnotes() const { return footnotes; }
+  uint16_t getFootnoteCount() const { return header->footnoteCount; }
+  // The words of the page in reading order, separated by single spaces
+  std::string getText() const;
+  // Heap held by the page: the blob, plus the glyph runs once it has been rendered
+  size_t getMemoryUsage() const;
+  // Drops the glyph runs of a page that is not on screen; the next render shapes it again
+  void releaseShapedGlyphs() const;
+
+  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
   static std::unique_ptr<Page> deserialize(FsFile& file);
 
   // Check if page contains any images (used to force full refresh)
-  bool hasImages() const {
-    return std::any_of(elements.begin(), elements.end(),
-                       [](const std::shared_ptr<PageElement>& el) { return el->getTag() == TAG_PageImage; });
-  }
+  bool hasImages() const { return header->imageCount > 0; }
 
   // Get bounding box of all images on the page (union of image rects)
   // Returns false if no images. Coordinates are relative to page origin.
-  bool getImageBoundingBox(int16_t& outX, int16_t& outY, int16_t& outW, int16_t& outH) const {
-    bool found = false;
-    int16_t minX = INT16_MAX, minY = INT16_MAX, maxX = INT16_MIN, maxY = INT16_MIN;
-    for (const auto& el : elements) {
-      if (el->getTag() == TAG_PageImage) {
-        const auto& img = static_cast<const PageImage&>(*el);
-        int16_t x = img.xPos;
-        int16_t y = img.yPos;
-        int16_t right = x + img.getImageBlock().getWidth();
-        int16_t bottom = y + img.getImageBlock().getHeight();
-        minX = std::min(minX, x);
-        minY = std::min(minY, y);
-        maxX = std::max(maxX, right);
-        maxY = std::max(maxY, bottom);
-        found = true;
-      }
-    }
-    if (found) {
-      outX = minX;
-      outY = minY;
-      outW = maxX - minX;
-      outH = maxY - minY;
-    }
-    return found;
-  }
+  bool getImageBoundingBox(int16_t& outX, int16_t& outY, int16_t& outW, int16_t& outH) const;
 };
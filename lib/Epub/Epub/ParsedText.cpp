@@ -5,16 +5,28 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <vector>
 
+#include "LayoutScratch.h"
+#include "WordWidthCache.h"
 #include "hyphenation/Hyphenator.h"
 
-constexpr int MAX_COST = std::numeric_limits<int>::max();
-
 namespace {
 
+// Demerits are the squared leftover pixels of each line. Penalties are counted in the same unit, scaled by the space
+// width so that they weigh the same at every font size.
+constexpr int64_t HYPHEN_PENALTY_SPACES = 2;         // Splitting a word costs like two spaces of extra slack
+constexpr int64_t DOUBLE_HYPHEN_PENALTY_SPACES = 3;  // Added when the previous line ended in a split as well
+constexpr int MAX_HYPHENATION_PASSES = 3;
+// Added for a line that cannot fit (a word wider than the page with no usable break)
+constexpr int64_t OVERFULL_PENALTY = int64_t{1} << 24;
+constexpr int32_t MAX_COST = std::numeric_limits<int32_t>::max();
+// Breakpoint capacity kept between paragraphs; a larger paragraph gives its scratch memory back when it is done
+constexpr size_t RETAINED_BREAKPOINTS = 512;
+
 // Soft hyphen byte pattern used throughout EPUBs (UTF-8 for U+00AD).
 constexpr char SOFT_HYPHEN_UTF8[] = "\xC2\xAD";
 constexpr size_t SOFT_HYPHEN_BYTES = 2;
@@ -51,29 +63,47 @@ void stripSoftHyphensInPlace(std::string& word) {
   }
 }
 
-// Returns the advance width for a word while ignoring soft hyphen glyphs and optionally appending a visible hyphen.
+// Advance width of `text`, through the section's width cache when there is one
+uint16_t measureText(WordWidthCache* widthCache, const GfxRenderer& renderer, const int fontId, const char* text,
+                     const EpdFontFamily::Style style) {
+  if (widthCache) {
+    return widthCache->advanceX(renderer, fontId, text, style);
+  }
+  return static_cast<uint16_t>(renderer.getTextAdvanceX(fontId, text, style));
+}
+
+// Returns the advance width for a word while ignoring soft hyphen glyphs.
 // Uses advance width (sum of glyph advances + kerning) rather than bounding box width so that italic glyph overhangs
 // don't inflate inter-word spacing.
-uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
-                          const EpdFontFamily::Style style, const bool appendHyphen = false) {
-  if (word.size() == 1 && word[0] == ' ' && !appendHyphen) {
+uint16_t measureWordWidth(WordWidthCache* widthCache, const GfxRenderer& renderer, const int fontId,
+                          const std::string& word, const EpdFontFamily::Style style) {
+  if (word.size() == 1 && word[0] == ' ') {
     return renderer.getSpaceWidth(fontId, style);
   }
-  const bool hasSoftHyphen = containsSoftHyphen(word);
-  if (!hasSoftHyphen && !appendHyphen) {
-    return renderer.getTextAdvanceX(fontId, word.c_str(), style);
+  if (!containsSoftHyphen(word)) {
+    return measureText(widthCache, renderer, fontId, word.c_str(), style);
   }
 
   std::string sanitized = word;
-  if (hasSoftHyphen) {
-    stripSoftHyphensInPlace(sanitized);
+  stripSoftHyphensInPlace(sanitized);
+  return measureText(widthCache, renderer, fontId, sanitized.c_str(), style);
+}
+
+// Copies the bytes [begin, end) of a word into `out` as they are rendered on a line: soft hyphens removed and a
+// visible hyphen appended when the piece ends at a break that needs one.
+void buildWordPiece(const std::string& word, const size_t begin, const size_t end, const bool appendHyphen,
+                    std::string& out) {
+  out.assign(word, begin, end - begin);
+  if (containsSoftHyphen(out)) {
+    stripSoftHyphensInPlace(out);
   }
   if (appendHyphen) {
-    sanitized.push_back('-');
+    out.push_back('-');
   }
-  return renderer.getTextAdvanceX(fontId, sanitized.c_str(), style);
 }
 
+int32_t clampCost(const int64_t cost) { return static_cast<int32_t>(std::min<int64_t>(cost, MAX_COST - 1)); }
+
 }  // namespace
 
 void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle, const bool underline,
@@ -92,168 +122,289 @@ void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle,
 // Consumes data to minimize memory usage
 void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
                                        const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                                       const bool includeLastLine) {
+                                       const bool includeLastLine, WordWidthCache* widthCache,
+                                       LayoutScratch* layoutScratch) {
   if (words.empty()) {
     return;
   }
 
+  LayoutScratch ownScratch;
+  LayoutScratch& scratch = layoutScratch ? *layoutScratch : ownScratch;
+  scratch.widthCache = widthCache;
+
   // Apply fixed transforms before any per-line layout work.
   applyParagraphIndent();
 
   const int pageWidth = viewportWidth;
   const int spaceWidth = renderer.getSpaceWidth(fontId, EpdFontFamily::REGULAR);
-  auto wordWidths = calculateWordWidths(renderer, fontId);
-
-  std::vector<size_t> lineBreakIndices;
-  if (hyphenationEnabled) {
-    // Use greedy layout that can split words mid-loop when a hyphenated prefix fits.
-    lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, wordContinues);
-  } else {
-    lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, wordContinues);
-  }
-  const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
+  measureWords(scratch, renderer, fontId, spaceWidth);
+  computeLineBreaks(scratch, renderer, fontId, pageWidth, spaceWidth);
 
+  const size_t lineCount = includeLastLine ? scratch.lineEnds.size() : scratch.lineEnds.size() - 1;
   for (size_t i = 0; i < lineCount; ++i) {
-    extractLine(i, pageWidth, spaceWidth, wordWidths, wordContinues, lineBreakIndices, processLine, renderer, fontId);
+    extractLine(scratch, i, pageWidth, processLine, renderer, fontId);
   }
 
   // Remove consumed words so size() reflects only remaining words
   if (lineCount > 0) {
-    const size_t consumed = lineBreakIndices[lineCount - 1];
+    const auto& lastBreak = scratch.nodes[scratch.lineEnds[lineCount - 1]];
+    size_t consumed = lastBreak.word + 1;
+    if (lastBreak.flags & LayoutScratch::SPLIT) {
+      // The rest of the split word opens the remaining text and is not attached to anything before it
+      words[lastBreak.word].erase(0, lastBreak.splitOffset);
+      wordContinues[lastBreak.word] = false;
+      consumed = lastBreak.word;
+    }
     words.erase(words.begin(), words.begin() + consumed);
     wordStyles.erase(wordStyles.begin(), wordStyles.begin() + consumed);
     wordContinues.erase(wordContinues.begin(), wordContinues.begin() + consumed);
   }
-}
-
-std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
-  std::vector<uint16_t> wordWidths;
-  wordWidths.reserve(words.size());
 
-  for (size_t i = 0; i < words.size(); ++i) {
-    wordWidths.push_back(measureWordWidth(renderer, fontId, words[i], wordStyles[i]));
+  if (scratch.nodes.capacity() > RETAINED_BREAKPOINTS) {
+    scratch = LayoutScratch();
   }
-
-  return wordWidths;
 }
 
-std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, const int fontId, const int pageWidth,
-                                                  const int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec) {
-  if (words.empty()) {
-    return {};
-  }
+// First line indent (only for left/justified text without extra paragraph spacing)
+int ParsedText::firstLineIndent() const {
+  return blockStyle.textIndent > 0 && !extraParagraphSpacing &&
+                 (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
+             ? blockStyle.textIndent
+             : 0;
+}
 
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const int firstLineIndent =
-      blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
-
-  // Ensure any word that would overflow even as the first entry on a line is split using fallback hyphenation.
-  for (size_t i = 0; i < wordWidths.size(); ++i) {
-    // First word needs to fit in reduced width if there's an indent
-    const int effectiveWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
-    while (wordWidths[i] > effectiveWidth) {
-      if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, fontId, wordWidths, /*allowFallbackBreaks=*/true)) {
-        break;
+// Measures every word and the glue in front of it once per paragraph.
+void ParsedText::measureWords(LayoutScratch& scratch, const GfxRenderer& renderer, const int fontId,
+                              const int spaceWidth) const {
+  const size_t wordCount = words.size();
+  scratch.wordWidths.clear();
+  scratch.gaps.clear();
+  scratch.wordX.clear();
+  scratch.wordWidths.reserve(wordCount);
+  scratch.gaps.reserve(wordCount);
+  scratch.wordX.reserve(wordCount);
+
+  int32_t x = 0;
+  uint32_t previousLastCp = 0;
+  for (size_t i = 0; i < wordCount; ++i) {
+    int gap = 0;
+    if (i > 0) {
+      const uint32_t firstCp = firstCodepoint(words[i]);
+      if (wordContinues[i]) {
+        // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
+        gap = renderer.getKerning(fontId, previousLastCp, firstCp, wordStyles[i - 1]);
+      } else {
+        gap = spaceWidth + renderer.getSpaceKernAdjust(fontId, previousLastCp, firstCp, wordStyles[i - 1]);
       }
     }
+    previousLastCp = lastCodepoint(words[i]);
+
+    const uint16_t width = measureWordWidth(scratch.widthCache, renderer, fontId, words[i], wordStyles[i]);
+    x += gap;
+    scratch.wordWidths.push_back(width);
+    scratch.gaps.push_back(static_cast<int16_t>(gap));
+    scratch.wordX.push_back(x);
+    x += width;
   }
+}
 
-  const size_t totalWordCount = words.size();
-
-  // DP table to store the minimum badness (cost) of lines starting at index i
-  std::vector<int> dp(totalWordCount);
-  // 'ans[i]' stores the index 'j' of the *last word* in the optimal line starting at 'i'
-  std::vector<size_t> ans(totalWordCount);
-
-  // Base Case
-  dp[totalWordCount - 1] = 0;
-  ans[totalWordCount - 1] = totalWordCount - 1;
-
-  for (int i = totalWordCount - 2; i >= 0; --i) {
-    int currlen = 0;
-    dp[i] = MAX_COST;
-
-    // First line has reduced width due to text-indent
-    const int effectivePageWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
-
-    for (size_t j = i; j < totalWordCount; ++j) {
-      // Add space before word j, unless it's the first word on the line or a continuation
-      int gap = 0;
-      if (j > static_cast<size_t>(i) && !continuesVec[j]) {
-        gap = spaceWidth;
-        gap += renderer.getSpaceKernAdjust(fontId, lastCodepoint(words[j - 1]), firstCodepoint(words[j]),
-                                           wordStyles[j - 1]);
-      } else if (j > static_cast<size_t>(i) && continuesVec[j]) {
-        // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
-        gap = renderer.getKerning(fontId, lastCodepoint(words[j - 1]), firstCodepoint(words[j]), wordStyles[j - 1]);
-      }
-      currlen += wordWidths[j] + gap;
+// Adds the hyphenation points of word `w` to scratch.splitPoints. A word with no usable point gets an empty range, and
+// either way the word is not measured again on later passes.
+void ParsedText::measureSplitPoints(LayoutScratch& scratch, const GfxRenderer& renderer, const int fontId,
+                                    const size_t w, const int lineWidth) const {
+  const std::string& word = words[w];
+  // A word that cannot fit on a line even by itself falls back to evenly spaced breaks when no hyphenation pattern
+  // applies
+  const bool oversized = scratch.wordWidths[w] > lineWidth;
+  const int hyphenWidth = measureText(scratch.widthCache, renderer, fontId, "-", wordStyles[w]);
+  scratch.splitBegin[w] = static_cast<uint32_t>(scratch.splitPoints.size());
+  if (scratch.breaks.size() < word.size()) {
+    scratch.breaks.resize(word.size());
+  }
+  const size_t breakCount = Hyphenator::breakOffsets(word, oversized, scratch.breaks.data(), scratch.breaks.size());
+  for (size_t b = 0; b < breakCount; ++b) {
+    const Hyphenator::BreakInfo& info = scratch.breaks[b];
+    if (info.byteOffset == 0 || info.byteOffset >= word.size()) {
+      continue;
+    }
+    // One measurement per split: the rest of the word is what the prefix and the kerning pair across the split leave
+    // of the whole word
+    buildWordPiece(word, 0, info.byteOffset, false, scratch.piece);
+    const uint32_t lastPrefixCp = lastCodepoint(scratch.piece);
+    const int plainPrefixWidth =
+        measureText(scratch.widthCache, renderer, fontId, scratch.piece.c_str(), wordStyles[w]);
+    const auto* suffix = reinterpret_cast<const unsigned char*>(word.c_str() + info.byteOffset);
+    const int kernAcross = renderer.getKerning(fontId, lastPrefixCp, utf8NextCodepoint(&suffix), wordStyles[w]);
+    const auto suffixWidth = static_cast<uint16_t>(scratch.wordWidths[w] - plainPrefixWidth - kernAcross);
+    int prefixWidth = plainPrefixWidth;
+    uint8_t flags = LayoutScratch::CAN_BREAK | LayoutScratch::SPLIT;
+    if (info.requiresInsertedHyphen) {
+      prefixWidth += renderer.getKerning(fontId, lastPrefixCp, '-', wordStyles[w]) + hyphenWidth;
+      flags |= LayoutScratch::INSERTED_HYPHEN;
+    }
+    scratch.splitPoints.push_back({static_cast<uint32_t>(w), 0, MAX_COST, static_cast<uint16_t>(info.byteOffset),
+                                   static_cast<uint16_t>(prefixWidth), suffixWidth, flags,
+                                   scratch.wordX[w] + scratch.wordWidths[w] - suffixWidth});
+  }
+  scratch.splitEnd[w] = static_cast<uint32_t>(scratch.splitPoints.size());
+  scratch.splitWords[w] = LayoutScratch::SPLIT_MEASURED;
+}
 
-      if (currlen > effectivePageWidth) {
-        break;
+// Total-fit line breaking: finds the breakpoints with the least total demerits over the whole paragraph. Breakpoints
+// are visited in text order and each one takes the best line from any active breakpoint, i.e. a reachable one whose
+// line still fits. Only the words marked in scratch.splitWords get hyphenation points.
+void ParsedText::findBreakpoints(LayoutScratch& scratch, const GfxRenderer& renderer, const int fontId,
+                                 const int pageWidth, const int spaceWidth) const {
+  using Breakpoint = LayoutScratch::Breakpoint;
+  auto& nodes = scratch.nodes;
+  const size_t wordCount = words.size();
+  const int64_t hyphenPenalty = (HYPHEN_PENALTY_SPACES * spaceWidth) * (HYPHEN_PENALTY_SPACES * spaceWidth);
+  const int64_t doubleHyphenPenalty =
+      (DOUBLE_HYPHEN_PENALTY_SPACES * spaceWidth) * (DOUBLE_HYPHEN_PENALTY_SPACES * spaceWidth);
+  // First line has reduced width due to text-indent
+  const int firstLineWidth = pageWidth - firstLineIndent();
+
+  nodes.clear();
+  nodes.reserve(wordCount + 1);
+  nodes.push_back({0, 0, 0, 0, 0, 0, LayoutScratch::CAN_BREAK, 0});
+  size_t firstActive = 0;
+  size_t newestActive = 0;  // Latest breakpoint that is reachable and may end a line
+
+  // Gives breakpoint `index` its best line from the active breakpoints before it
+  const auto relax = [&](const size_t index, const bool isLastLine) {
+    Breakpoint& to = nodes[index];
+    const int32_t endX = scratch.lineEnd(index);
+    int64_t best = std::numeric_limits<int64_t>::max();
+    for (size_t i = firstActive; i < index; ++i) {
+      const Breakpoint& from = nodes[i];
+      if (!(from.flags & LayoutScratch::CAN_BREAK) || from.cost == MAX_COST) {
+        continue;
       }
-
-      // Cannot break after word j if the next word attaches to it (continuation group)
-      if (j + 1 < totalWordCount && continuesVec[j + 1]) {
+      const int lineWidth = i == 0 ? firstLineWidth : pageWidth;
+      const int32_t width = endX - scratch.lineStart(i);
+      if (width > lineWidth) {
         continue;
       }
 
-      int cost;
-      if (j == totalWordCount - 1) {
-        cost = 0;  // Last line
-      } else {
-        const int remainingSpace = effectivePageWidth - currlen;
-        // Use long long for the square to prevent overflow
-        const long long cost_ll = static_cast<long long>(remainingSpace) * remainingSpace + dp[j + 1];
-
-        if (cost_ll > MAX_COST) {
-          cost = MAX_COST;
-        } else {
-          cost = static_cast<int>(cost_ll);
+      int64_t demerits = from.cost;
+      if (!isLastLine) {  // The last line is never stretched, so its slack is free
+        const int64_t slack = lineWidth - width;
+        demerits += slack * slack;
+        if (to.flags & LayoutScratch::SPLIT) {
+          demerits += hyphenPenalty + ((from.flags & LayoutScratch::SPLIT) ? doubleHyphenPenalty : 0);
         }
       }
+      if (demerits < best) {
+        best = demerits;
+        to.prev = static_cast<uint32_t>(i);
+      }
+    }
+    if (best != std::numeric_limits<int64_t>::max()) {
+      to.cost = clampCost(best);
+      newestActive = index;
+    }
+  };
+
+  // Whether the line from active breakpoint `index` no longer fits once it reaches position `endX`
+  const auto overflows = [&](const size_t index, const int32_t endX) {
+    return endX - scratch.lineStart(index) > (index == 0 ? firstLineWidth : pageWidth);
+  };
 
-      if (cost < dp[i]) {
-        dp[i] = cost;
-        ans[i] = j;  // j is the index of the last word in this optimal line
+  for (size_t w = 0; w < wordCount; ++w) {
+    const int32_t wordEndX = scratch.wordX[w] + scratch.wordWidths[w];
+
+    if (scratch.splitWords[w]) {
+      if (scratch.splitWords[w] == LayoutScratch::SPLIT_MARKED) {
+        measureSplitPoints(scratch, renderer, fontId, w, w == 0 ? firstLineWidth : pageWidth);
+      }
+      for (uint32_t i = scratch.splitBegin[w]; i < scratch.splitEnd[w]; ++i) {
+        nodes.push_back(scratch.splitPoints[i]);
+        relax(nodes.size() - 1, false);
       }
     }
 
-    // Handle oversized word: if no valid configuration found, force single-word line
-    // This prevents cascade failure where one oversized word breaks all preceding words
-    if (dp[i] == MAX_COST) {
-      ans[i] = i;  // Just this word on its own line
-      // Inherit cost from next word to allow subsequent words to find valid configurations
-      if (i + 1 < static_cast<int>(totalWordCount)) {
-        dp[i] = dp[i + 1];
+    // Cannot break after a word if the next word attaches to it (continuation group)
+    const bool isLastWord = w + 1 == wordCount;
+    const bool canBreak = isLastWord || !wordContinues[w + 1];
+    nodes.push_back({static_cast<uint32_t>(w), 0, MAX_COST, 0, 0, 0,
+                     static_cast<uint8_t>(canBreak ? LayoutScratch::CAN_BREAK : 0),
+                     isLastWord ? wordEndX : scratch.wordX[w + 1]});
+    const size_t wordEnd = nodes.size() - 1;
+    const size_t newest = newestActive;
+    if (canBreak) {
+      relax(wordEnd, isLastWord);
+    }
+
+    // Retire the breakpoints whose lines overflow here; every later breakpoint lies further right
+    while (firstActive < wordEnd && overflows(firstActive, wordEndX)) {
+      ++firstActive;
+    }
+
+    // Handle oversized word: when nothing fits anymore, end an overfull line at the first legal break after the newest
+    // breakpoint. This prevents cascade failure where one oversized word breaks all preceding words.
+    if (newestActive < firstActive) {
+      if (canBreak) {
+        nodes[wordEnd].prev = static_cast<uint32_t>(newest);
+        nodes[wordEnd].cost = clampCost(static_cast<int64_t>(nodes[newest].cost) + OVERFULL_PENALTY);
+        firstActive = newestActive = wordEnd;
       } else {
-        dp[i] = 0;
+        firstActive = newest;
       }
     }
   }
 
-  // Stores the index of the word that starts the next line (last_word_index + 1)
-  std::vector<size_t> lineBreakIndices;
-  size_t currentWordIndex = 0;
-
-  while (currentWordIndex < totalWordCount) {
-    size_t nextBreakIndex = ans[currentWordIndex] + 1;
+  // Walk back from the end of the last word to collect the chosen breakpoints
+  scratch.lineEnds.clear();
+  for (size_t i = nodes.size() - 1; i != 0; i = nodes[i].prev) {
+    scratch.lineEnds.push_back(static_cast<uint32_t>(i));
+  }
+  std::reverse(scratch.lineEnds.begin(), scratch.lineEnds.end());
+}
 
-    // Safety check: prevent infinite loop if nextBreakIndex doesn't advance
-    if (nextBreakIndex <= currentWordIndex) {
-      // Force advance by at least one word to avoid infinite loop
-      nextBreakIndex = currentWordIndex + 1;
+// Breaks the paragraph without hyphenation first. If that leaves lines looser than the hyphen penalty, the words that
+// open the following lines get their hyphenation points and the paragraph is broken again, so hyphenation patterns
+// only run for the few words that can actually improve a line.
+void ParsedText::computeLineBreaks(LayoutScratch& scratch, const GfxRenderer& renderer, const int fontId,
+                                   const int pageWidth, const int spaceWidth) const {
+  const size_t wordCount = words.size();
+  const int firstLineWidth = pageWidth - firstLineIndent();
+
+  // Words wider than a whole line are always split, whether or not hyphenation is enabled
+  scratch.splitWords.assign(wordCount, 0);
+  scratch.splitBegin.assign(wordCount, 0);
+  scratch.splitEnd.assign(wordCount, 0);
+  scratch.splitPoints.clear();
+  for (size_t w = 0; w < wordCount; ++w) {
+    if (scratch.wordWidths[w] > (w == 0 ? firstLineWidth : pageWidth)) {
+      scratch.splitWords[w] = LayoutScratch::SPLIT_MARKED;
     }
-
-    lineBreakIndices.push_back(nextBreakIndex);
-    currentWordIndex = nextBreakIndex;
+  }
+  findBreakpoints(scratch, renderer, fontId, pageWidth, spaceWidth);
+  if (!hyphenationEnabled) {
+    return;
   }
 
-  return lineBreakIndices;
+  for (int pass = 0; pass < MAX_HYPHENATION_PASSES; ++pass) {
+    bool anyLooseLine = false;
+    for (size_t line = 0; line + 1 < scratch.lineEnds.size(); ++line) {
+      const size_t startIndex = line > 0 ? scratch.lineEnds[line - 1] : 0;
+      const size_t endIndex = scratch.lineEnds[line];
+      const auto& end = scratch.nodes[endIndex];
+      if (end.flags & LayoutScratch::SPLIT) {
+        continue;
+      }
+      const int slack =
+          (line == 0 ? firstLineWidth : pageWidth) - (scratch.lineEnd(endIndex) - scratch.lineStart(startIndex));
+      if (slack > HYPHEN_PENALTY_SPACES * spaceWidth && !scratch.splitWords[end.word + 1]) {
+        scratch.splitWords[end.word + 1] = LayoutScratch::SPLIT_MARKED;
+        anyLooseLine = true;
+      }
+    }
+    if (!anyLooseLine) {
+      break;
+    }
+    findBreakpoints(scratch, renderer, fontId, pageWidth, spaceWidth);
+  }
 }
 
 void ParsedText::applyParagraphIndent() {
@@ -270,187 +421,54 @@ void ParsedText::applyParagraphIndent() {
   }
 }
 
-// Builds break indices while opportunistically splitting the word that would overflow the current line.
-std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& renderer, const int fontId,
-                                                            const int pageWidth, const int spaceWidth,
-                                                            std::vector<uint16_t>& wordWidths,
-                                                            std::vector<bool>& continuesVec) {
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const int firstLineIndent =
-      blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
-
-  std::vector<size_t> lineBreakIndices;
-  size_t currentIndex = 0;
-  bool isFirstLine = true;
-
-  while (currentIndex < wordWidths.size()) {
-    const size_t lineStart = currentIndex;
-    int lineWidth = 0;
-
-    // First line has reduced width due to text-indent
-    const int effectivePageWidth = isFirstLine ? pageWidth - firstLineIndent : pageWidth;
-
-    // Consume as many words as possible for current line, splitting when prefixes fit
-    while (currentIndex < wordWidths.size()) {
-      const bool isFirstWord = currentIndex == lineStart;
-      int spacing = 0;
-      if (!isFirstWord && !continuesVec[currentIndex]) {
-        spacing = spaceWidth;
-        spacing += renderer.getSpaceKernAdjust(fontId, lastCodepoint(words[currentIndex - 1]),
-                                               firstCodepoint(words[currentIndex]), wordStyles[currentIndex - 1]);
-      } else if (!isFirstWord && continuesVec[currentIndex]) {
-        // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
-        spacing = renderer.getKerning(fontId, lastCodepoint(words[currentIndex - 1]),
-                                      firstCodepoint(words[currentIndex]), wordStyles[currentIndex - 1]);
-      }
-      const int candidateWidth = spacing + wordWidths[currentIndex];
-
-      // Word fits on current line
-      if (lineWidth + candidateWidth <= effectivePageWidth) {
-        lineWidth += candidateWidth;
-        ++currentIndex;
-        continue;
-      }
-
-      // Word would overflow — try to split based on hyphenation points
-      const int availableWidth = effectivePageWidth - lineWidth - spacing;
-      const bool allowFallbackBreaks = isFirstWord;  // Only for first word on line
-
-      if (availableWidth > 0 &&
-          hyphenateWordAtIndex(currentIndex, availableWidth, renderer, fontId, wordWidths, allowFallbackBreaks)) {
-        // Prefix now fits; append it to this line and move to next line
-        lineWidth += spacing + wordWidths[currentIndex];
-        ++currentIndex;
-        break;
-      }
-
-      // Could not split: force at least one word per line to avoid infinite loop
-      if (currentIndex == lineStart) {
-        lineWidth += candidateWidth;
-        ++currentIndex;
-      }
-      break;
-    }
-
-    // Don't break before a continuation word (e.g., orphaned "?" after "question").
-    // Backtrack to the start of the continuation group so the whole group moves to the next line.
-    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && continuesVec[currentIndex]) {
-      --currentIndex;
-    }
-
-    lineBreakIndices.push_back(currentIndex);
-    isFirstLine = false;
-  }
-
-  return lineBreakIndices;
-}
-
-// Splits words[wordIndex] into prefix (adding a hyphen only when needed) and remainder when a legal breakpoint fits the
-// available width.
-bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availableWidth, const GfxRenderer& renderer,
-                                      const int fontId, std::vector<uint16_t>& wordWidths,
-                                      const bool allowFallbackBreaks) {
-  // Guard against invalid indices or zero available width before attempting to split.
-  if (availableWidth <= 0 || wordIndex >= words.size()) {
-    return false;
-  }
-
-  const std::string& word = words[wordIndex];
-  const auto style = wordStyles[wordIndex];
-
-  // Collect candidate breakpoints (byte offsets and hyphen requirements).
-  auto breakInfos = Hyphenator::breakOffsets(word, allowFallbackBreaks);
-  if (breakInfos.empty()) {
-    return false;
-  }
-
-  size_t chosenOffset = 0;
-  int chosenWidth = -1;
-  bool chosenNeedsHyphen = true;
+void ParsedText::extractLine(const LayoutScratch& scratch, const size_t lineIndex, const int pageWidth,
+                             const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
+                             const GfxRenderer& renderer, const int fontId) {
+  const size_t startIndex = lineIndex > 0 ? scratch.lineEnds[lineIndex - 1] : 0;
+  const auto& start = scratch.nodes[startIndex];
+  const auto& end = scratch.nodes[scratch.lineEnds[lineIndex]];
+
+  // A line starts either at a word or at the rest of a word split at the end of the previous line, and ends either
+  // after a word or at a split inside one
+  const bool startsWithRest = startIndex > 0 && (start.flags & LayoutScratch::SPLIT);
+  const bool endsWithSplit = end.flags & LayoutScratch::SPLIT;
+  const size_t firstWord = startIndex == 0 ? 0 : (startsWithRest ? start.word : start.word + 1);
+  const size_t lastWord = end.word;
+  const size_t lineWordCount = lastWord - firstWord + 1;
 
-  // Iterate over each legal breakpoint and retain the widest prefix that still fits.
-  for (const auto& info : breakInfos) {
-    const size_t offset = info.byteOffset;
-    if (offset == 0 || offset >= word.size()) {
+  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
+  const bool isFirstLine = lineIndex == 0;
+  const int firstLineIndent = isFirstLine ? this->firstLineIndent() : 0;
+
+  // Build line words and their widths. Whole words are moved out of the paragraph; pieces of split words are copied
+  // because the paragraph keeps the word until both of its lines have been extracted.
+  std::vector<std::string> lineWords;
+  std::vector<uint16_t> lineWordWidths;
+  lineWords.reserve(lineWordCount);
+  lineWordWidths.reserve(lineWordCount);
+  for (size_t wordIdx = firstWord; wordIdx <= lastWord; wordIdx++) {
+    const bool isRest = startsWithRest && wordIdx == firstWord;
+    const bool isPrefix = endsWithSplit && wordIdx == lastWord;
+    if (!isRest && !isPrefix) {
+      lineWords.push_back(std::move(words[wordIdx]));
+      lineWordWidths.push_back(scratch.wordWidths[wordIdx]);
       continue;
     }
 
-    const bool needsHyphen = info.requiresInsertedHyphen;
-    const int prefixWidth = measureWordWidth(renderer, fontId, word.substr(0, offset), style, needsHyphen);
-    if (prefixWidth > availableWidth || prefixWidth <= chosenWidth) {
-      continue;  // Skip if too wide or not an improvement
+    const size_t pieceStart = isRest ? start.splitOffset : 0;
+    const size_t pieceEnd = isPrefix ? end.splitOffset : words[wordIdx].size();
+    std::string piece;
+    buildWordPiece(words[wordIdx], pieceStart, pieceEnd, isPrefix && (end.flags & LayoutScratch::INSERTED_HYPHEN),
+                   piece);
+    if (isRest && isPrefix) {
+      // A word longer than a whole line, split on both sides
+      lineWordWidths.push_back(measureText(scratch.widthCache, renderer, fontId, piece.c_str(), wordStyles[wordIdx]));
+    } else {
+      lineWordWidths.push_back(isRest ? start.suffixWidth : end.prefixWidth);
     }
-
-    chosenWidth = prefixWidth;
-    chosenOffset = offset;
-    chosenNeedsHyphen = needsHyphen;
-  }
-
-  if (chosenWidth < 0) {
-    // No hyphenation point produced a prefix that fits in the remaining space.
-    return false;
-  }
-
-  // Split the word at the selected breakpoint and append a hyphen if required.
-  std::string remainder = word.substr(chosenOffset);
-  words[wordIndex].resize(chosenOffset);
-  if (chosenNeedsHyphen) {
-    words[wordIndex].push_back('-');
+    lineWords.push_back(std::move(piece));
   }
 
-  // Insert the remainder word (with matching style and continuation flag) directly after the prefix.
-  words.insert(words.begin() + wordIndex + 1, remainder);
-  wordStyles.insert(wordStyles.begin() + wordIndex + 1, style);
-
-  // Continuation flag handling after splitting a word into prefix + remainder.
-  //
-  // The prefix keeps the original word's continuation flag so that no-break-space groups
-  // stay linked. The remainder always gets continues=false because it starts on the next
-  // line and is not attached to the prefix.
-  //
-  // Example: "200&#xA0;Quadratkilometer" produces tokens:
-  //   [0] "200"               continues=false
-  //   [1] " "                 continues=true
-  //   [2] "Quadratkilometer"  continues=true   <-- the word being split
-  //
-  // After splitting "Quadratkilometer" at "Quadrat-" / "kilometer":
-  //   [0] "200"         continues=false
-  //   [1] " "           continues=true
-  //   [2] "Quadrat-"    continues=true   (KEPT — still attached to the no-break group)
-  //   [3] "kilometer"   continues=false  (NEW — starts fresh on the next line)
-  //
-  // This lets the backtracking loop keep the entire prefix group ("200 Quadrat-") on one
-  // line, while "kilometer" moves to the next line.
-  // wordContinues[wordIndex] is intentionally left unchanged — the prefix keeps its original attachment.
-  wordContinues.insert(wordContinues.begin() + wordIndex + 1, false);
-
-  // Update cached widths to reflect the new prefix/remainder pairing.
-  wordWidths[wordIndex] = static_cast<uint16_t>(chosenWidth);
-  const uint16_t remainderWidth = measureWordWidth(renderer, fontId, remainder, style);
-  wordWidths.insert(wordWidths.begin() + wordIndex + 1, remainderWidth);
-  return true;
-}
-
-void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
-                             const std::vector<uint16_t>& wordWidths, const std::vector<bool>& continuesVec,
-                             const std::vector<size_t>& lineBreakIndices,
-                             const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                             const GfxRenderer& renderer, const int fontId) {
-  const size_t lineBreak = lineBreakIndices[breakIndex];
-  const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
-  const size_t lineWordCount = lineBreak - lastBreakAt;
-
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const bool isFirstLine = breakIndex == 0;
-  const int firstLineIndent =
-      isFirstLine && blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
-
   // Calculate total word width for this line, count actual word gaps,
   // and accumulate total natural gap widths (including space kerning adjustments).
   int lineWordWidthSum = 0;
@@ -458,26 +476,19 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   int totalNaturalGaps = 0;
 
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
-    lineWordWidthSum += wordWidths[lastBreakAt + wordIdx];
+    lineWordWidthSum += lineWordWidths[wordIdx];
     // Count gaps: each word after the first creates a gap, unless it's a continuation
-    if (wordIdx > 0 && !continuesVec[lastBreakAt + wordIdx]) {
-      actualGapCount++;
-      int naturalGap = spaceWidth;
-      naturalGap += renderer.getSpaceKernAdjust(fontId, lastCodepoint(words[lastBreakAt + wordIdx - 1]),
-                                                firstCodepoint(words[lastBreakAt + wordIdx]),
-                                                wordStyles[lastBreakAt + wordIdx - 1]);
-      totalNaturalGaps += naturalGap;
-    } else if (wordIdx > 0 && continuesVec[lastBreakAt + wordIdx]) {
-      // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
-      totalNaturalGaps +=
-          renderer.getKerning(fontId, lastCodepoint(words[lastBreakAt + wordIdx - 1]),
-                              firstCodepoint(words[lastBreakAt + wordIdx]), wordStyles[lastBreakAt + wordIdx - 1]);
+    if (wordIdx > 0) {
+      if (!wordContinues[firstWord + wordIdx]) {
+        actualGapCount++;
+      }
+      totalNaturalGaps += scratch.gaps[firstWord + wordIdx];
     }
   }
 
   // Calculate spacing (account for indent reducing effective page width on first line)
   const int effectivePageWidth = pageWidth - firstLineIndent;
-  const bool isLastLine = breakIndex == lineBreakIndices.size() - 1;
+  const bool isLastLine = lineIndex == scratch.lineEnds.size() - 1;
 
   // For justified text, compute per-gap extra to distribute remaining space evenly
   const int spareSpace = effectivePageWidth - lineWordWidthSum - totalNaturalGaps;
@@ -501,32 +512,17 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
     lineXPos.push_back(xpos);
 
-    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && continuesVec[lastBreakAt + wordIdx + 1];
-    if (nextIsContinuation) {
-      int advance = wordWidths[lastBreakAt + wordIdx];
-      // Cross-boundary kerning for continuation words (e.g. nonbreaking spaces, attached punctuation)
-      advance +=
-          renderer.getKerning(fontId, lastCodepoint(words[lastBreakAt + wordIdx]),
-                              firstCodepoint(words[lastBreakAt + wordIdx + 1]), wordStyles[lastBreakAt + wordIdx]);
-      xpos += advance;
-    } else {
-      int gap = spaceWidth;
-      if (wordIdx + 1 < lineWordCount) {
-        gap += renderer.getSpaceKernAdjust(fontId, lastCodepoint(words[lastBreakAt + wordIdx]),
-                                           firstCodepoint(words[lastBreakAt + wordIdx + 1]),
-                                           wordStyles[lastBreakAt + wordIdx]);
-      }
-      if (blockStyle.alignment == CssTextAlign::Justify && !isLastLine) {
-        gap += justifyExtra;
+    int advance = lineWordWidths[wordIdx];
+    if (wordIdx + 1 < lineWordCount) {
+      advance += scratch.gaps[firstWord + wordIdx + 1];
+      if (!wordContinues[firstWord + wordIdx + 1] && blockStyle.alignment == CssTextAlign::Justify && !isLastLine) {
+        advance += justifyExtra;
       }
-      xpos += wordWidths[lastBreakAt + wordIdx] + gap;
     }
+    xpos += advance;
   }
 
-  // Build line data by moving from the original vectors using index range
-  std::vector<std::string> lineWords(std::make_move_iterator(words.begin() + lastBreakAt),
-                                     std::make_move_iterator(words.begin() + lineBreak));
-  std::vector<EpdFontFamily::Style> lineWordStyles(wordStyles.begin() + lastBreakAt, wordStyles.begin() + lineBreak);
+  std::vector<EpdFontFamily::Style> lineWordStyles(wordStyles.begin() + firstWord, wordStyles.begin() + lastWord + 1);
 
   for (auto& word : lineWords) {
     if (containsSoftHyphen(word)) {
@@ -11,6 +11,8 @@
 #include "blocks/TextBlock.h"
 
 class GfxRenderer;
+class WordWidthCache;
+struct LayoutScratch;
 
 class ParsedText {
   std::vector<std::string> words;
@@ -21,18 +23,17 @@ class ParsedText {
   bool hyphenationEnabled;
 
   void applyParagraphIndent();
-  std::vector<size_t> computeLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth, int spaceWidth,
-                                        std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec);
-  std::vector<size_t> computeHyphenatedLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth,
-                                                  int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec);
-  bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const GfxRenderer& renderer, int fontId,
-                            std::vector<uint16_t>& wordWidths, bool allowFallbackBreaks);
-  void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
-                   const std::vector<bool>& continuesVec, const std::vector<size_t>& lineBreakIndices,
+  int firstLineIndent() const;
+  void measureWords(LayoutScratch& scratch, const GfxRenderer& renderer, int fontId, int spaceWidth) const;
+  void measureSplitPoints(LayoutScratch& scratch, const GfxRenderer& renderer, int fontId, size_t w,
+                          int lineWidth) const;
+  void findBreakpoints(LayoutScratch& scratch, const GfxRenderer& renderer, int fontId, int pageWidth,
+                       int spaceWidth) const;
+  void computeLineBreaks(LayoutScratch& scratch, const GfxRenderer& renderer, int fontId, int pageWidth,
+                         int spaceWidth) const;
+  void extractLine(const LayoutScratch& scratch, size_t lineIndex, int pageWidth,
                    const std::function<void(std::shared_ptr<TextBlock>)>& processLine, const GfxRenderer& renderer,
                    int fontId);
-  std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
 
  public:
   explicit ParsedText(const bool extraParagraphSpacing, const bool hyphenationEnabled = false,
@@ -45,7 +46,10 @@ class ParsedText {
   BlockStyle& getBlockStyle() { return blockStyle; }
   size_t size() const { return words.size(); }
   bool isEmpty() const { return words.empty(); }
+  // Words are measured through `widthCache` when given, which may be shared by every paragraph of a section. The
+  // line breaking works in `layoutScratch` when given, so that its buffers serve the paragraphs of one parse.
   void layoutAndExtractLines(const GfxRenderer& renderer, int fontId, uint16_t viewportWidth,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                             bool includeLastLine = true);
+                             bool includeLastLine = true, WordWidthCache* widthCache = nullptr,
+                             LayoutScratch* layoutScratch = nullptr);
 };
\ No newline at end of file
@@ -1,22 +1,41 @@
 #include "Section.h"
 
+#include <Arduino.h>
 #include <HalStorage.h>
 #include <Logging.h>
 #include <Serialization.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+
 #include "Epub/css/CssParser.h"
 #include "Page.h"
+#include "SectionLayoutCache.h"
+#include "SectionPipeline.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 14;
+constexpr uint8_t SECTION_FILE_VERSION = 15;
+// Free heap left untouched by page prefetching
+constexpr uint32_t MIN_FREE_HEAP_FOR_PREFETCH = 32 * 1024;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint32_t);
 }  // namespace
 
-uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
+void Section::selectLayout(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                           const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                           const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
+  const uint32_t fingerprint =
+      SectionLayoutCache::fingerprint(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                                      viewportHeight, hyphenationEnabled, embeddedStyle);
+  filePath =
+      SectionLayoutCache::directory(epub->getCachePath(), fingerprint) + "/" + std::to_string(spineIndex) + ".bin";
+}
+
+uint32_t Section::onPageComplete(std::unique_ptr<PageBuilder> page) {
   if (!file) {
     LOG_ERR("SCT", "File not open for writing page %d", pageCount);
     return 0;
@@ -62,6 +81,11 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
 bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                               const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                               const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
+  closeFile();
+  partial = false;
+  partialPagePositions.clear();
+  selectLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+               hyphenationEnabled, embeddedStyle);
   if (!Storage.openFileForRead("SCT", filePath, file)) {
     return false;
   }
@@ -104,14 +128,74 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
     }
   }
 
-  serialization::readPod(file, pageCount);
+  uint16_t filePageCount;
+  uint32_t fileLutOffset;
+  serialization::readPod(file, filePageCount);
+  serialization::readPod(file, fileLutOffset);
   file.close();
+  // The LUT offset is written last, so a file without one is still being built (or its build never finished)
+  if (fileLutOffset == 0) {
+    LOG_DBG("SCT", "Deserialization failed: Section file is incomplete");
+    return false;
+  }
+  pageCount = filePageCount;
   LOG_DBG("SCT", "Deserialization succeeded: %d pages", pageCount);
   return true;
 }
 
+bool Section::loadPartialSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                                     const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                     const uint16_t viewportHeight, const bool hyphenationEnabled,
+                                     const bool embeddedStyle, const uint16_t committedPages) {
+  if (partial && committedPages <= partialPagePositions.size()) {
+    return true;
+  }
+  if (!partial) {
+    selectLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+                 hyphenationEnabled, embeddedStyle);
+  }
+
+  // Reopen so the handle sees what the build has flushed since
+  if (file) {
+    file.close();
+  }
+  if (!Storage.openFileForRead("SCT", filePath, file)) {
+    return false;
+  }
+  if (!partial) {
+    uint8_t version;
+    serialization::readPod(file, version);
+    if (version != SECTION_FILE_VERSION) {
+      file.close();
+      LOG_ERR("SCT", "Partial file has unknown version %u", version);
+      return false;
+    }
+    partialPagePositions.clear();
+    partialEnd = HEADER_SIZE;
+    partial = true;
+  }
+
+  const size_t fileSize = file.size();
+  while (partialPagePositions.size() < committedPages && partialEnd + sizeof(uint32_t) <= fileSize) {
+    file.seek(partialEnd);
+    uint32_t pageSize;
+    serialization::readPod(file, pageSize);
+    if (partialEnd + sizeof(uint32_t) + pageSize > fileSize) {
+      break;
+    }
+    partialPagePositions.push_back(partialEnd);
+    partialEnd += sizeof(uint32_t) + pageSize;
+  }
+
+  pageCount = partialPagePositions.size();
+  LOG_DBG("SCT", "Partial section file: %d of %d committed pages readable", pageCount, committedPages);
+  return pageCount > 0 || committedPages == 0;
+}
+
 // Your updated class method (assuming you are using the 'SD' object, which is a wrapper for a specific filesystem)
-bool Section::clearCache() const {
+bool Section::clearCache() {
+  closeFile();
+
   if (!Storage.exists(filePath.c_str())) {
     LOG_DBG("SCT", "Cache does not exist, no action needed");
     return true;
@@ -126,55 +210,32 @@ bool Section::clearCache() const {
   return true;
 }
 
+void Section::closeFile() {
+  pageCache.clear();
+  if (file) {
+    file.close();
+  }
+}
+
 bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
-                                const std::function<void()>& popupFn) {
-  const auto localPath = epub->getSpineItem(spineIndex).href;
-  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
+                                const std::function<void()>& popupFn, const std::function<bool()>& abortFn,
+                                const std::function<void(uint16_t)>& pagesCommittedFn) {
+  // The spine entry is resolved when the section is constructed, so a build running off the render task does not
+  // share the book.bin handle with the reader
+  const auto& localPath = itemHref;
 
-  // Create cache directory if it doesn't exist
+  // Create the cache directories if they don't exist
   {
     const auto sectionsDir = epub->getCachePath() + "/sections";
     Storage.mkdir(sectionsDir.c_str());
+    selectLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+                 hyphenationEnabled, embeddedStyle);
+    Storage.mkdir(filePath.substr(0, filePath.find_last_of('/')).c_str());
   }
 
-  // Retry logic for SD card timing issues
-  bool success = false;
-  uint32_t fileSize = 0;
-  for (int attempt = 0; attempt < 3 && !success; attempt++) {
-    if (attempt > 0) {
-      LOG_DBG("SCT", "Retrying stream (attempt %d)...", attempt + 1);
-      delay(50);  // Brief delay before retry
-    }
-
-    // Remove any incomplete file from previous attempt before retrying
-    if (Storage.exists(tmpHtmlPath.c_str())) {
-      Storage.remove(tmpHtmlPath.c_str());
-    }
-
-    FsFile tmpHtml;
-    if (!Storage.openFileForWrite("SCT", tmpHtmlPath, tmpHtml)) {
-      continue;
-    }
-    success = epub->readItemContentsToStream(localPath, tmpHtml, 1024);
-    fileSize = tmpHtml.size();
-    tmpHtml.close();
-
-    // If streaming failed, remove the incomplete file immediately
-    if (!success && Storage.exists(tmpHtmlPath.c_str())) {
-      Storage.remove(tmpHtmlPath.c_str());
-      LOG_DBG("SCT", "Removed incomplete temp file after failed attempt");
-    }
-  }
-
-  if (!success) {
-    LOG_ERR("SCT", "Failed to stream item contents to temp file after retries");
-    return false;
-  }
-
-  LOG_DBG("SCT", "Streamed temp HTML to %s (%d bytes)", tmpHtmlPath.c_str(), fileSize);
-
+  closeFile();
   if (!Storage.openFileForWrite("SCT", filePath, file)) {
     return false;
   }
@@ -197,16 +258,41 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     }
   }
 
+  // Pages are written to the section file on another task while the parser lays out the next ones. Until finish()
+  // only that task touches the file, pageCount and the LUT. If someone reads the file while it grows, every page is
+  // flushed before it is reported. A page that cannot be written abandons the build: later pages are dropped and the
+  // parser is stopped, so the section is not cached with a hole in it.
+  std::atomic<bool> pageWriteFailed{false};
+  PageWriteStage pageWriter([this, &lut, &pagesCommittedFn, &pageWriteFailed](std::unique_ptr<PageBuilder> page) {
+    if (pageWriteFailed) {
+      return;
+    }
+    const uint32_t position = this->onPageComplete(std::move(page));
+    if (position == 0) {
+      pageWriteFailed = true;
+      return;
+    }
+    lut.emplace_back(position);
+    if (pagesCommittedFn) {
+      file.flush();
+      pagesCommittedFn(pageCount);
+    }
+  });
+  pageWriter.start();
+
+  const std::function<bool()> abortBuild = [&pageWriteFailed, &abortFn] {
+    return pageWriteFailed || (abortFn && abortFn());
+  };
   ChapterHtmlSlimParser visitor(
-      epub, tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+      epub, localPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
       viewportHeight, hyphenationEnabled,
-      [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      embeddedStyle, contentBase, imageBasePath, popupFn, cssParser);
+      [&pageWriter](std::unique_ptr<PageBuilder> page) { pageWriter.submit(std::move(page)); }, embeddedStyle,
+      contentBase, imageBasePath, popupFn, cssParser, abortBuild);
   Hyphenator::setPreferredLanguage(epub->getLanguage());
-  success = visitor.parseAndBuildPages();
+  const bool success = visitor.parseAndBuildPages();
+  pageWriter.finish();
 
-  Storage.remove(tmpHtmlPath.c_str());
-  if (!success) {
+  if (!success || pageWriteFailed) {
     LOG_ERR("SCT", "Failed to parse XML and build pages");
     file.close();
     Storage.remove(filePath.c_str());
@@ -217,23 +303,11 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   }
 
   const uint32_t lutOffset = file.position();
-  bool hasFailedLutRecords = false;
   // Write LUT
   for (const uint32_t& pos : lut) {
-    if (pos == 0) {
-      hasFailedLutRecords = true;
-      break;
-    }
     serialization::writePod(file, pos);
   }
 
-  if (hasFailedLutRecords) {
-    LOG_ERR("SCT", "Failed to write LUT due to invalid page positions");
-    file.close();
-    Storage.remove(filePath.c_str());
-    return false;
-  }
-
   // Go back and write LUT offset
   file.seek(HEADER_SIZE - sizeof(uint32_t) - sizeof(pageCount));
   serialization::writePod(file, pageCount);
@@ -245,20 +319,94 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   return true;
 }
 
-std::unique_ptr<Page> Section::loadPageFromSectionFile() {
+bool Section::openForPages() {
+  if (file) {
+    return true;
+  }
   if (!Storage.openFileForRead("SCT", filePath, file)) {
+    return false;
+  }
+  if (!partial) {
+    file.seek(HEADER_SIZE - sizeof(uint32_t));
+    serialization::readPod(file, lutOffset);
+  }
+  return true;
+}
+
+std::unique_ptr<Page> Section::readPage(const int index, const uint32_t maxBytes) {
+  if (!openForPages()) {
     return nullptr;
   }
 
-  file.seek(HEADER_SIZE - sizeof(uint32_t));
-  uint32_t lutOffset;
-  serialization::readPod(file, lutOffset);
-  file.seek(lutOffset + sizeof(uint32_t) * currentPage);
   uint32_t pagePos;
-  serialization::readPod(file, pagePos);
+  if (partial) {
+    if (index < 0 || index >= static_cast<int>(partialPagePositions.size())) {
+      return nullptr;
+    }
+    pagePos = partialPagePositions[index];
+  } else {
+    file.seek(lutOffset + sizeof(uint32_t) * index);
+    serialization::readPod(file, pagePos);
+  }
+  file.seek(pagePos);
+  // Every page starts with its size, so an oversized page is skipped before anything is allocated for it
+  uint32_t pageSize;
+  serialization::readPod(file, pageSize);
+  if (pageSize > maxBytes) {
+    return nullptr;
+  }
   file.seek(pagePos);
+  return Page::deserialize(file);
+}
 
-  auto page = Page::deserialize(file);
-  file.close();
+std::shared_ptr<Page> Section::loadPageFromSectionFile() {
+  for (const auto& cached : pageCache) {
+    if (cached.index == currentPage) {
+      return cached.page;
+    }
+  }
+
+  std::shared_ptr<Page> page = readPage(currentPage, UINT32_MAX);
+  if (page) {
+    pageCache.push_back({currentPage, page});
+  }
   return page;
 }
+
+void Section::prefetchPages(const int radius, const size_t budgetBytes) {
+  const int center = currentPage;
+  pageCache.erase(std::remove_if(pageCache.begin(), pageCache.end(),
+                                 [center, radius](const CachedPage& cached) {
+                                   return std::abs(cached.index - center) > radius;
+                                 }),
+                  pageCache.end());
+
+  size_t used = 0;
+  for (const auto& cached : pageCache) {
+    // Glyph runs only pay off for the page on screen, the others are shaped again if they are shown
+    if (cached.index != center) {
+      cached.page->releaseShapedGlyphs();
+    }
+    used += cached.page->getMemoryUsage();
+  }
+
+  // Next page first, then the previous one, then further out
+  for (int distance = 1; distance <= radius; distance++) {
+    for (const int index : {center + distance, center - distance}) {
+      if (index < 0 || index >= pageCount ||
+          std::any_of(pageCache.begin(), pageCache.end(),
+                      [index](const CachedPage& cached) { return cached.index == index; })) {
+        continue;
+      }
+      if (used >= budgetBytes || ESP.getFreeHeap() < MIN_FREE_HEAP_FOR_PREFETCH) {
+        return;
+      }
+      std::shared_ptr<Page> page = readPage(index, budgetBytes - used);
+      if (!page) {
+        return;
+      }
+      used += page->getMemoryUsage();
+      pageCache.push_back({index, std::move(page)});
+    }
+  }
+}
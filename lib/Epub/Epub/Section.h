@@ -1,23 +1,47 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "Epub.h"
 
 class Page;
+class PageBuilder;
 class GfxRenderer;
 
 class Section {
   std::shared_ptr<Epub> epub;
   const int spineIndex;
   GfxRenderer& renderer;
+  std::string itemHref;
+  // sections/<layout fingerprint>/<spineIndex>.bin, chosen by the layout passed to the load and create calls
   std::string filePath;
+  // Written while the section is built; afterwards kept open for reading pages
   FsFile file;
+  uint32_t lutOffset = 0;
+  // Set while reading a file whose build is still running (see loadPartialSectionFile). Such a file has no LUT yet,
+  // so its pages are found by following their size prefixes.
+  bool partial = false;
+  std::vector<uint32_t> partialPagePositions;
+  uint32_t partialEnd = 0;  // Offset just past the last page in partialPagePositions
+
+  // Decoded pages around currentPage, so a page turn usually finds its page here (see prefetchPages)
+  struct CachedPage {
+    int index;
+    std::shared_ptr<Page> page;
+  };
+  std::vector<CachedPage> pageCache;
 
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
                               bool embeddedStyle);
-  uint32_t onPageComplete(std::unique_ptr<Page> page);
+  void selectLayout(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                    uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
+  uint32_t onPageComplete(std::unique_ptr<PageBuilder> page);
+  bool openForPages();
+  // Reads page `index` from the section file, or returns nullptr if it fails or needs more than `maxBytes`
+  std::unique_ptr<Page> readPage(int index, uint32_t maxBytes);
+  void closeFile();
 
  public:
   uint16_t pageCount = 0;
@@ -27,13 +51,29 @@ class Section {
       : epub(epub),
         spineIndex(spineIndex),
         renderer(renderer),
-        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin") {}
-  ~Section() = default;
+        itemHref(epub->getSpineItem(spineIndex).href) {}
+  ~Section() { closeFile(); }
   bool loadSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                        uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
-  bool clearCache() const;
+  bool clearCache();
+  int getSpineIndex() const { return spineIndex; }
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
-                         const std::function<void()>& popupFn = nullptr);
-  std::unique_ptr<Page> loadPageFromSectionFile();
+                         const std::function<void()>& popupFn = nullptr,
+                         const std::function<bool()>& abortFn = nullptr,
+                         const std::function<void(uint16_t)>& pagesCommittedFn = nullptr);
+  // Opens the file of a build that is still running on another Section with its first `committedPages` pages
+  // readable, as reported by that build's pagesCommittedFn. Call it again as more pages are committed; once the build
+  // has finished, loadSectionFile() switches to the complete file.
+  bool loadPartialSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing,
+                              uint8_t paragraphAlignment, uint16_t viewportWidth, uint16_t viewportHeight,
+                              bool hyphenationEnabled, bool embeddedStyle, uint16_t committedPages);
+  // True while pageCount only counts the pages committed so far
+  bool isPartial() const { return partial; }
+  // Returns currentPage, from the page cache when it was prefetched
+  std::shared_ptr<Page> loadPageFromSectionFile();
+  // Decodes the pages up to `radius` away from currentPage, nearest first, and drops cached pages outside that window.
+  // Stops once the cached pages would use more than `budgetBytes` or free heap runs low. Meant for the idle time after
+  // a page has been displayed.
+  void prefetchPages(int radius, size_t budgetBytes);
 };
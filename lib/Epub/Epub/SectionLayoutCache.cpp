@@ -0,0 +1,148 @@
+#include "SectionLayoutCache.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+constexpr uint8_t INDEX_FILE_VERSION = 1;
+// Index entries beyond this are dropped; far more than the setting allows
+constexpr uint8_t MAX_INDEX_ENTRIES = 16;
+
+// FNV-1a
+template <typename T>
+void mix(uint32_t& hash, const T& value) {
+  uint8_t bytes[sizeof(T)];
+  memcpy(bytes, &value, sizeof(T));
+  for (const uint8_t byte : bytes) {
+    hash = (hash ^ byte) * 16777619u;
+  }
+}
+}  // namespace
+
+uint32_t SectionLayoutCache::fingerprint(const int fontId, const float lineCompression,
+                                         const bool extraParagraphSpacing, const uint8_t paragraphAlignment,
+                                         const uint16_t viewportWidth, const uint16_t viewportHeight,
+                                         const bool hyphenationEnabled, const bool embeddedStyle) {
+  uint32_t hash = 2166136261u;
+  mix(hash, fontId);
+  mix(hash, lineCompression);
+  mix(hash, extraParagraphSpacing);
+  mix(hash, paragraphAlignment);
+  mix(hash, viewportWidth);
+  mix(hash, viewportHeight);
+  mix(hash, hyphenationEnabled);
+  mix(hash, embeddedStyle);
+  return hash;
+}
+
+std::string SectionLayoutCache::directory(const std::string& cachePath, const uint32_t fingerprint) {
+  char name[9];
+  snprintf(name, sizeof(name), "%08x", static_cast<unsigned>(fingerprint));
+  return cachePath + "/sections/" + name;
+}
+
+void SectionLayoutCache::use(const std::string& cachePath, const uint32_t fingerprint, const uint8_t keepLayouts,
+                             const uint32_t maxBytes) {
+  const std::string sectionsDir = cachePath + "/sections";
+  const std::string indexPath = sectionsDir + "/layouts.bin";
+
+  bool found = false;
+  std::vector<uint32_t> layouts = readIndex(indexPath, found);
+  if (!found) {
+    // Section files from before layouts had their own directories, or directories the index has lost track of
+    Storage.removeDir(sectionsDir.c_str());
+  }
+  if (!layouts.empty() && layouts.front() == fingerprint && layouts.size() <= keepLayouts) {
+    return;
+  }
+
+  layouts.erase(std::remove(layouts.begin(), layouts.end(), fingerprint), layouts.end());
+  layouts.insert(layouts.begin(), fingerprint);
+
+  const auto evictLast = [&layouts, &cachePath]() {
+    LOG_DBG("SLC", "Evicting layout %08x", static_cast<unsigned>(layouts.back()));
+    Storage.removeDir(directory(cachePath, layouts.back()).c_str());
+    layouts.pop_back();
+  };
+  while (layouts.size() > std::max<uint8_t>(keepLayouts, 1)) {
+    evictLast();
+  }
+
+  if (layouts.size() > 1) {
+    std::vector<uint32_t> sizes;
+    uint32_t total = 0;
+    for (const uint32_t layout : layouts) {
+      sizes.push_back(directorySize(directory(cachePath, layout)));
+      total += sizes.back();
+    }
+    while (layouts.size() > 1 && total > maxBytes) {
+      total -= sizes.back();
+      sizes.pop_back();
+      evictLast();
+    }
+  }
+
+  Storage.mkdir(sectionsDir.c_str());
+  writeIndex(indexPath, layouts);
+  LOG_DBG("SLC", "Using layout %08x, %u layouts cached", static_cast<unsigned>(fingerprint),
+          static_cast<unsigned>(layouts.size()));
+}
+
+std::vector<uint32_t> SectionLayoutCache::readIndex(const std::string& indexPath, bool& found) {
+  std::vector<uint32_t> layouts;
+  FsFile file;
+  found = Storage.openFileForRead("SLC", indexPath, file);
+  if (!found) {
+    return layouts;
+  }
+
+  uint8_t version, count;
+  serialization::readPod(file, version);
+  serialization::readPod(file, count);
+  if (version != INDEX_FILE_VERSION || count > MAX_INDEX_ENTRIES) {
+    LOG_ERR("SLC", "Unknown layout index, dropping cached sections");
+    found = false;
+    file.close();
+    return layouts;
+  }
+  layouts.resize(count);
+  for (uint32_t& layout : layouts) {
+    serialization::readPod(file, layout);
+  }
+  file.close();
+  return layouts;
+}
+
+void SectionLayoutCache::writeIndex(const std::string& indexPath, const std::vector<uint32_t>& layouts) {
+  FsFile file;
+  if (!Storage.openFileForWrite("SLC", indexPath, file)) {
+    return;
+  }
+  serialization::writePod(file, INDEX_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint8_t>(std::min<size_t>(layouts.size(), MAX_INDEX_ENTRIES)));
+  for (size_t i = 0; i < layouts.size() && i < MAX_INDEX_ENTRIES; i++) {
+    serialization::writePod(file, layouts[i]);
+  }
+  file.close();
+}
+
+uint32_t SectionLayoutCache::directorySize(const std::string& path) {
+  FsFile dir = Storage.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    return 0;
+  }
+  uint32_t total = 0;
+  for (FsFile entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+    if (!entry.isDirectory()) {
+      total += entry.size();
+    }
+    entry.close();
+  }
+  dir.close();
+  return total;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Section layout cache
+ *
+ * Section files depend on the layout they were built with (font, line spacing, alignment, viewport, ...), so every
+ * layout of a book gets its own directory, sections/<fingerprint>/<n>.bin. Switching back to a layout that was used
+ * recently then finds its sections already built.
+ *
+ * The layouts of a book are kept in most recently used order in sections/layouts.bin. Using a layout moves it to the
+ * front and evicts the layouts at the back: all but the first `keepLayouts`, and then more until the sections of the
+ * remaining ones fit in `maxBytes`. The layout in use is never evicted, whatever its size.
+ */
+class SectionLayoutCache {
+ public:
+  static uint32_t fingerprint(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                              uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
+                              bool embeddedStyle);
+
+  // Directory holding the section files of a layout
+  static std::string directory(const std::string& cachePath, uint32_t fingerprint);
+
+  // Makes `fingerprint` the most recently used layout of the book at `cachePath` and evicts old layouts. No section of
+  // another layout may be open or being built while this runs.
+  static void use(const std::string& cachePath, uint32_t fingerprint, uint8_t keepLayouts, uint32_t maxBytes);
+
+ private:
+  static std::vector<uint32_t> readIndex(const std::string& indexPath, bool& found);
+  static void writeIndex(const std::string& indexPath, const std::vector<uint32_t>& layouts);
+  static uint32_t directorySize(const std::string& path);
+};
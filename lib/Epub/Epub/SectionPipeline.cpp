@@ -0,0 +1,178 @@
+#include "SectionPipeline.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <ZipFile.h>
+
+#include <new>
+#include <utility>
+
+#include "Page.h"
+
+namespace {
+SectionPipeline::TraceHook traceHook;
+}  // namespace
+
+void SectionPipeline::setTraceHook(TraceHook hook) { traceHook = std::move(hook); }
+
+SectionPipeline::TraceSpan::TraceSpan(const char* stage) : stage(stage) {
+  if (traceHook) {
+    startMicros = micros();
+  }
+}
+
+SectionPipeline::TraceSpan::~TraceSpan() {
+  if (traceHook) {
+    traceHook(stage, startMicros, micros());
+  }
+}
+
+InflateStage::InflateStage(std::unique_ptr<ZipFile> zip) : zip(std::move(zip)) {}
+
+InflateStage::~InflateStage() {
+  if (!idleSemaphore) {
+    return;
+  }
+  stopRequested = true;
+  xSemaphoreTake(idleSemaphore, portMAX_DELAY);
+  vSemaphoreDelete(idleSemaphore);
+  vSemaphoreDelete(dataSemaphore);
+  vStreamBufferDelete(ring);
+}
+
+bool InflateStage::start() {
+  chunk.reset(new (std::nothrow) uint8_t[CHUNK_SIZE]);
+  ring = chunk ? xStreamBufferCreate(RING_SIZE, 1) : nullptr;
+  dataSemaphore = ring ? xSemaphoreCreateBinary() : nullptr;
+  idleSemaphore = dataSemaphore ? xSemaphoreCreateBinary() : nullptr;
+  if (idleSemaphore &&
+      xTaskCreate(&taskTrampoline, "SectionInflate", TASK_STACK_SIZE, this, uxTaskPriorityGet(nullptr), nullptr) ==
+          pdPASS) {
+    return true;
+  }
+
+  LOG_DBG("SPL", "Inflating inline, could not start the inflate task");
+  if (idleSemaphore) vSemaphoreDelete(idleSemaphore);
+  if (dataSemaphore) vSemaphoreDelete(dataSemaphore);
+  if (ring) vStreamBufferDelete(ring);
+  idleSemaphore = nullptr;
+  dataSemaphore = nullptr;
+  ring = nullptr;
+  chunk.reset();
+  return false;
+}
+
+int InflateStage::read(uint8_t* dest, const size_t maxLen) {
+  if (!ring) {
+    SectionPipeline::TraceSpan span("inflate");
+    return zip->readEntryStream(dest, maxLen);
+  }
+
+  while (true) {
+    // The task sets its final state after its last send, so once that is seen the ring holds everything left
+    const State finalState = state;
+    const size_t n = xStreamBufferReceive(ring, dest, maxLen, 0);
+    if (n > 0) {
+      return static_cast<int>(n);
+    }
+    if (finalState != State::Running) {
+      return finalState == State::Finished ? 0 : -1;
+    }
+    xSemaphoreTake(dataSemaphore, portMAX_DELAY);
+  }
+}
+
+void InflateStage::taskTrampoline(void* param) {
+  auto* self = static_cast<InflateStage*>(param);
+  // The owner may destroy the stage as soon as the semaphore is given, so keep a copy of the handle
+  const SemaphoreHandle_t idle = self->idleSemaphore;
+  self->run();
+  xSemaphoreGive(idle);
+  vTaskDelete(nullptr);
+}
+
+void InflateStage::run() {
+  while (!stopRequested) {
+    int len;
+    {
+      SectionPipeline::TraceSpan span("inflate");
+      len = zip->readEntryStream(chunk.get(), CHUNK_SIZE);
+    }
+    if (len <= 0) {
+      state = len == 0 ? State::Finished : State::Failed;
+      xSemaphoreGive(dataSemaphore);
+      return;
+    }
+
+    size_t sent = 0;
+    while (sent < static_cast<size_t>(len) && !stopRequested) {
+      sent += xStreamBufferSend(ring, chunk.get() + sent, len - sent, POLL_TICKS);
+      xSemaphoreGive(dataSemaphore);
+    }
+  }
+}
+
+PageWriteStage::PageWriteStage(WriteFn writeFn) : writeFn(std::move(writeFn)) {}
+
+PageWriteStage::~PageWriteStage() { finish(); }
+
+bool PageWriteStage::start() {
+  queue = xQueueCreate(QUEUE_LENGTH, sizeof(PageBuilder*));
+  idleSemaphore = queue ? xSemaphoreCreateBinary() : nullptr;
+  if (idleSemaphore &&
+      xTaskCreate(&taskTrampoline, "SectionWrite", TASK_STACK_SIZE, this, uxTaskPriorityGet(nullptr), nullptr) ==
+          pdPASS) {
+    return true;
+  }
+
+  LOG_DBG("SPL", "Writing pages inline, could not start the writer task");
+  if (idleSemaphore) vSemaphoreDelete(idleSemaphore);
+  if (queue) vQueueDelete(queue);
+  idleSemaphore = nullptr;
+  queue = nullptr;
+  return false;
+}
+
+void PageWriteStage::submit(std::unique_ptr<PageBuilder> page) {
+  if (!queue) {
+    SectionPipeline::TraceSpan span("write");
+    writeFn(std::move(page));
+    return;
+  }
+  PageBuilder* item = page.release();
+  xQueueSend(queue, &item, portMAX_DELAY);
+}
+
+void PageWriteStage::finish() {
+  if (!queue) {
+    return;
+  }
+  PageBuilder* const end = nullptr;
+  xQueueSend(queue, &end, portMAX_DELAY);
+  xSemaphoreTake(idleSemaphore, portMAX_DELAY);
+  vSemaphoreDelete(idleSemaphore);
+  vQueueDelete(queue);
+  idleSemaphore = nullptr;
+  queue = nullptr;
+}
+
+void PageWriteStage::taskTrampoline(void* param) {
+  auto* self = static_cast<PageWriteStage*>(param);
+  // The owner may destroy the stage as soon as the semaphore is given, so keep a copy of the handle
+  const SemaphoreHandle_t idle = self->idleSemaphore;
+  self->run();
+  xSemaphoreGive(idle);
+  vTaskDelete(nullptr);
+}
+
+void PageWriteStage::run() {
+  while (true) {
+    PageBuilder* item = nullptr;
+    xQueueReceive(queue, &item, portMAX_DELAY);
+    if (!item) {
+      return;
+    }
+    SectionPipeline::TraceSpan span("write");
+    writeFn(std::unique_ptr<PageBuilder>(item));
+  }
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/stream_buffer.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+class PageBuilder;
+class ZipFile;
+
+/**
+ * Section pipeline
+ *
+ * Building a section inflates the chapter, parses and lays it out, and writes the pages to the SD card. The two
+ * stages below take the ends of that chain off the parsing task, so that inflating (mostly SD reads and CPU) and
+ * writing pages (mostly SD writes) overlap with parsing and layout instead of taking turns with them:
+ *
+ *   InflateStage task --(byte ring)--> parse + layout (caller) --(page queue)--> PageWriteStage task
+ *
+ * Both are bounded: the ring holds RING_SIZE bytes and the queue QUEUE_LENGTH pages, so a fast producer blocks rather
+ * than growing the heap. If a task or its buffer cannot be created the stage does its work inline on the caller's
+ * task, which is exactly the sequential build.
+ *
+ * The tasks run at the caller's priority. Only the stage objects talk to them, and each object belongs to a single
+ * section build.
+ */
+
+// Timing of the stages, for the host simulator's trace. No hook is set on the device.
+namespace SectionPipeline {
+
+using TraceHook = std::function<void(const char* stage, unsigned long startMicros, unsigned long endMicros)>;
+
+// Called from every stage's task; the hook must be thread safe. Set it before any section is built.
+void setTraceHook(TraceHook hook);
+
+// Reports the lifetime of the span to the trace hook, if one is set
+class TraceSpan {
+  const char* stage;
+  unsigned long startMicros = 0;
+
+ public:
+  explicit TraceSpan(const char* stage);
+  ~TraceSpan();
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+};
+
+}  // namespace SectionPipeline
+
+// Inflates a zip entry on its own task into a byte ring, which the parser drains through read()
+class InflateStage {
+ public:
+  // `zip` has the entry stream already begun (see Epub::openItemStream)
+  explicit InflateStage(std::unique_ptr<ZipFile> zip);
+  // Stops the task, if running, and waits for it to exit
+  ~InflateStage();
+  InflateStage(const InflateStage&) = delete;
+  InflateStage& operator=(const InflateStage&) = delete;
+
+  // Starts inflating ahead. Returns false if that is not possible, in which case read() inflates inline.
+  bool start();
+  // Same contract as ZipFile::readEntryStream: the number of bytes read, 0 at the end of the entry, -1 on error
+  int read(uint8_t* dest, size_t maxLen);
+
+ private:
+  static constexpr size_t RING_SIZE = 4096;
+  static constexpr size_t CHUNK_SIZE = 1024;
+  static constexpr uint32_t TASK_STACK_SIZE = 4096;
+  // How long the task blocks on a full ring before checking whether it should stop
+  static constexpr TickType_t POLL_TICKS = pdMS_TO_TICKS(20);
+
+  enum class State : uint8_t { Running, Finished, Failed };
+
+  std::unique_ptr<ZipFile> zip;
+  std::unique_ptr<uint8_t[]> chunk;  // Inflated bytes on their way into the ring, only touched by the task
+  StreamBufferHandle_t ring = nullptr;
+  // Given by the task after every send and once it is done, so read() sleeps until there is news
+  SemaphoreHandle_t dataSemaphore = nullptr;
+  // Given by the task as it exits
+  SemaphoreHandle_t idleSemaphore = nullptr;
+  std::atomic<State> state{State::Running};
+  std::atomic<bool> stopRequested{false};
+
+  static void taskTrampoline(void* param);
+  void run();
+};
+
+// Writes finished pages on its own task, in the order they were submitted
+class PageWriteStage {
+ public:
+  using WriteFn = std::function<void(std::unique_ptr<PageBuilder>)>;
+
+  // `writeFn` is called for every page on the stage's task, one page at a time
+  explicit PageWriteStage(WriteFn writeFn);
+  // Same as finish()
+  ~PageWriteStage();
+  PageWriteStage(const PageWriteStage&) = delete;
+  PageWriteStage& operator=(const PageWriteStage&) = delete;
+
+  // Starts the writer task. Returns false if that is not possible, in which case submit() writes inline.
+  bool start();
+  // Hands a page to the writer, blocking while QUEUE_LENGTH pages are waiting to be written
+  void submit(std::unique_ptr<PageBuilder> page);
+  // Returns once every submitted page has been written, and stops the task. Whatever `writeFn` produced may be used
+  // from here on.
+  void finish();
+
+ private:
+  static constexpr UBaseType_t QUEUE_LENGTH = 2;
+  static constexpr uint32_t TASK_STACK_SIZE = 4096;
+
+  WriteFn writeFn;
+  QueueHandle_t queue = nullptr;  // PageBuilder*, owned by the queue; nullptr ends the task
+  SemaphoreHandle_t idleSemaphore = nullptr;  // Given by the task as it exits
+
+  static void taskTrampoline(void* param);
+  void run();
+};
@@ -0,0 +1,94 @@
+#include "WordWidthCache.h"
+
+#include <Arduino.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+
+#include <new>
+
+namespace {
+
+uint64_t keyHash(const int fontId, const char* text, const EpdFontFamily::Style style) {
+  uint64_t hash = 14695981039346656037ull;
+  for (const char* c = text; *c; ++c) {
+    hash ^= static_cast<uint8_t>(*c);
+    hash *= 1099511628211ull;
+  }
+  hash ^= static_cast<uint64_t>(style) << 8 | static_cast<uint8_t>(fontId);
+  hash *= 1099511628211ull;
+  return hash;
+}
+
+}  // namespace
+
+uint16_t WordWidthCache::advanceX(const GfxRenderer& renderer, const int fontId, const char* text,
+                                  const EpdFontFamily::Style style) {
+  if (fontId != this->fontId) {
+    clear();
+    this->fontId = fontId;
+  }
+  if (!slots) {
+    slots.reset(new (std::nothrow) Slot[SLOTS]());
+  }
+
+  const uint64_t hash = keyHash(fontId, text, style);
+  const uint32_t low = static_cast<uint32_t>(hash) | 1u;
+  const auto check = static_cast<uint16_t>(hash >> 48);
+  Slot* emptySlot = nullptr;
+  if (slots) {
+    for (uint32_t probe = 0; probe < PROBES; ++probe) {
+      Slot& slot = slots[(low + probe) % SLOTS];
+      if (slot.hash == 0) {
+        emptySlot = &slot;
+        break;
+      }
+      if (slot.hash == low && slot.check == check) {
+        hits++;
+        return slot.width;
+      }
+    }
+  }
+
+  // Only every TIMED_MISS_INTERVAL-th miss is timed, so that the clock reads do not eat into what the cache saves
+  uint16_t width;
+  if (misses % TIMED_MISS_INTERVAL == 0) {
+    const unsigned long start = micros();
+    width = static_cast<uint16_t>(renderer.getTextAdvanceX(fontId, text, style));
+    timedMicros += micros() - start;
+    timedMisses++;
+  } else {
+    width = static_cast<uint16_t>(renderer.getTextAdvanceX(fontId, text, style));
+  }
+  misses++;
+
+  if (slots) {
+    // Take the free slot along the probe sequence, or evict the word in the home slot
+    Slot* slot = emptySlot ? emptySlot : &slots[low % SLOTS];
+    slot->hash = low;
+    slot->check = check;
+    slot->width = width;
+  }
+  return width;
+}
+
+void WordWidthCache::clear() {
+  slots.reset();
+  fontId = -1;
+}
+
+void WordWidthCache::logStats() {
+  if (hits == 0 && misses == 0) {
+    return;
+  }
+  // Estimated from the timed misses: what measuring every miss cost, and what measuring every hit would have
+  [[maybe_unused]] const uint32_t measuringMicros =
+      timedMisses > 0 ? static_cast<uint32_t>(uint64_t{timedMicros} * misses / timedMisses) : 0;
+  [[maybe_unused]] const uint32_t savedMicros =
+      timedMisses > 0 ? static_cast<uint32_t>(uint64_t{timedMicros} * hits / timedMisses) : 0;
+  LOG_DBG("WWC", "Word widths: %u hits, %u misses (%u%% hit rate), ~%u us measuring, ~%u us saved", hits, misses,
+          hits * 100 / (hits + misses), measuringMicros, savedMicros);
+  hits = 0;
+  misses = 0;
+  timedMisses = 0;
+  timedMicros = 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <cstdint>
+#include <memory>
+
+class GfxRenderer;
+
+// Advance widths of the words laid out while a section is indexed. A chapter measures the same few hundred words
+// ("the", "and", "und") thousands of times, so ChapterHtmlSlimParser keeps one of these for the whole parse and
+// ParsedText measures through it. The table is bounded and open-addressed: a word whose probe sequence is full evicts
+// the word in its home slot. Keys are (fontId, style, 64-bit hash of the text); the table empties when the font
+// changes.
+class WordWidthCache {
+ public:
+  // Same result as GfxRenderer::getTextAdvanceX(fontId, text, style)
+  uint16_t advanceX(const GfxRenderer& renderer, int fontId, const char* text, EpdFontFamily::Style style);
+
+  // Drop every entry and hand the table back to the heap
+  void clear();
+
+  // Log hit/miss counters and the estimated time saved since the previous call, then reset them
+  void logStats();
+
+ private:
+  static constexpr uint32_t SLOTS = 1024;
+  static constexpr uint32_t PROBES = 4;
+  static constexpr uint32_t TIMED_MISS_INTERVAL = 16;
+
+  struct Slot {
+    uint32_t hash;   // Low bits of the key hash, never 0; 0 = empty slot
+    uint16_t check;  // High bits of the same hash, so a false hit needs a 47-bit collision
+    uint16_t width;
+  };
+
+  std::unique_ptr<Slot[]> slots;
+  int fontId = -1;
+
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  uint32_t timedMisses = 0;  // Misses measured under the clock, a sample to estimate what the hits saved
+  uint32_t timedMicros = 0;
+};
@@ -2,15 +2,22 @@
 
 #include <GfxRenderer.h>
 #include <Logging.h>
-#include <Serialization.h>
 
-#include "../converters/DitherUtils.h"
-#include "../converters/ImageDecoderFactory.h"
+#include <algorithm>
+#include <cstdlib>
 
-// Cache file format:
-// - uint16_t width
-// - uint16_t height
-// - uint8_t pixels[...] - 2 bits per pixel, packed (4 pixels per byte), row-major order
+#include "../converters/ImageDecoderFactory.h"
+#include "../converters/PixelCache.h"
+
+// Cache file format (version 2, written by PixelCache::writeToFile):
+// - uint16_t marker (0xFFFF, older caches started with the width)
+// - uint8_t version, uint8_t orientation the planes were rotated for
+// - uint16_t width, height - logical image size
+// - uint16_t panelWidth, panelHeight - image size in panel orientation
+// - uint16_t bytesPerRow - of one plane row
+// - uint8_t planes[3][panelHeight][bytesPerRow] - BW, LSB and MSB planes, 1 bit per pixel MSB first, first bit at the
+//   image's leftmost panel column, rows from its topmost panel row
+// Caches written for another orientation or in the old format read as a miss and are rewritten by the next decode.
 
 ImageBlock::ImageBlock(const std::string& imagePath, int16_t width, int16_t height)
     : imagePath(imagePath), width(width), height(height) {}
@@ -19,6 +26,8 @@ bool ImageBlock::imageExists() const { return Storage.exists(imagePath.c_str());
 
 namespace {
 
+constexpr size_t CACHE_READ_CHUNK_BYTES = 2048;
+
 std::string getCachePath(const std::string& imagePath) {
   // Replace extension with .pxc (pixel cache)
   size_t dotPos = imagePath.rfind('.');
@@ -35,16 +44,23 @@ bool renderFromCache(GfxRenderer& renderer, const std::string& cachePath, int x,
     return false;
   }
 
-  uint16_t cachedWidth, cachedHeight;
-  if (cacheFile.read(&cachedWidth, 2) != 2 || cacheFile.read(&cachedHeight, 2) != 2) {
+  uint16_t header[7];
+  if (cacheFile.read(header, sizeof(header)) != sizeof(header) || header[0] != PixelCache::CACHE_MARKER ||
+      (header[1] & 0xFF) != PixelCache::CACHE_VERSION || (header[1] >> 8) != renderer.getOrientation()) {
+    LOG_DBG("IMG", "Cache stale or for another orientation: %s", cachePath.c_str());
     cacheFile.close();
     return false;
   }
+  const uint16_t cachedWidth = header[2];
+  const uint16_t cachedHeight = header[3];
+  const int panelWidth = header[4];
+  const int panelHeight = header[5];
+  const int bytesPerRow = header[6];
 
   // Verify dimensions are close (allow 1 pixel tolerance for rounding differences)
   int widthDiff = abs(cachedWidth - expectedWidth);
   int heightDiff = abs(cachedHeight - expectedHeight);
-  if (widthDiff > 1 || heightDiff > 1) {
+  if (widthDiff > 1 || heightDiff > 1 || cachedWidth == 0 || cachedHeight == 0) {
     LOG_ERR("IMG", "Cache dimension mismatch: %dx%d vs %dx%d", cachedWidth, cachedHeight, expectedWidth,
             expectedHeight);
     cacheFile.close();
@@ -55,36 +71,65 @@ bool renderFromCache(GfxRenderer& renderer, const std::string& cachePath, int x,
   expectedWidth = cachedWidth;
   expectedHeight = cachedHeight;
 
+  // Top-left corner of the image on the panel
+  int cornerX, cornerY, oppositeX, oppositeY;
+  renderer.toPanelCoordinates(x, y, &cornerX, &cornerY);
+  renderer.toPanelCoordinates(x + expectedWidth - 1, y + expectedHeight - 1, &oppositeX, &oppositeY);
+  const int panelX = std::min(cornerX, oppositeX);
+  const int panelY = std::min(cornerY, oppositeY);
+  if (std::abs(oppositeX - cornerX) + 1 != panelWidth || std::abs(oppositeY - cornerY) + 1 != panelHeight ||
+      bytesPerRow != (panelWidth + 7) / 8 || panelX < 0 || panelX + panelWidth > HalDisplay::DISPLAY_WIDTH ||
+      panelY < 0 || panelY + panelHeight > HalDisplay::DISPLAY_HEIGHT) {
+    LOG_ERR("IMG", "Cache does not fit the panel at %d,%d: %s", x, y, cachePath.c_str());
+    cacheFile.close();
+    return false;
+  }
+
+  int plane;
+  switch (renderer.getRenderMode()) {
+    case GfxRenderer::GRAYSCALE_LSB:
+      plane = PixelCache::PLANE_LSB;
+      break;
+    case GfxRenderer::GRAYSCALE_MSB:
+      plane = PixelCache::PLANE_MSB;
+      break;
+    default:
+      plane = PixelCache::PLANE_BW;
+      break;
+  }
+  const bool clear = plane == PixelCache::PLANE_BW;
+
   LOG_DBG("IMG", "Loading from cache: %s (%dx%d)", cachePath.c_str(), cachedWidth, cachedHeight);
 
-  // Read and render row by row to minimize memory usage
-  const int bytesPerRow = (cachedWidth + 3) / 4;  // 2 bits per pixel, 4 pixels per byte
-  uint8_t* rowBuffer = (uint8_t*)malloc(bytesPerRow);
-  if (!rowBuffer) {
+  if (!cacheFile.seekSet(sizeof(header) + static_cast<size_t>(plane) * bytesPerRow * panelHeight)) {
+    LOG_ERR("IMG", "Cache seek failed: %s", cachePath.c_str());
+    cacheFile.close();
+    return false;
+  }
+
+  // Read the plane a few rows at a time and merge each row straight into the framebuffer
+  const int rowsPerChunk = std::max(1, std::min(panelHeight, static_cast<int>(CACHE_READ_CHUNK_BYTES) / bytesPerRow));
+  uint8_t* chunk = (uint8_t*)malloc(rowsPerChunk * bytesPerRow);
+  if (!chunk) {
     LOG_ERR("IMG", "Failed to allocate row buffer");
     cacheFile.close();
     return false;
   }
 
-  for (int row = 0; row < cachedHeight; row++) {
-    if (cacheFile.read(rowBuffer, bytesPerRow) != bytesPerRow) {
+  for (int row = 0; row < panelHeight; row += rowsPerChunk) {
+    const int rows = std::min(rowsPerChunk, panelHeight - row);
+    if (cacheFile.read(chunk, rows * bytesPerRow) != rows * bytesPerRow) {
       LOG_ERR("IMG", "Cache read error at row %d", row);
-      free(rowBuffer);
+      free(chunk);
       cacheFile.close();
       return false;
     }
-
-    int destY = y + row;
-    for (int col = 0; col < cachedWidth; col++) {
-      int byteIdx = col / 4;
-      int bitShift = 6 - (col % 4) * 2;  // MSB first within byte
-      uint8_t pixelValue = (rowBuffer[byteIdx] >> bitShift) & 0x03;
-
-      drawPixelWithRenderMode(renderer, x + col, destY, pixelValue);
+    for (int i = 0; i < rows; i++) {
+      renderer.blitPanelRow(panelX, panelY + row + i, chunk + i * bytesPerRow, panelWidth, clear);
     }
   }
 
-  free(rowBuffer);
+  free(chunk);
   cacheFile.close();
   LOG_DBG("IMG", "Cache render complete");
   return true;
@@ -155,19 +200,3 @@ void ImageBlock::render(GfxRenderer& renderer, const int x, const int y) {
 
   LOG_DBG("IMG", "Decode successful");
 }
-
-bool ImageBlock::serialize(FsFile& file) {
-  serialization::writeString(file, imagePath);
-  serialization::writePod(file, width);
-  serialization::writePod(file, height);
-  return true;
-}
-
-std::unique_ptr<ImageBlock> ImageBlock::deserialize(FsFile& file) {
-  std::string path;
-  serialization::readString(file, path);
-  int16_t w, h;
-  serialization::readPod(file, w);
-  serialization::readPod(file, h);
-  return std::unique_ptr<ImageBlock>(new ImageBlock(path, w, h));
-}
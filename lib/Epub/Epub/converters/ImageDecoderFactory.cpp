@@ -2,41 +2,49 @@
 
 #include <Logging.h>
 
-#include <memory>
 #include <string>
 
 #include "JpegToFramebufferConverter.h"
 #include "PngToFramebufferConverter.h"
 
-std::unique_ptr<JpegToFramebufferConverter> ImageDecoderFactory::jpegDecoder = nullptr;
-std::unique_ptr<PngToFramebufferConverter> ImageDecoderFactory::pngDecoder = nullptr;
+namespace {
+std::string lowercaseExtension(const std::string& imagePath) {
+  const size_t dotPos = imagePath.rfind('.');
+  if (dotPos == std::string::npos) {
+    return "";
+  }
+  std::string ext = imagePath.substr(dotPos);
+  for (auto& c : ext) {
+    c = tolower(c);
+  }
+  return ext;
+}
+}  // namespace
 
 ImageToFramebufferDecoder* ImageDecoderFactory::getDecoder(const std::string& imagePath) {
-  std::string ext = imagePath;
-  size_t dotPos = ext.rfind('.');
-  if (dotPos != std::string::npos) {
-    ext = ext.substr(dotPos);
-    for (auto& c : ext) {
-      c = tolower(c);
-    }
-  } else {
-    ext = "";
-  }
+  const std::string ext = lowercaseExtension(imagePath);
 
+  // Function-local statics: the parser on the prefetch task and the render task may ask for the first decoder at once
   if (JpegToFramebufferConverter::supportsFormat(ext)) {
-    if (!jpegDecoder) {
-      jpegDecoder.reset(new JpegToFramebufferConverter());
-    }
-    return jpegDecoder.get();
+    static JpegToFramebufferConverter jpegDecoder;
+    return &jpegDecoder;
   } else if (PngToFramebufferConverter::supportsFormat(ext)) {
-    if (!pngDecoder) {
-      pngDecoder.reset(new PngToFramebufferConverter());
-    }
-    return pngDecoder.get();
+    static PngToFramebufferConverter pngDecoder;
+    return &pngDecoder;
   }
 
   LOG_ERR("DEC", "No decoder found for image: %s", imagePath.c_str());
   return nullptr;
 }
 
+bool ImageDecoderFactory::getDimensions(const std::string& imagePath, ImageDimensions& out) {
+  const std::string ext = lowercaseExtension(imagePath);
+  if (JpegToFramebufferConverter::supportsFormat(ext)) {
+    return JpegToFramebufferConverter::getDimensionsStatic(imagePath, out);
+  } else if (PngToFramebufferConverter::supportsFormat(ext)) {
+    return PngToFramebufferConverter::getDimensionsStatic(imagePath, out);
+  }
+  return false;
+}
+
 bool ImageDecoderFactory::isFormatSupported(const std::string& imagePath) { return getDecoder(imagePath) != nullptr; }
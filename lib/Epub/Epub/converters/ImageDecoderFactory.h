@@ -1,20 +1,14 @@
 #pragma once
 #include <cstdint>
-#include <memory>
 #include <string>
 
 #include "ImageToFramebufferDecoder.h"
 
-class JpegToFramebufferConverter;
-class PngToFramebufferConverter;
-
 class ImageDecoderFactory {
  public:
   // Returns non-owning pointer - factory owns the decoder lifetime
   static ImageToFramebufferDecoder* getDecoder(const std::string& imagePath);
   static bool isFormatSupported(const std::string& imagePath);
-
- private:
-  static std::unique_ptr<JpegToFramebufferConverter> jpegDecoder;
-  static std::unique_ptr<PngToFramebufferConverter> pngDecoder;
+  // Reads the image header without touching a decoder instance
+  static bool getDimensions(const std::string& imagePath, ImageDimensions& out);
 };
@@ -479,7 +479,7 @@ bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string& imagePat
 
   // Write cache file if caching was enabled
   if (ctx.caching) {
-    ctx.cache.writeToFile(config.cachePath);
+    ctx.cache.writeToFile(config.cachePath, renderer);
   }
 
   return true;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <Logging.h>
 #include <stdint.h>
@@ -23,6 +24,19 @@ struct PixelCache {
 
   static constexpr size_t MAX_CACHE_BYTES = 256 * 1024;  // 256KB limit for embedded targets
 
+  // Cache file layout, version 2. Planes are stored in this order, one bit per pixel, set where the pass draws.
+  static constexpr uint16_t CACHE_MARKER = 0xFFFF;  // Never a valid version 1 width
+  static constexpr uint8_t CACHE_VERSION = 2;
+  enum Plane { PLANE_BW, PLANE_LSB, PLANE_MSB, PLANE_COUNT };
+  static constexpr size_t WRITE_CHUNK_BYTES = 2048;
+
+  // Mirrors drawPixelWithRenderMode: BW draws black below white, LSB marks level 1, MSB marks levels 1 and 2
+  static bool inPlane(const int plane, const uint8_t value) {
+    if (plane == PLANE_BW) return value < 3;
+    if (plane == PLANE_LSB) return value == 1;
+    return value == 1 || value == 2;
+  }
+
   bool allocate(int w, int h, int ox, int oy) {
     width = w;
     height = h;
@@ -53,23 +67,81 @@ struct PixelCache {
     buffer[byteIdx] = (buffer[byteIdx] & ~(0x03 << bitShift)) | ((value & 0x03) << bitShift);
   }
 
-  bool writeToFile(const std::string& cachePath) {
+  // Writes the cache pre-rotated to the renderer's current orientation and split into the three 1-bit planes the
+  // render passes draw (see ImageBlock.cpp for the file layout), so rendering is a row merge per pass.
+  bool writeToFile(const std::string& cachePath, const GfxRenderer& renderer) {
     if (!buffer) return false;
 
+    // Panel step for one logical pixel right (a) and down (b). One is horizontal on the panel, the other vertical.
+    int x0, y0, ax, ay, bx, by;
+    renderer.toPanelCoordinates(0, 0, &x0, &y0);
+    renderer.toPanelCoordinates(1, 0, &ax, &ay);
+    renderer.toPanelCoordinates(0, 1, &bx, &by);
+    ax -= x0;
+    ay -= y0;
+    bx -= x0;
+    by -= y0;
+    const bool rowsAlongPanelX = ax != 0;
+    const int panelWidth = rowsAlongPanelX ? width : height;
+    const int panelHeight = rowsAlongPanelX ? height : width;
+    const int planeBytesPerRow = (panelWidth + 7) / 8;
+
     FsFile cacheFile;
     if (!Storage.openFileForWrite("IMG", cachePath, cacheFile)) {
       LOG_ERR("IMG", "Failed to open cache file for writing: %s", cachePath.c_str());
       return false;
     }
 
-    uint16_t w = width;
-    uint16_t h = height;
-    cacheFile.write(&w, 2);
-    cacheFile.write(&h, 2);
-    cacheFile.write(buffer, bytesPerRow * height);
+    const uint16_t header[] = {CACHE_MARKER,
+                               static_cast<uint16_t>(CACHE_VERSION | renderer.getOrientation() << 8),
+                               static_cast<uint16_t>(width),
+                               static_cast<uint16_t>(height),
+                               static_cast<uint16_t>(panelWidth),
+                               static_cast<uint16_t>(panelHeight),
+                               static_cast<uint16_t>(planeBytesPerRow)};
+    bool ok = cacheFile.write(header, sizeof(header)) == sizeof(header);
+
+    uint8_t chunk[WRITE_CHUNK_BYTES];
+    size_t chunkUsed = 0;
+    for (int plane = 0; plane < PLANE_COUNT && ok; plane++) {
+      for (int row = 0; row < panelHeight && ok; row++) {
+        // Logical pixel at the first panel column of this row, and the logical step per panel column
+        int i, j, di, dj;
+        if (rowsAlongPanelX) {
+          i = ax > 0 ? 0 : width - 1;
+          di = ax > 0 ? 1 : -1;
+          j = by > 0 ? row : height - 1 - row;
+          dj = 0;
+        } else {
+          i = ay > 0 ? row : width - 1 - row;
+          di = 0;
+          j = bx > 0 ? 0 : height - 1;
+          dj = bx > 0 ? 1 : -1;
+        }
+
+        if (chunkUsed + planeBytesPerRow > sizeof(chunk)) {
+          ok = cacheFile.write(chunk, chunkUsed) == chunkUsed;
+          chunkUsed = 0;
+        }
+        uint8_t* out = chunk + chunkUsed;
+        memset(out, 0, planeBytesPerRow);
+        for (int col = 0; col < panelWidth; col++, i += di, j += dj) {
+          const uint8_t value = (buffer[j * bytesPerRow + i / 4] >> (6 - (i % 4) * 2)) & 0x03;
+          if (inPlane(plane, value)) out[col / 8] |= 0x80 >> (col % 8);
+        }
+        chunkUsed += planeBytesPerRow;
+      }
+    }
+    if (ok && chunkUsed > 0) ok = cacheFile.write(chunk, chunkUsed) == chunkUsed;
     cacheFile.close();
 
-    LOG_DBG("IMG", "Cache written: %s (%dx%d, %d bytes)", cachePath.c_str(), width, height, 4 + bytesPerRow * height);
+    if (!ok) {
+      LOG_ERR("IMG", "Failed to write cache file: %s", cachePath.c_str());
+      Storage.remove(cachePath.c_str());
+      return false;
+    }
+    LOG_DBG("IMG", "Cache written: %s (%dx%d, %d bytes)", cachePath.c_str(), width, height,
+            static_cast<int>(sizeof(header)) + PLANE_COUNT * planeBytesPerRow * panelHeight);
     return true;
   }
 
@@ -384,7 +384,7 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
 
   // Write cache file if caching was enabled and buffer was allocated
   if (ctx.caching) {
-    ctx.cache.writeToFile(config.cachePath);
+    ctx.cache.writeToFile(config.cachePath, renderer);
   }
 
   return true;
@@ -52,6 +52,43 @@ constexpr size_t MAX_SELECTOR_LENGTH = 256;
 // Check if character is CSS whitespace
 bool isCssWhitespace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'; }
 
+// Lowercases a tag or class name into a stack buffer for atom lookup. Names longer than any selector are left empty,
+// as they cannot match a rule.
+struct LowercaseName {
+  char data[MAX_SELECTOR_LENGTH];
+  size_t len = 0;
+
+  explicit LowercaseName(const std::string_view s) {
+    if (s.size() > sizeof(data)) return;
+    for (const char c : s) {
+      data[len++] = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+  }
+
+  std::string_view view() const { return std::string_view(data, len); }
+};
+
+uint64_t fnvHash64(const std::string_view s) {
+  uint64_t hash = 14695981039346656037ull;
+  for (const char c : s) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+// Calls fn(token) for each whitespace-separated token of s
+template <typename Fn>
+void forEachToken(const std::string_view s, Fn&& fn) {
+  size_t i = 0;
+  while (i < s.size()) {
+    while (i < s.size() && isCssWhitespace(s[i])) i++;
+    const size_t start = i;
+    while (i < s.size() && !isCssWhitespace(s[i])) i++;
+    if (i > start) fn(s.substr(start, i - start));
+  }
+}
+
 }  // anonymous namespace
 
 // String utilities implementation
@@ -575,13 +612,113 @@ bool CssParser::loadFromStream(FsFile& source) {
     handleChar('/');
   }
 
+  compileRules();
   LOG_DBG("CSS", "Parsed %zu rules from %zu bytes", rulesBySelector_.size(), totalRead);
   return true;
 }
 
+// Rule compilation
+
+void CssParser::clear() {
+  rulesBySelector_.clear();
+  atomPool_.clear();
+  atomPool_.shrink_to_fit();
+  atomEnds_.clear();
+  atomEnds_.shrink_to_fit();
+  rules_.clear();
+  rules_.shrink_to_fit();
+  resetMemo();
+}
+
+void CssParser::resetMemo() const {
+  for (auto& entry : memo_) {
+    entry.valid = false;
+  }
+}
+
+void CssParser::compileRules() {
+  // Split each selector into its tag and class part. Only `tag`, `.class` and `tag.class` can ever match in
+  // resolveStyle, so other selectors (e.g. `.class1.class2`) are dropped here.
+  struct Selector {
+    std::string_view tag;
+    std::string_view cls;
+    const CssStyle* style;
+  };
+  std::vector<Selector> selectors;
+  selectors.reserve(rulesBySelector_.size());
+  std::vector<std::string_view> names;
+  names.reserve(rulesBySelector_.size() * 2);
+  for (const auto& pair : rulesBySelector_) {
+    const std::string_view key = pair.first;
+    const size_t dot = key.find('.');
+    const std::string_view tag = key.substr(0, dot);
+    const std::string_view cls = dot == std::string_view::npos ? std::string_view{} : key.substr(dot + 1);
+    if (dot != std::string_view::npos && (cls.empty() || cls.find('.') != std::string_view::npos)) continue;
+    if (tag.empty() && cls.empty()) continue;
+    selectors.push_back({tag, cls, &pair.second});
+    if (!tag.empty()) names.push_back(tag);
+    if (!cls.empty()) names.push_back(cls);
+  }
+  std::sort(names.begin(), names.end());
+  names.erase(std::unique(names.begin(), names.end()), names.end());
+
+  atomPool_.clear();
+  atomEnds_.clear();
+  atomEnds_.reserve(names.size());
+  for (const auto& name : names) {
+    atomPool_.append(name.data(), name.size());
+    atomEnds_.push_back(static_cast<uint32_t>(atomPool_.size()));
+  }
+
+  rules_.clear();
+  rules_.reserve(selectors.size());
+  for (const auto& selector : selectors) {
+    const uint16_t tagAtom = selector.tag.empty() ? NO_ATOM : findAtom(selector.tag);
+    const uint16_t classAtom = selector.cls.empty() ? NO_ATOM : findAtom(selector.cls);
+    rules_.push_back({tagAtom, classAtom, *selector.style});
+  }
+  std::sort(rules_.begin(), rules_.end(), [](const CompiledRule& a, const CompiledRule& b) {
+    return a.tagAtom < b.tagAtom || (a.tagAtom == b.tagAtom && a.classAtom < b.classAtom);
+  });
+  resetMemo();
+}
+
+std::string_view CssParser::atomName(const uint16_t atom) const {
+  const uint32_t start = atom == 0 ? 0 : atomEnds_[atom - 1];
+  return std::string_view(atomPool_).substr(start, atomEnds_[atom] - start);
+}
+
+uint16_t CssParser::findAtom(const std::string_view lowercaseName) const {
+  size_t lo = 0;
+  size_t hi = atomEnds_.size();
+  while (lo < hi) {
+    const size_t mid = (lo + hi) / 2;
+    const int cmp = atomName(static_cast<uint16_t>(mid)).compare(lowercaseName);
+    if (cmp == 0) return static_cast<uint16_t>(mid);
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return NO_ATOM;
+}
+
+const CssStyle* CssParser::findRule(const uint16_t tagAtom, const uint16_t classAtom) const {
+  const auto it = std::lower_bound(rules_.begin(), rules_.end(), std::make_pair(tagAtom, classAtom),
+                                   [](const CompiledRule& rule, const std::pair<uint16_t, uint16_t>& key) {
+                                     return rule.tagAtom < key.first ||
+                                            (rule.tagAtom == key.first && rule.classAtom < key.second);
+                                   });
+  if (it != rules_.end() && it->tagAtom == tagAtom && it->classAtom == classAtom) {
+    return &it->style;
+  }
+  return nullptr;
+}
+
 // Style resolution
 
-CssStyle CssParser::resolveStyle(const std::string& tagName, const std::string& classAttr) const {
+CssStyle CssParser::resolveStyle(const std::string_view tagName, const std::string_view classAttr) const {
   static bool lowHeapWarningLogged = false;
   if (ESP.getFreeHeap() < MIN_FREE_HEAP_FOR_CSS) {
     if (!lowHeapWarningLogged) {
@@ -591,41 +728,53 @@ CssStyle CssParser::resolveStyle(const std::string& tagName, const std::string&
     }
     return CssStyle{};
   }
+  if (rules_.empty()) {
+    return CssStyle{};
+  }
+
+  // A tag without an atom has no rules of its own; only its classes can match
+  const uint16_t tagAtom = findAtom(LowercaseName(tagName).view());
+  const uint64_t classHash = fnvHash64(classAttr);
+  MemoEntry& memo = memo_[(classHash ^ tagAtom * 0x9E3779B1u) % MEMO_SIZE];
+  if (memo.valid && memo.tagAtom == tagAtom && memo.classHash == classHash) {
+    return memo.style;
+  }
+
   CssStyle result;
-  const std::string tag = normalized(tagName);
 
   // 1. Apply element-level style (lowest priority)
-  const auto tagIt = rulesBySelector_.find(tag);
-  if (tagIt != rulesBySelector_.end()) {
-    result.applyOver(tagIt->second);
+  if (tagAtom != NO_ATOM) {
+    if (const CssStyle* style = findRule(tagAtom, NO_ATOM)) {
+      result.applyOver(*style);
+    }
   }
 
   // TODO: Support combinations of classes (e.g. style on .class1.class2)
   // 2. Apply class styles (medium priority)
-  if (!classAttr.empty()) {
-    const auto classes = splitWhitespace(classAttr);
-
-    for (const auto& cls : classes) {
-      std::string classKey = "." + normalized(cls);
-
-      auto classIt = rulesBySelector_.find(classKey);
-      if (classIt != rulesBySelector_.end()) {
-        result.applyOver(classIt->second);
-      }
-    }
-
-    // TODO: Support combinations of classes (e.g. style on p.class1.class2)
-    // 3. Apply element.class styles (higher priority)
-    for (const auto& cls : classes) {
-      std::string combinedKey = tag + "." + normalized(cls);
-
-      auto combinedIt = rulesBySelector_.find(combinedKey);
-      if (combinedIt != rulesBySelector_.end()) {
-        result.applyOver(combinedIt->second);
+  forEachToken(classAttr, [&](const std::string_view cls) {
+    const uint16_t classAtom = findAtom(LowercaseName(cls).view());
+    if (classAtom == NO_ATOM) return;
+    if (const CssStyle* style = findRule(NO_ATOM, classAtom)) {
+      result.applyOver(*style);
+    }
+  });
+
+  // TODO: Support combinations of classes (e.g. style on p.class1.class2)
+  // 3. Apply element.class styles (higher priority)
+  if (tagAtom != NO_ATOM) {
+    forEachToken(classAttr, [&](const std::string_view cls) {
+      const uint16_t classAtom = findAtom(LowercaseName(cls).view());
+      if (classAtom == NO_ATOM) return;
+      if (const CssStyle* style = findRule(tagAtom, classAtom)) {
+        result.applyOver(*style);
       }
-    }
+    });
   }
 
+  memo.valid = true;
+  memo.tagAtom = tagAtom;
+  memo.classHash = classHash;
+  memo.style = result;
   return result;
 }
 
@@ -644,6 +793,109 @@ void CssParser::deleteCache() const {
   if (hasCache()) Storage.remove((cachePath + rulesCache).c_str());
 }
 
+namespace {
+
+void writeStyle(FsFile& file, const CssStyle& style) {
+  // Write CssStyle fields (all are POD types)
+  file.write(static_cast<uint8_t>(style.textAlign));
+  file.write(static_cast<uint8_t>(style.fontStyle));
+  file.write(static_cast<uint8_t>(style.fontWeight));
+  file.write(static_cast<uint8_t>(style.textDecoration));
+
+  // Write CssLength fields (value + unit)
+  auto writeLength = [&file](const CssLength& len) {
+    file.write(reinterpret_cast<const uint8_t*>(&len.value), sizeof(len.value));
+    file.write(static_cast<uint8_t>(len.unit));
+  };
+
+  writeLength(style.textIndent);
+  writeLength(style.marginTop);
+  writeLength(style.marginBottom);
+  writeLength(style.marginLeft);
+  writeLength(style.marginRight);
+  writeLength(style.paddingTop);
+  writeLength(style.paddingBottom);
+  writeLength(style.paddingLeft);
+  writeLength(style.paddingRight);
+  writeLength(style.imageHeight);
+  writeLength(style.imageWidth);
+
+  // Write defined flags as uint16_t
+  uint16_t definedBits = 0;
+  if (style.defined.textAlign) definedBits |= 1 << 0;
+  if (style.defined.fontStyle) definedBits |= 1 << 1;
+  if (style.defined.fontWeight) definedBits |= 1 << 2;
+  if (style.defined.textDecoration) definedBits |= 1 << 3;
+  if (style.defined.textIndent) definedBits |= 1 << 4;
+  if (style.defined.marginTop) definedBits |= 1 << 5;
+  if (style.defined.marginBottom) definedBits |= 1 << 6;
+  if (style.defined.marginLeft) definedBits |= 1 << 7;
+  if (style.defined.marginRight) definedBits |= 1 << 8;
+  if (style.defined.paddingTop) definedBits |= 1 << 9;
+  if (style.defined.paddingBottom) definedBits |= 1 << 10;
+  if (style.defined.paddingLeft) definedBits |= 1 << 11;
+  if (style.defined.paddingRight) definedBits |= 1 << 12;
+  if (style.defined.imageHeight) definedBits |= 1 << 13;
+  if (style.defined.imageWidth) definedBits |= 1 << 14;
+  file.write(reinterpret_cast<const uint8_t*>(&definedBits), sizeof(definedBits));
+}
+
+bool readStyle(FsFile& file, CssStyle& style) {
+  // Read CssStyle fields
+  uint8_t enumVals[4];
+  if (file.read(enumVals, sizeof(enumVals)) != sizeof(enumVals)) {
+    return false;
+  }
+  style.textAlign = static_cast<CssTextAlign>(enumVals[0]);
+  style.fontStyle = static_cast<CssFontStyle>(enumVals[1]);
+  style.fontWeight = static_cast<CssFontWeight>(enumVals[2]);
+  style.textDecoration = static_cast<CssTextDecoration>(enumVals[3]);
+
+  // Read CssLength fields
+  auto readLength = [&file](CssLength& len) -> bool {
+    if (file.read(&len.value, sizeof(len.value)) != sizeof(len.value)) {
+      return false;
+    }
+    uint8_t unitVal;
+    if (file.read(&unitVal, 1) != 1) {
+      return false;
+    }
+    len.unit = static_cast<CssUnit>(unitVal);
+    return true;
+  };
+
+  if (!readLength(style.textIndent) || !readLength(style.marginTop) || !readLength(style.marginBottom) ||
+      !readLength(style.marginLeft) || !readLength(style.marginRight) || !readLength(style.paddingTop) ||
+      !readLength(style.paddingBottom) || !readLength(style.paddingLeft) || !readLength(style.paddingRight) ||
+      !readLength(style.imageHeight) || !readLength(style.imageWidth)) {
+    return false;
+  }
+
+  // Read defined flags
+  uint16_t definedBits = 0;
+  if (file.read(&definedBits, sizeof(definedBits)) != sizeof(definedBits)) {
+    return false;
+  }
+  style.defined.textAlign = (definedBits & 1 << 0) != 0;
+  style.defined.fontStyle = (definedBits & 1 << 1) != 0;
+  style.defined.fontWeight = (definedBits & 1 << 2) != 0;
+  style.defined.textDecoration = (definedBits & 1 << 3) != 0;
+  style.defined.textIndent = (definedBits & 1 << 4) != 0;
+  style.defined.marginTop = (definedBits & 1 << 5) != 0;
+  style.defined.marginBottom = (definedBits & 1 << 6) != 0;
+  style.defined.marginLeft = (definedBits & 1 << 7) != 0;
+  style.defined.marginRight = (definedBits & 1 << 8) != 0;
+  style.defined.paddingTop = (definedBits & 1 << 9) != 0;
+  style.defined.paddingBottom = (definedBits & 1 << 10) != 0;
+  style.defined.paddingLeft = (definedBits & 1 << 11) != 0;
+  style.defined.paddingRight = (definedBits & 1 << 12) != 0;
+  style.defined.imageHeight = (definedBits & 1 << 13) != 0;
+  style.defined.imageWidth = (definedBits & 1 << 14) != 0;
+  return true;
+}
+
+}  // namespace
+
 bool CssParser::saveToCache() const {
   if (cachePath.empty()) {
     return false;
@@ -657,63 +909,28 @@ bool CssParser::saveToCache() const {
   // Write version
   file.write(CssParser::CSS_CACHE_VERSION);
 
+  // Write the atom table: sorted names (length-prefixed)
+  const auto atomCount = static_cast<uint16_t>(atomEnds_.size());
+  file.write(reinterpret_cast<const uint8_t*>(&atomCount), sizeof(atomCount));
+  for (uint16_t i = 0; i < atomCount; ++i) {
+    const std::string_view name = atomName(i);
+    const auto nameLen = static_cast<uint16_t>(name.size());
+    file.write(reinterpret_cast<const uint8_t*>(&nameLen), sizeof(nameLen));
+    file.write(reinterpret_cast<const uint8_t*>(name.data()), nameLen);
+  }
+
   // Write rule count
-  const auto ruleCount = static_cast<uint16_t>(rulesBySelector_.size());
+  const auto ruleCount = static_cast<uint16_t>(rules_.size());
   file.write(reinterpret_cast<const uint8_t*>(&ruleCount), sizeof(ruleCount));
 
-  // Write each rule: selector string + CssStyle fields
-  for (const auto& pair : rulesBySelector_) {
-    // Write selector string (length-prefixed)
-    const auto selectorLen = static_cast<uint16_t>(pair.first.size());
-    file.write(reinterpret_cast<const uint8_t*>(&selectorLen), sizeof(selectorLen));
-    file.write(reinterpret_cast<const uint8_t*>(pair.first.data()), selectorLen);
-
-    // Write CssStyle fields (all are POD types)
-    const CssStyle& style = pair.second;
-    file.write(static_cast<uint8_t>(style.textAlign));
-    file.write(static_cast<uint8_t>(style.fontStyle));
-    file.write(static_cast<uint8_t>(style.fontWeight));
-    file.write(static_cast<uint8_t>(style.textDecoration));
-
-    // Write CssLength fields (value + unit)
-    auto writeLength = [&file](const CssLength& len) {
-      file.write(reinterpret_cast<const uint8_t*>(&len.value), sizeof(len.value));
-      file.write(static_cast<uint8_t>(len.unit));
-    };
-
-    writeLength(style.textIndent);
-    writeLength(style.marginTop);
-    writeLength(style.marginBottom);
-    writeLength(style.marginLeft);
-    writeLength(style.marginRight);
-    writeLength(style.paddingTop);
-    writeLength(style.paddingBottom);
-    writeLength(style.paddingLeft);
-    writeLength(style.paddingRight);
-    writeLength(style.imageHeight);
-    writeLength(style.imageWidth);
-
-    // Write defined flags as uint16_t
-    uint16_t definedBits = 0;
-    if (style.defined.textAlign) definedBits |= 1 << 0;
-    if (style.defined.fontStyle) definedBits |= 1 << 1;
-    if (style.defined.fontWeight) definedBits |= 1 << 2;
-    if (style.defined.textDecoration) definedBits |= 1 << 3;
-    if (style.defined.textIndent) definedBits |= 1 << 4;
-    if (style.defined.marginTop) definedBits |= 1 << 5;
-    if (style.defined.marginBottom) definedBits |= 1 << 6;
-    if (style.defined.marginLeft) definedBits |= 1 << 7;
-    if (style.defined.marginRight) definedBits |= 1 << 8;
-    if (style.defined.paddingTop) definedBits |= 1 << 9;
-    if (style.defined.paddingBottom) definedBits |= 1 << 10;
-    if (style.defined.paddingLeft) definedBits |= 1 << 11;
-    if (style.defined.paddingRight) definedBits |= 1 << 12;
-    if (style.defined.imageHeight) definedBits |= 1 << 13;
-    if (style.defined.imageWidth) definedBits |= 1 << 14;
-    file.write(reinterpret_cast<const uint8_t*>(&definedBits), sizeof(definedBits));
-  }
-
-  LOG_DBG("CSS", "Saved %u rules to cache", ruleCount);
+  // Write each rule in lookup order: tag atom + class atom + CssStyle fields
+  for (const auto& rule : rules_) {
+    file.write(reinterpret_cast<const uint8_t*>(&rule.tagAtom), sizeof(rule.tagAtom));
+    file.write(reinterpret_cast<const uint8_t*>(&rule.classAtom), sizeof(rule.classAtom));
+    writeStyle(file, rule.style);
+  }
+
+  LOG_DBG("CSS", "Saved %u rules (%u names) to cache", ruleCount, atomCount);
   file.close();
   return true;
 }
@@ -741,112 +958,49 @@ bool CssParser::loadFromCache() {
     return false;
   }
 
-  // Read rule count
-  uint16_t ruleCount = 0;
-  if (file.read(&ruleCount, sizeof(ruleCount)) != sizeof(ruleCount)) {
+  const auto fail = [this, &file]() {
+    clear();
     file.close();
     return false;
-  }
-
-  // Read each rule
-  for (uint16_t i = 0; i < ruleCount; ++i) {
-    // Read selector string
-    uint16_t selectorLen = 0;
-    if (file.read(&selectorLen, sizeof(selectorLen)) != sizeof(selectorLen)) {
-      rulesBySelector_.clear();
-      file.close();
-      return false;
-    }
-
-    std::string selector;
-    selector.resize(selectorLen);
-    if (file.read(&selector[0], selectorLen) != selectorLen) {
-      rulesBySelector_.clear();
-      file.close();
-      return false;
-    }
-
-    // Read CssStyle fields
-    CssStyle style;
-    uint8_t enumVal;
-
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
-      file.close();
-      return false;
-    }
-    style.textAlign = static_cast<CssTextAlign>(enumVal);
-
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
-      file.close();
-      return false;
-    }
-    style.fontStyle = static_cast<CssFontStyle>(enumVal);
+  };
 
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
-      file.close();
-      return false;
-    }
-    style.fontWeight = static_cast<CssFontWeight>(enumVal);
+  // Read the atom table
+  uint16_t atomCount = 0;
+  if (file.read(&atomCount, sizeof(atomCount)) != sizeof(atomCount) || atomCount == NO_ATOM) {
+    return fail();
+  }
+  atomEnds_.reserve(atomCount);
+  for (uint16_t i = 0; i < atomCount; ++i) {
+    uint16_t nameLen = 0;
+    if (file.read(&nameLen, sizeof(nameLen)) != sizeof(nameLen)) {
+      return fail();
+    }
+    const size_t start = atomPool_.size();
+    atomPool_.resize(start + nameLen);
+    if (file.read(&atomPool_[start], nameLen) != nameLen) {
+      return fail();
+    }
+    atomEnds_.push_back(static_cast<uint32_t>(atomPool_.size()));
+  }
 
-    if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
-      file.close();
-      return false;
-    }
-    style.textDecoration = static_cast<CssTextDecoration>(enumVal);
+  // Read rule count
+  uint16_t ruleCount = 0;
+  if (file.read(&ruleCount, sizeof(ruleCount)) != sizeof(ruleCount)) {
+    return fail();
+  }
 
-    // Read CssLength fields
-    auto readLength = [&file](CssLength& len) -> bool {
-      if (file.read(&len.value, sizeof(len.value)) != sizeof(len.value)) {
-        return false;
-      }
-      uint8_t unitVal;
-      if (file.read(&unitVal, 1) != 1) {
-        return false;
-      }
-      len.unit = static_cast<CssUnit>(unitVal);
-      return true;
-    };
-
-    if (!readLength(style.textIndent) || !readLength(style.marginTop) || !readLength(style.marginBottom) ||
-        !readLength(style.marginLeft) || !readLength(style.marginRight) || !readLength(style.paddingTop) ||
-        !readLength(style.paddingBottom) || !readLength(style.paddingLeft) || !readLength(style.paddingRight) ||
-        !readLength(style.imageHeight) || !readLength(style.imageWidth)) {
-      rulesBySelector_.clear();
-      file.close();
-      return false;
+  // Read each rule, already in lookup order
+  rules_.resize(ruleCount);
+  for (auto& rule : rules_) {
+    if (file.read(&rule.tagAtom, sizeof(rule.tagAtom)) != sizeof(rule.tagAtom) ||
+        file.read(&rule.classAtom, sizeof(rule.classAtom)) != sizeof(rule.classAtom) ||
+        (rule.tagAtom != NO_ATOM && rule.tagAtom >= atomCount) ||
+        (rule.classAtom != NO_ATOM && rule.classAtom >= atomCount) || !readStyle(file, rule.style)) {
+      return fail();
     }
+  }
 
-    // Read defined flags
-    uint16_t definedBits = 0;
-    if (file.read(&definedBits, sizeof(definedBits)) != sizeof(definedBits)) {
-      rulesBySelector_.clear();
-      file.close();
-      return false;
-    }
-    style.defined.textAlign = (definedBits & 1 << 0) != 0;
-    style.defined.fontStyle = (definedBits & 1 << 1) != 0;
-    style.defined.fontWeight = (definedBits & 1 << 2) != 0;
-    style.defined.textDecoration = (definedBits & 1 << 3) != 0;
-    style.defined.textIndent = (definedBits & 1 << 4) != 0;
-    style.defined.marginTop = (definedBits & 1 << 5) != 0;
-    style.defined.marginBottom = (definedBits & 1 << 6) != 0;
-    style.defined.marginLeft = (definedBits & 1 << 7) != 0;
-    style.defined.marginRight = (definedBits & 1 << 8) != 0;
-    style.defined.paddingTop = (definedBits & 1 << 9) != 0;
-    style.defined.paddingBottom = (definedBits & 1 << 10) != 0;
-    style.defined.paddingLeft = (definedBits & 1 << 11) != 0;
-    style.defined.paddingRight = (definedBits & 1 << 12) != 0;
-    style.defined.imageHeight = (definedBits & 1 << 13) != 0;
-    style.defined.imageWidth = (definedBits & 1 << 14) != 0;
-
-    rulesBySelector_[selector] = style;
-  }
-
-  LOG_DBG("CSS", "Loaded %u rules from cache", ruleCount);
+  LOG_DBG("CSS", "Loaded %u rules (%u names) from cache", ruleCount, atomCount);
   file.close();
   return true;
 }
@@ -2,7 +2,9 @@
 
 #include <HalStorage.h>
 
+#include <array>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -22,6 +24,9 @@
  *   - Combined: element.classname
  *   - Grouped: selector1, selector2 { }
  *
+ * Rules are compiled for lookup: tag and class names become atoms (indexes into a sorted name table) and rules are
+ * sorted by (tag atom, class atom). The cache stores the compiled form, so resolving a style allocates nothing.
+ *
  * Not supported (silently ignored):
  *   - Descendant/child selectors
  *   - Pseudo-classes and pseudo-elements
@@ -31,7 +36,7 @@
 class CssParser {
  public:
   // Bump when CSS cache format or rules change; section caches are invalidated when this changes
-  static constexpr uint8_t CSS_CACHE_VERSION = 3;
+  static constexpr uint8_t CSS_CACHE_VERSION = 4;
 
   explicit CssParser(std::string cachePath) : cachePath(std::move(cachePath)) {}
   ~CssParser() = default;
@@ -51,12 +56,13 @@ class CssParser {
   /**
    * Look up the style for an HTML element, considering tag name and class attributes.
    * Applies CSS cascade: element style < class style < element.class style
+   * Results are memoized by (tag, class attribute) until the rules next change, i.e. for the chapter being laid out.
    *
    * @param tagName The HTML element name (e.g., "p", "div")
    * @param classAttr The class attribute value (may contain multiple space-separated classes)
    * @return Combined style with all applicable rules merged
    */
-  [[nodiscard]] CssStyle resolveStyle(const std::string& tagName, const std::string& classAttr) const;
+  [[nodiscard]] CssStyle resolveStyle(std::string_view tagName, std::string_view classAttr) const;
 
   /**
    * Parse an inline style attribute string.
@@ -68,17 +74,17 @@ class CssParser {
   /**
    * Check if any rules have been loaded
    */
-  [[nodiscard]] bool empty() const { return rulesBySelector_.empty(); }
+  [[nodiscard]] bool empty() const { return rules_.empty(); }
 
   /**
    * Get count of loaded rule sets
    */
-  [[nodiscard]] size_t ruleCount() const { return rulesBySelector_.size(); }
+  [[nodiscard]] size_t ruleCount() const { return rules_.size(); }
 
   /**
    * Clear all loaded rules
    */
-  void clear() { rulesBySelector_.clear(); }
+  void clear();
 
   /**
    * Check if CSS rules cache file exists
@@ -104,11 +110,40 @@ class CssParser {
   bool loadFromCache();
 
  private:
-  // Storage: maps normalized selector -> style properties
+  // Parsing storage: maps normalized selector -> style properties, merged across stylesheets
   std::unordered_map<std::string, CssStyle> rulesBySelector_;
 
+  // Lookup storage, compiled from rulesBySelector_ or read from the cache. Atom i is the name
+  // atomPool_[atomEnds_[i - 1], atomEnds_[i]); names are sorted. NO_ATOM stands for a selector without tag or class.
+  static constexpr uint16_t NO_ATOM = 0xFFFF;
+  struct CompiledRule {
+    uint16_t tagAtom;
+    uint16_t classAtom;
+    CssStyle style;
+  };
+  std::string atomPool_;
+  std::vector<uint32_t> atomEnds_;
+  std::vector<CompiledRule> rules_;  // Sorted by (tagAtom, classAtom)
+
+  // Resolved styles by (tag atom, hash of the class attribute), direct mapped
+  struct MemoEntry {
+    uint64_t classHash;
+    uint16_t tagAtom;
+    bool valid;
+    CssStyle style;
+  };
+  static constexpr size_t MEMO_SIZE = 16;
+  mutable std::array<MemoEntry, MEMO_SIZE> memo_{};
+
   std::string cachePath;
 
+  // Rule compilation and lookup
+  void compileRules();
+  void resetMemo() const;
+  [[nodiscard]] std::string_view atomName(uint16_t atom) const;
+  [[nodiscard]] uint16_t findAtom(std::string_view lowercaseName) const;
+  [[nodiscard]] const CssStyle* findRule(uint16_t tagAtom, uint16_t classAtom) const;
+
   // Internal parsing helpers
   void processRuleBlockWithStyle(const std::string& selectorGroup, const CssStyle& style);
   static CssStyle parseDeclarations(const std::string& declBlock);
@@ -138,14 +138,14 @@ bool isExplicitHyphen(const uint32_t cp) {
 
 bool isSoftHyphen(const uint32_t cp) { return cp == 0x00AD; }
 
-void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
-  if (cps.empty()) {
+void trimSurroundingPunctuationAndFootnote(const CodepointInfo*& cps, size_t& count) {
+  if (count == 0) {
     return;
   }
 
   // Remove trailing footnote references like [12], even if punctuation trails after the closing bracket.
-  if (cps.size() >= 3) {
-    int end = static_cast<int>(cps.size()) - 1;
+  if (count >= 3) {
+    int end = static_cast<int>(count) - 1;
     while (end >= 0 && isPunctuation(cps[end].value)) {
       --end;
     }
@@ -155,22 +155,31 @@ void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
         --pos;
       }
       if (pos >= 0 && cps[pos].value == '[' && end - pos > 1) {
-        cps.erase(cps.begin() + pos, cps.end());
+        count = static_cast<size_t>(pos);
       }
     }
   }
 
-  while (!cps.empty() && isPunctuation(cps.front().value)) {
-    cps.erase(cps.begin());
+  while (count > 0 && isPunctuation(cps[0].value)) {
+    ++cps;
+    --count;
   }
-  while (!cps.empty() && isPunctuation(cps.back().value)) {
-    cps.pop_back();
+  while (count > 0 && isPunctuation(cps[count - 1].value)) {
+    --count;
   }
 }
 
-std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
-  std::vector<CodepointInfo> cps;
-  cps.reserve(word.size());
+void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
+  const CodepointInfo* begin = cps.data();
+  size_t count = cps.size();
+  trimSurroundingPunctuationAndFootnote(begin, count);
+  const auto first = static_cast<size_t>(begin - cps.data());
+  cps.erase(cps.begin() + static_cast<std::ptrdiff_t>(first + count), cps.end());
+  cps.erase(cps.begin(), cps.begin() + static_cast<std::ptrdiff_t>(first));
+}
+
+size_t collectCodepoints(const std::string& word, CodepointInfo* out) {
+  size_t count = 0;
 
   const unsigned char* base = reinterpret_cast<const unsigned char*>(word.c_str());
   const unsigned char* ptr = base;
@@ -184,8 +193,8 @@ std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
     // common Western European diacritics (acute, grave, circumflex, tilde,
     // diaeresis, cedilla) without pulling in a full Unicode normalization
     // library.
-    if (!cps.empty()) {
-      uint32_t prev = cps.back().value;
+    if (count > 0) {
+      uint32_t prev = out[count - 1].value;
       uint32_t composed = 0;
       switch (cp) {
         case 0x0300:  // grave
@@ -379,13 +388,19 @@ std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
       }
 
       if (composed != 0) {
-        cps.back().value = composed;
+        out[count - 1].value = composed;
         continue;  // skip pushing the combining mark itself
       }
     }
 
-    cps.push_back({cp, static_cast<size_t>(current - base)});
+    out[count++] = {cp, static_cast<size_t>(current - base)};
   }
 
+  return count;
+}
+
+std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
+  std::vector<CodepointInfo> cps(word.size());
+  cps.resize(collectCodepoints(word, cps.data()));
   return cps;
 }
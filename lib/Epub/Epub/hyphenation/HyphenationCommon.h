@@ -21,5 +21,10 @@ bool isPunctuation(uint32_t cp);
 bool isAsciiDigit(uint32_t cp);
 bool isExplicitHyphen(uint32_t cp);
 bool isSoftHyphen(uint32_t cp);
+// Narrows [cps, cps + count) to leave out surrounding punctuation and a trailing footnote reference like "[12]".
+void trimSurroundingPunctuationAndFootnote(const CodepointInfo*& cps, size_t& count);
 void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps);
+// Decodes `word` into `out`, which must have room for word.size() entries (a word has at most one codepoint per byte).
+// Returns the number of codepoints written.
+size_t collectCodepoints(const std::string& word, CodepointInfo* out);
 std::vector<CodepointInfo> collectCodepoints(const std::string& word);
@@ -1,6 +1,8 @@
 #include "Hyphenator.h"
 
 #include <algorithm>
+#include <memory>
+#include <new>
 #include <vector>
 
 #include "HyphenationCommon.h"
@@ -28,12 +30,82 @@ const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
   return getLanguageHyphenatorForPrimaryTag(primary);
 }
 
+// Words up to this many bytes are decoded into a stack buffer; longer ones (URLs, say) fall back to the heap.
+constexpr size_t MAX_STACK_WORD_BYTES = 64;
+// Pattern breaks per word or segment. Liang skips words longer than ~68 codepoints, so this is rarely a limit.
+constexpr size_t MAX_PATTERN_BREAKS = 64;
+
+// Open-addressed memo from word hash to packed break offsets. Books repeat the same words across every chapter, and
+// most of them have no breaks at all, which is just as worth remembering. Words of 128 bytes or more and words with
+// more than MEMO_MAX_BREAKS breaks are not memoized.
+constexpr size_t MEMO_SLOTS = 512;
+constexpr size_t MEMO_PROBES = 4;
+constexpr size_t MEMO_MAX_BREAKS = 10;
+constexpr uint8_t MEMO_INSERTED_HYPHEN = 0x80;  // Flag bit of a packed break; the low 7 bits are the byte offset
+
+struct MemoEntry {
+  uint32_t hash;   // Low bits of the word's FNV-1a hash with the fallback flag mixed in, never 0; 0 = empty slot
+  uint16_t check;  // High bits of the same hash, so a false hit needs a 48-bit collision
+  uint8_t wordLength;
+  uint8_t breakCount;
+  uint8_t breaks[MEMO_MAX_BREAKS];
+};
+
+std::unique_ptr<MemoEntry[]> memo;
+
+uint64_t memoHash(const std::string& word, const bool includeFallback) {
+  uint64_t hash = 14695981039346656037ull;
+  for (const char c : word) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ull;
+  }
+  hash ^= includeFallback ? 1u : 2u;
+  hash *= 1099511628211ull;
+  return hash;
+}
+
+const MemoEntry* findMemo(const uint64_t hash, const size_t wordLength) {
+  const uint32_t low = static_cast<uint32_t>(hash) | 1u;
+  const auto check = static_cast<uint16_t>(hash >> 48);
+  for (size_t probe = 0; probe < MEMO_PROBES; ++probe) {
+    const MemoEntry& entry = memo[(low + probe) % MEMO_SLOTS];
+    if (entry.hash == 0) {
+      return nullptr;
+    }
+    if (entry.hash == low && entry.check == check && entry.wordLength == wordLength) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+void storeMemo(const uint64_t hash, const size_t wordLength, const Hyphenator::BreakInfo* breaks, const size_t count) {
+  const uint32_t low = static_cast<uint32_t>(hash) | 1u;
+  // Take the first free slot along the probe sequence, or evict the word in the home slot
+  MemoEntry* slot = &memo[low % MEMO_SLOTS];
+  for (size_t probe = 0; probe < MEMO_PROBES; ++probe) {
+    MemoEntry& entry = memo[(low + probe) % MEMO_SLOTS];
+    if (entry.hash == 0) {
+      slot = &entry;
+      break;
+    }
+  }
+  slot->hash = low;
+  slot->check = static_cast<uint16_t>(hash >> 48);
+  slot->wordLength = static_cast<uint8_t>(wordLength);
+  slot->breakCount = static_cast<uint8_t>(count);
+  for (size_t i = 0; i < count; ++i) {
+    slot->breaks[i] =
+        static_cast<uint8_t>(breaks[i].byteOffset | (breaks[i].requiresInsertedHyphen ? MEMO_INSERTED_HYPHEN : 0));
+  }
+}
+
 // Maps a codepoint index back to its byte offset inside the source word.
-size_t byteOffsetForIndex(const std::vector<CodepointInfo>& cps, const size_t index) {
-  return (index < cps.size()) ? cps[index].byteOffset : (cps.empty() ? 0 : cps.back().byteOffset);
+size_t byteOffsetForIndex(const CodepointInfo* cps, const size_t count, const size_t index) {
+  return (index < count) ? cps[index].byteOffset : (count == 0 ? 0 : cps[count - 1].byteOffset);
 }
 
-// Builds a vector of break information from explicit hyphen markers in the given codepoints.
+// Writes break information from explicit hyphen markers in the given codepoints into `out`.
 // Only hyphens that appear between two alphabetic characters are considered valid breaks.
 //
 // Example: "US-Satellitensystems" (cps: U, S, -, S, a, t, ...)
@@ -44,36 +116,30 @@ size_t byteOffsetForIndex(const std::vector<CodepointInfo>& cps, const size_t in
 // Example: "Satel\u00ADliten" (soft-hyphen between 'l' and 'l')
 //   -> returns one BreakInfo with requiresInsertedHyphen=true (soft-hyphen
 //      is invisible and needs a visible '-' when the break is used).
-std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<CodepointInfo>& cps) {
-  std::vector<Hyphenator::BreakInfo> breaks;
+size_t buildExplicitBreakInfos(const CodepointInfo* cps, const size_t count, Hyphenator::BreakInfo* out,
+                               const size_t capacity) {
+  size_t written = 0;
 
-  for (size_t i = 1; i + 1 < cps.size(); ++i) {
+  for (size_t i = 1; i + 1 < count && written < capacity; ++i) {
     const uint32_t cp = cps[i].value;
     if (!isExplicitHyphen(cp) || !isAlphabetic(cps[i - 1].value) || !isAlphabetic(cps[i + 1].value)) {
       continue;
     }
     // Offset points to the next codepoint so rendering starts after the hyphen marker.
-    breaks.push_back({cps[i + 1].byteOffset, isSoftHyphen(cp)});
+    out[written++] = {cps[i + 1].byteOffset, isSoftHyphen(cp)};
   }
 
-  return breaks;
+  return written;
 }
 
-}  // namespace
-
-std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
-  if (word.empty()) {
-    return {};
-  }
-
-  // Convert to codepoints and normalize word boundaries.
-  auto cps = collectCodepoints(word);
-  trimSurroundingPunctuationAndFootnote(cps);
-  const auto* hyphenator = cachedHyphenator_;
+size_t computeBreakOffsets(const CodepointInfo* cps, const size_t count, const LanguageHyphenator* hyphenator,
+                           const bool includeFallback, Hyphenator::BreakInfo* out, const size_t capacity) {
+  using BreakInfo = Hyphenator::BreakInfo;
+  size_t indexes[MAX_PATTERN_BREAKS];
 
   // Explicit hyphen markers (soft or hard) take precedence over language breaks.
-  auto explicitBreakInfos = buildExplicitBreakInfos(cps);
-  if (!explicitBreakInfos.empty()) {
+  size_t written = buildExplicitBreakInfos(cps, count, out, capacity);
+  if (written > 0) {
     // When a word contains explicit hyphens we also run Liang patterns on each alphabetic
     // segment between them. Without this, "US-Satellitensystems" would only offer one split
     // point (after "US-"), making it impossible to break mid-"Satellitensystems" even when
@@ -90,17 +156,17 @@ std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& w
     //   Result: 6 sorted break points; the line-breaker picks the widest prefix that fits.
     if (hyphenator) {
       size_t segStart = 0;
-      for (size_t i = 0; i <= cps.size(); ++i) {
-        const bool atEnd = (i == cps.size());
+      for (size_t i = 0; i <= count; ++i) {
+        const bool atEnd = (i == count);
         const bool atHyphen = !atEnd && isExplicitHyphen(cps[i].value);
         if (atEnd || atHyphen) {
           if (i > segStart) {
-            std::vector<CodepointInfo> segment(cps.begin() + segStart, cps.begin() + i);
-            auto segIndexes = hyphenator->breakIndexes(segment);
-            for (const size_t idx : segIndexes) {
-              const size_t cpIdx = segStart + idx;
-              if (cpIdx < cps.size()) {
-                explicitBreakInfos.push_back({cps[cpIdx].byteOffset, true});
+            const size_t segBreaks =
+                hyphenator->breakIndexes(cps + segStart, i - segStart, indexes, MAX_PATTERN_BREAKS);
+            for (size_t b = 0; b < segBreaks && written < capacity; ++b) {
+              const size_t cpIdx = segStart + indexes[b];
+              if (cpIdx < count) {
+                out[written++] = {cps[cpIdx].byteOffset, true};
               }
             }
           }
@@ -108,38 +174,86 @@ std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& w
         }
       }
       // Merge explicit and pattern breaks into ascending byte-offset order.
-      std::sort(explicitBreakInfos.begin(), explicitBreakInfos.end(),
+      std::sort(out, out + written,
                 [](const BreakInfo& a, const BreakInfo& b) { return a.byteOffset < b.byteOffset; });
     }
-    return explicitBreakInfos;
+    return written;
   }
 
   // Ask language hyphenator for legal break points.
-  std::vector<size_t> indexes;
-  if (hyphenator) {
-    indexes = hyphenator->breakIndexes(cps);
+  const size_t patternBreaks = hyphenator ? hyphenator->breakIndexes(cps, count, indexes, MAX_PATTERN_BREAKS) : 0;
+  for (size_t b = 0; b < patternBreaks && written < capacity; ++b) {
+    out[written++] = {byteOffsetForIndex(cps, count, indexes[b]), true};
   }
 
   // Only add fallback breaks if needed
-  if (includeFallback && indexes.empty()) {
+  if (includeFallback && patternBreaks == 0) {
     const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
     const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
-    for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
-      indexes.push_back(idx);
+    for (size_t idx = minPrefix; idx + minSuffix <= count && written < capacity; ++idx) {
+      out[written++] = {byteOffsetForIndex(cps, count, idx), true};
+    }
+  }
+
+  return written;
+}
+
+}  // namespace
+
+size_t Hyphenator::breakOffsets(const std::string& word, const bool includeFallback, BreakInfo* out,
+                                const size_t capacity) {
+  if (word.empty() || capacity == 0) {
+    return 0;
+  }
+
+  if (!memo) {
+    memo.reset(new (std::nothrow) MemoEntry[MEMO_SLOTS]());
+  }
+  const bool memoizable = memo && word.size() <= 0x7F;
+  const uint64_t hash = memoizable ? memoHash(word, includeFallback) : 0;
+  if (memoizable) {
+    if (const MemoEntry* entry = findMemo(hash, word.size())) {
+      const size_t count = std::min<size_t>(entry->breakCount, capacity);
+      for (size_t i = 0; i < count; ++i) {
+        out[i] = {static_cast<size_t>(entry->breaks[i] & ~MEMO_INSERTED_HYPHEN),
+                  (entry->breaks[i] & MEMO_INSERTED_HYPHEN) != 0};
+      }
+      return count;
     }
   }
 
-  if (indexes.empty()) {
-    return {};
+  // Convert to codepoints and normalize word boundaries.
+  CodepointInfo stackCps[MAX_STACK_WORD_BYTES];
+  std::vector<CodepointInfo> heapCps;
+  CodepointInfo* buffer = stackCps;
+  if (word.size() > MAX_STACK_WORD_BYTES) {
+    heapCps.resize(word.size());
+    buffer = heapCps.data();
   }
+  const CodepointInfo* cps = buffer;
+  size_t count = collectCodepoints(word, buffer);
+  trimSurroundingPunctuationAndFootnote(cps, count);
 
-  std::vector<Hyphenator::BreakInfo> breaks;
-  breaks.reserve(indexes.size());
-  for (const size_t idx : indexes) {
-    breaks.push_back({byteOffsetForIndex(cps, idx), true});
+  const size_t written = computeBreakOffsets(cps, count, cachedHyphenator_, includeFallback, out, capacity);
+  if (memoizable && written <= MEMO_MAX_BREAKS && written < capacity) {
+    storeMemo(hash, word.size(), out, written);
   }
+  return written;
+}
 
+std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
+  std::vector<BreakInfo> breaks(word.size());
+  breaks.resize(breakOffsets(word, includeFallback, breaks.data(), breaks.size()));
   return breaks;
 }
 
-void Hyphenator::setPreferredLanguage(const std::string& lang) { cachedHyphenator_ = hyphenatorForLanguage(lang); }
+void Hyphenator::setPreferredLanguage(const std::string& lang) {
+  const LanguageHyphenator* hyphenator = hyphenatorForLanguage(lang);
+  if (hyphenator != cachedHyphenator_ && memo) {
+    // Memoized breaks belong to the previous language
+    std::fill(memo.get(), memo.get() + MEMO_SLOTS, MemoEntry{});
+  }
+  cachedHyphenator_ = hyphenator;
+}
+
+void Hyphenator::releaseMemo() { memo.reset(); }
@@ -27,8 +27,17 @@ class Hyphenator {
   //   3. Fallback every-N-chars splitting (only when includeFallback is true AND no
   //      pattern breaks were found). Used as a last resort to prevent a single oversized
   //      word from overflowing the page width.
+  //
+  // Writes the breaks into `out` (at most `capacity`, in ascending byte order) and returns how many were written. A
+  // word has at most one break per byte, so word.size() entries always suffice. Words up to 64 bytes are processed in
+  // stack buffers, and results are memoized (see releaseMemo), so layout makes no heap allocations here.
+  static size_t breakOffsets(const std::string& word, bool includeFallback, BreakInfo* out, size_t capacity);
   static std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback);
 
+  // Frees the memo of recent results. It is allocated on first use and otherwise kept for as long as the language
+  // stays the same, across chapters and books.
+  static void releaseMemo();
+
   // Provide a publication-level language hint (e.g. "en", "en-US", "ru") used to select hyphenation rules.
   static void setPreferredLanguage(const std::string& lang);
 
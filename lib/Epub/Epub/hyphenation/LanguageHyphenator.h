@@ -13,6 +13,9 @@ class LanguageHyphenator {
   std::vector<size_t> breakIndexes(const std::vector<CodepointInfo>& cps) const {
     return liangBreakIndexes(cps, patterns_, config_);
   }
+  size_t breakIndexes(const CodepointInfo* cps, const size_t count, size_t* out, const size_t capacity) const {
+    return liangBreakIndexes(cps, count, patterns_, config_, out, capacity);
+  }
 
   size_t minPrefix() const { return config_.minPrefix; }
   size_t minSuffix() const { return config_.minSuffix; }
@@ -8,13 +8,14 @@
 #include <vector>
 
 #include "../FootnoteEntry.h"
+#include "../LayoutScratch.h"
 #include "../ParsedText.h"
-#include "../blocks/ImageBlock.h"
+#include "../WordWidthCache.h"
 #include "../blocks/TextBlock.h"
 #include "../css/CssParser.h"
 #include "../css/CssStyle.h"
 
-class Page;
+class PageBuilder;
 class GfxRenderer;
 class Epub;
 
@@ -22,10 +23,11 @@ class Epub;
 
 class ChapterHtmlSlimParser {
   std::shared_ptr<Epub> epub;
-  const std::string& filepath;
+  const std::string& itemHref;
   GfxRenderer& renderer;
-  std::function<void(std::unique_ptr<Page>)> completePageFn;
+  std::function<void(std::unique_ptr<PageBuilder>)> completePageFn;
   std::function<void()> popupFn;  // Popup callback
+  std::function<bool()> abortFn;  // Polled between read chunks, a true result stops the parse
   int depth = 0;
   int skipUntilDepth = INT_MAX;
   int boldUntilDepth = INT_MAX;
@@ -37,8 +39,11 @@ class ChapterHtmlSlimParser {
   int partWordBufferIndex = 0;
   bool nextWordContinues = false;  // true when next flushed word attaches to previous (inline element boundary)
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
-  std::unique_ptr<Page> currentPage = nullptr;
+  WordWidthCache widthCache;    // Word advances measured so far in this section, shared by its paragraphs
+  LayoutScratch layoutScratch;  // Line-breaking buffers of this parse, reused by its paragraphs
+  std::unique_ptr<PageBuilder> currentPage = nullptr;
   int16_t currentPageNextY = 0;
+  bool layoutFailed = false;  // A line could not be placed even on an empty page, the build is abandoned
   int fontId;
   float lineCompression;
   bool extraParagraphSpacing;
@@ -88,17 +93,18 @@ class ChapterHtmlSlimParser {
   static void XMLCALL endElement(void* userData, const XML_Char* name);
 
  public:
-  explicit ChapterHtmlSlimParser(std::shared_ptr<Epub> epub, const std::string& filepath, GfxRenderer& renderer,
+  explicit ChapterHtmlSlimParser(std::shared_ptr<Epub> epub, const std::string& itemHref, GfxRenderer& renderer,
                                  const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                  const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                  const uint16_t viewportHeight, const bool hyphenationEnabled,
-                                 const std::function<void(std::unique_ptr<Page>)>& completePageFn,
+                                 const std::function<void(std::unique_ptr<PageBuilder>)>& completePageFn,
                                  const bool embeddedStyle, const std::string& contentBase,
                                  const std::string& imageBasePath, const std::function<void()>& popupFn = nullptr,
-                                 const CssParser* cssParser = nullptr)
+                                 const CssParser* cssParser = nullptr,
+                                 const std::function<bool()>& abortFn = nullptr)
 
       : epub(epub),
-        filepath(filepath),
+        itemHref(itemHref),
         renderer(renderer),
         fontId(fontId),
         lineCompression(lineCompression),
@@ -109,6 +115,7 @@ class ChapterHtmlSlimParser {
         hyphenationEnabled(hyphenationEnabled),
         completePageFn(completePageFn),
         popupFn(popupFn),
+        abortFn(abortFn),
         cssParser(cssParser),
         embeddedStyle(embeddedStyle),
         contentBase(contentBase),
@@ -61,102 +61,210 @@ static inline void rotateCoordinates(const GfxRenderer::Orientation orientation,
 
 enum class TextRotation { None, Rotated90CW };
 
-// Shared glyph rendering logic for normal and rotated text.
-// Coordinate mapping and cursor advance direction are selected at compile time via the template parameter.
-template <TextRotation rotation>
-static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode renderMode,
-                           const EpdFontFamily& fontFamily, const uint32_t cp, int* cursorX, int* cursorY,
-                           const bool pixelState, const EpdFontFamily::Style style) {
-  const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
-  if (!glyph) {
-    LOG_ERR("GFX", "No glyph for codepoint %d", cp);
-    return;
-  }
+// Shared text layout walk for drawing, measuring-free shaping and rotated text: UTF-8 decoding, ligature
+// substitution, kerning and combining mark placement.
+// fn(glyph, penX, raiseBy) is called for every resolved glyph, where penX is the pen position along the text direction
+// relative to the text origin and raiseBy lifts combining marks clear of their base glyph.
+template <typename GlyphFn>
+static void forEachTextGlyph(const EpdFontFamily& font, const char* text, const EpdFontFamily::Style style,
+                             GlyphFn&& fn) {
+  constexpr int MIN_COMBINING_GAP_PX = 1;
+  int penX = 0;
+  int lastBaseX = 0;
+  int lastBaseAdvance = 0;
+  int lastBaseTop = 0;
 
-  const EpdFontData* fontData = fontFamily.getData(style);
-  const bool is2Bit = fontData->is2Bit;
-  const uint8_t width = glyph->width;
-  const uint8_t height = glyph->height;
-  const int left = glyph->left;
-  const int top = glyph->top;
+  uint32_t cp;
+  uint32_t prevCp = 0;
+  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    if (utf8IsCombiningMark(cp)) {
+      const EpdGlyph* combiningGlyph = font.getGlyph(cp, style);
+      if (!combiningGlyph) {
+        LOG_ERR("GFX", "No glyph for codepoint %d", cp);
+        continue;
+      }
+      int raiseBy = 0;
+      const int currentGap = combiningGlyph->top - combiningGlyph->height - lastBaseTop;
+      if (currentGap < MIN_COMBINING_GAP_PX) {
+        raiseBy = MIN_COMBINING_GAP_PX - currentGap;
+      }
+      fn(combiningGlyph, lastBaseX + lastBaseAdvance / 2, raiseBy);
+      continue;
+    }
 
-  const uint8_t* bitmap = renderer.getGlyphBitmap(fontData, glyph);
+    cp = font.applyLigatures(cp, text, style);
+    if (prevCp != 0) {
+      penX += font.getKerning(prevCp, cp, style);
+    }
+
+    const EpdGlyph* glyph = font.getGlyph(cp, style);
+
+    lastBaseX = penX;
+    lastBaseAdvance = glyph ? glyph->advanceX : 0;
+    lastBaseTop = glyph ? glyph->top : 0;
 
-  if (bitmap != nullptr) {
-    // For Normal:  outer loop advances screenY, inner loop advances screenX
-    // For Rotated: outer loop advances screenX, inner loop advances screenY (in reverse)
-    int outerBase, innerBase;
-    if constexpr (rotation == TextRotation::Rotated90CW) {
-      outerBase = *cursorX + fontData->ascender - top;  // screenX = outerBase + glyphY
-      innerBase = *cursorY - left;                      // screenY = innerBase - glyphX
+    if (glyph) {
+      fn(glyph, penX, 0);
+      penX += glyph->advanceX;
     } else {
-      outerBase = *cursorY - top;   // screenY = outerBase + glyphY
-      innerBase = *cursorX + left;  // screenX = innerBase + glyphX
+      LOG_ERR("GFX", "No glyph for codepoint %d", cp);
     }
+    prevCp = cp;
+  }
+}
 
-    if (is2Bit) {
-      int pixelPosition = 0;
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        const int outerCoord = outerBase + glyphY;
-        for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
-          int screenX, screenY;
-          if constexpr (rotation == TextRotation::Rotated90CW) {
-            screenX = outerCoord;
-            screenY = innerBase - glyphX;
-          } else {
-            screenX = innerBase + glyphX;
-            screenY = outerCoord;
-          }
-
-          const uint8_t byte = bitmap[pixelPosition >> 2];
-          const uint8_t bit_index = (3 - (pixelPosition & 3)) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
-
-          if (renderMode == GfxRenderer::BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            renderer.drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            renderer.drawPixel(screenX, screenY, false);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            renderer.drawPixel(screenX, screenY, false);
-          }
-        }
-      }
+// Writes one run of glyph pixels into a panel row, starting at panel column phyX and moving right. Pixels are read
+// from the glyph bitmap starting at pixel index pos and advancing by step, so a run can follow a glyph row (step +-1)
+// or a glyph column (step +-width). Lit pixels are gathered per framebuffer byte and written with a single AND / OR
+// instead of a read-modify-write per pixel.
+template <bool is2Bit>
+static inline void blitGlyphSpan(uint8_t* row, const int phyX, const int count, const uint8_t* bitmap, int pos,
+                                 const int step, const uint8_t litMask, const bool clear) {
+  uint8_t* dst = row + (phyX >> 3);
+  uint8_t bit = 0x80 >> (phyX & 7);
+  uint8_t acc = 0;
+
+  for (int i = 0; i < count; i++, pos += step) {
+    // Branch-free: whether a glyph pixel is set is effectively random, a conditional here mispredicts constantly
+    uint8_t lit;
+    if constexpr (is2Bit) {
+      lit = (litMask >> ((bitmap[pos >> 2] >> ((3 - (pos & 3)) * 2)) & 0x3)) & 1;
     } else {
-      int pixelPosition = 0;
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        const int outerCoord = outerBase + glyphY;
-        for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
-          int screenX, screenY;
-          if constexpr (rotation == TextRotation::Rotated90CW) {
-            screenX = outerCoord;
-            screenY = innerBase - glyphX;
-          } else {
-            screenX = innerBase + glyphX;
-            screenY = outerCoord;
-          }
-
-          const uint8_t byte = bitmap[pixelPosition >> 3];
-          const uint8_t bit_index = 7 - (pixelPosition & 7);
-
-          if ((byte >> bit_index) & 1) {
-            renderer.drawPixel(screenX, screenY, pixelState);
-          }
-        }
-      }
+      lit = (bitmap[pos >> 3] >> (7 - (pos & 7))) & 1;
+    }
+    acc |= bit & -lit;
+
+    bit >>= 1;
+    if (bit == 0) {
+      *dst = clear ? (*dst & ~acc) : (*dst | acc);
+      dst++;
+      bit = 0x80;
+      acc = 0;
     }
   }
 
+  if (acc) {
+    *dst = clear ? (*dst & ~acc) : (*dst | acc);
+  }
+}
+
+// Shared glyph rendering logic for normal and rotated text.
+// The glyph is mapped straight to panel coordinates and drawn as runs along panel rows, so the orientation switch,
+// bounds check and byte / bit computation happen once per run rather than once per pixel (see drawPixel):
+// - LandscapeCounterClockwise is the panel's native orientation, glyph rows are panel rows.
+// - Portrait is rotated 90 degrees, glyph columns are panel rows (walked through the bitmap with a stride of width).
+// The other orientations are the same two cases walked in reverse.
+template <TextRotation rotation>
+static void renderGlyphImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode renderMode,
+                            const EpdFontData* fontData, const EpdGlyph* glyph, const int cursorX, const int cursorY,
+                            const bool pixelState) {
+  const int width = glyph->width;
+  const int height = glyph->height;
+  if (width == 0 || height == 0) {
+    return;
+  }
+
+  const uint8_t* bitmap = renderer.getGlyphBitmap(fontData, glyph);
+  if (bitmap == nullptr) {
+    return;
+  }
+
+  // Logical screen position of glyph pixel (0, 0) and the logical step for one pixel along a glyph row / column.
+  // For Normal:  screenX = cursorX + left + glyphX, screenY = cursorY - top + glyphY
+  // For Rotated: screenX = cursorX + ascender - top + glyphY, screenY = cursorY - left - glyphX
+  int originX, originY, rowStepX, rowStepY, colStepX, colStepY;
   if constexpr (rotation == TextRotation::Rotated90CW) {
-    *cursorY -= glyph->advanceX;
+    originX = cursorX + fontData->ascender - glyph->top;
+    originY = cursorY - glyph->left;
+    rowStepX = 0;
+    rowStepY = -1;
+    colStepX = 1;
+    colStepY = 0;
+  } else {
+    originX = cursorX + glyph->left;
+    originY = cursorY - glyph->top;
+    rowStepX = 1;
+    rowStepY = 0;
+    colStepX = 0;
+    colStepY = 1;
+  }
+
+  // Map the origin and both glyph axes to the panel
+  const GfxRenderer::Orientation orientation = renderer.getOrientation();
+  int phyX0 = 0, phyY0 = 0, phyRowX = 0, phyRowY = 0, phyColX = 0, phyColY = 0;
+  rotateCoordinates(orientation, originX, originY, &phyX0, &phyY0);
+  rotateCoordinates(orientation, originX + rowStepX, originY + rowStepY, &phyRowX, &phyRowY);
+  rotateCoordinates(orientation, originX + colStepX, originY + colStepY, &phyColX, &phyColY);
+  phyRowX -= phyX0;
+  phyRowY -= phyY0;
+  phyColX -= phyX0;
+  phyColY -= phyY0;
+
+  // Panel runs either follow glyph rows (one run per glyph row) or glyph columns (one run per glyph column)
+  const bool runsAlongRows = phyRowY == 0;
+  const int runCount = runsAlongRows ? height : width;
+  const int runLength = runsAlongRows ? width : height;
+  const int runPhyYStep = runsAlongRows ? phyColY : phyRowY;
+  const int runPosStep = runsAlongRows ? width : 1;
+  const bool reversed = (runsAlongRows ? phyRowX : phyColX) < 0;
+  int pixelStep = runsAlongRows ? 1 : width;
+  int firstPos = 0;
+  int firstPhyX = phyX0;
+  if (reversed) {
+    // Walk the run backwards through the bitmap so that panel x still increases
+    firstPos = (runLength - 1) * pixelStep;
+    firstPhyX = phyX0 - (runLength - 1);
+    pixelStep = -pixelStep;
+  }
+
+  // Horizontal clipping is the same for every run
+  int skip = 0;
+  int count = runLength;
+  if (firstPhyX < 0) {
+    skip = -firstPhyX;
+  }
+  if (firstPhyX + count > HalDisplay::DISPLAY_WIDTH) {
+    count = HalDisplay::DISPLAY_WIDTH - firstPhyX;
+  }
+  count -= skip;
+  if (count <= 0) {
+    return;
+  }
+  firstPos += skip * pixelStep;
+  firstPhyX += skip;
+
+  // Which raw bitmap values get drawn in this pass, as a bit mask indexed by the 2-bit value.
+  // The direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
+  uint8_t litMask;
+  bool clear;
+  if (!fontData->is2Bit || renderMode == GfxRenderer::BW) {
+    // Black (also paints over the grays in BW mode)
+    litMask = 0b1110;
+    clear = pixelState;
+  } else if (renderMode == GfxRenderer::GRAYSCALE_MSB) {
+    // Light gray (also mark the MSB if it's going to be a dark gray too)
+    // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
+    litMask = 0b0110;
+    clear = false;
   } else {
-    *cursorX += glyph->advanceX;
+    // Dark gray
+    litMask = 0b0100;
+    clear = false;
+  }
+
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  for (int run = 0; run < runCount; run++) {
+    const int phyY = phyY0 + run * runPhyYStep;
+    if (phyY < 0 || phyY >= HalDisplay::DISPLAY_HEIGHT) {
+      continue;
+    }
+    uint8_t* row = frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES;
+    const int pos = firstPos + run * runPosStep;
+    if (fontData->is2Bit) {
+      blitGlyphSpan<true>(row, firstPhyX, count, bitmap, pos, pixelStep, litMask, clear);
+    } else {
+      blitGlyphSpan<false>(row, firstPhyX, count, bitmap, pos, pixelStep, litMask, clear);
+    }
   }
 }
 
@@ -206,13 +314,6 @@ void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* te
 
 void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
                            const EpdFontFamily::Style style) const {
-  int yPos = y + getFontAscenderSize(fontId);
-  int xPos = x;
-  int lastBaseX = x;
-  int lastBaseY = yPos;
-  int lastBaseAdvance = 0;
-  int lastBaseTop = 0;
-
   // cannot draw a NULL / empty string
   if (text == nullptr || *text == '\0') {
     return;
@@ -224,41 +325,51 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
     return;
   }
   const auto& font = fontIt->second;
-  constexpr int MIN_COMBINING_GAP_PX = 1;
+  const EpdFontData* fontData = font.getData(style);
+  const int baseline = y + getFontAscenderSize(fontId);
 
-  uint32_t cp;
-  uint32_t prevCp = 0;
-  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    if (utf8IsCombiningMark(cp)) {
-      const EpdGlyph* combiningGlyph = font.getGlyph(cp, style);
-      int raiseBy = 0;
-      if (combiningGlyph) {
-        const int currentGap = combiningGlyph->top - combiningGlyph->height - lastBaseTop;
-        if (currentGap < MIN_COMBINING_GAP_PX) {
-          raiseBy = MIN_COMBINING_GAP_PX - currentGap;
-        }
-      }
+  forEachTextGlyph(font, text, style, [&](const EpdGlyph* glyph, const int penX, const int raiseBy) {
+    renderGlyph(fontData, glyph, x + penX, baseline - raiseBy, black);
+  });
+}
 
-      int combiningX = lastBaseX + lastBaseAdvance / 2;
-      int combiningY = lastBaseY - raiseBy;
-      renderChar(font, cp, &combiningX, &combiningY, black, style);
-      continue;
-    }
+void GfxRenderer::shapeText(const int fontId, const char* text, const EpdFontFamily::Style style,
+                            std::vector<ShapedGlyph>& out) const {
+  if (text == nullptr || *text == '\0') {
+    return;
+  }
 
-    cp = font.applyLigatures(cp, text, style);
-    if (prevCp != 0) {
-      xPos += font.getKerning(prevCp, cp, style);
-    }
+  const auto fontIt = fontMap.find(fontId);
+  if (fontIt == fontMap.end()) {
+    LOG_ERR("GFX", "Font %d not found", fontId);
+    return;
+  }
+  const auto& font = fontIt->second;
+  const EpdGlyph* glyphBase = font.getData(style)->glyph;
 
-    const EpdGlyph* glyph = font.getGlyph(cp, style);
+  forEachTextGlyph(font, text, style, [&](const EpdGlyph* glyph, const int penX, const int raiseBy) {
+    out.push_back({static_cast<uint16_t>(glyph - glyphBase), static_cast<int16_t>(penX),
+                   static_cast<int16_t>(raiseBy)});
+  });
+}
 
-    lastBaseX = xPos;
-    lastBaseY = yPos;
-    lastBaseAdvance = glyph ? glyph->advanceX : 0;
-    lastBaseTop = glyph ? glyph->top : 0;
+void GfxRenderer::drawShapedText(const int fontId, const int x, const int y, const ShapedGlyph* glyphs,
+                                 const size_t count, const bool black, const EpdFontFamily::Style style) const {
+  if (count == 0) {
+    return;
+  }
 
-    renderChar(font, cp, &xPos, &yPos, black, style);
-    prevCp = cp;
+  const auto fontIt = fontMap.find(fontId);
+  if (fontIt == fontMap.end()) {
+    LOG_ERR("GFX", "Font %d not found", fontId);
+    return;
+  }
+  const EpdFontData* fontData = fontIt->second.getData(style);
+  const int baseline = y + getFontAscenderSize(fontId);
+
+  for (size_t i = 0; i < count; i++) {
+    const ShapedGlyph& shaped = glyphs[i];
+    renderGlyph(fontData, &fontData->glyph[shaped.glyphIndex], x + shaped.x, baseline - shaped.raise, black);
   }
 }
 
@@ -1033,55 +1144,57 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
   }
 
   const auto& font = fontIt->second;
+  const EpdFontData* fontData = font.getData(style);
 
-  int xPos = x;
-  int yPos = y;
-  int lastBaseX = x;
-  int lastBaseY = y;
-  int lastBaseAdvance = 0;
-  int lastBaseTop = 0;
-  constexpr int MIN_COMBINING_GAP_PX = 1;
+  // Text runs bottom-to-top: the pen advances towards -y and combining marks are raised towards -x
+  forEachTextGlyph(font, text, style, [&](const EpdGlyph* glyph, const int penX, const int raiseBy) {
+    renderGlyphImpl<TextRotation::Rotated90CW>(*this, renderMode, fontData, glyph, x - raiseBy, y - penX, black);
+  });
+}
 
-  uint32_t cp;
-  uint32_t prevCp = 0;
-  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    if (utf8IsCombiningMark(cp)) {
-      const EpdGlyph* combiningGlyph = font.getGlyph(cp, style);
-      int raiseBy = 0;
-      if (combiningGlyph) {
-        const int currentGap = combiningGlyph->top - combiningGlyph->height - lastBaseTop;
-        if (currentGap < MIN_COMBINING_GAP_PX) {
-          raiseBy = MIN_COMBINING_GAP_PX - currentGap;
-        }
-      }
+uint8_t* GfxRenderer::getFrameBuffer() const { return frameBuffer; }
 
-      int combiningX = lastBaseX - raiseBy;
-      int combiningY = lastBaseY - lastBaseAdvance / 2;
-      renderCharImpl<TextRotation::Rotated90CW>(*this, renderMode, font, cp, &combiningX, &combiningY, black, style);
-      continue;
-    }
+size_t GfxRenderer::getBufferSize() { return HalDisplay::BUFFER_SIZE; }
 
-    cp = font.applyLigatures(cp, text, style);
-    if (prevCp != 0) {
-      yPos -= font.getKerning(prevCp, cp, style);
-    }
+void GfxRenderer::toPanelCoordinates(const int x, const int y, int* phyX, int* phyY) const {
+  rotateCoordinates(orientation, x, y, phyX, phyY);
+}
 
-    const EpdGlyph* glyph = font.getGlyph(cp, style);
+void GfxRenderer::blitPanelRow(const int phyX, const int phyY, const uint8_t* bits, const int count,
+                               const bool clear) const {
+  if (count <= 0 || phyX < 0 || phyX + count > HalDisplay::DISPLAY_WIDTH || phyY < 0 ||
+      phyY >= HalDisplay::DISPLAY_HEIGHT) {
+    LOG_ERR("GFX", "!! Panel row outside range (%d, %d) x %d", phyX, phyY, count);
+    return;
+  }
 
-    lastBaseX = xPos;
-    lastBaseY = yPos;
-    lastBaseAdvance = glyph ? glyph->advanceX : 0;
-    lastBaseTop = glyph ? glyph->top : 0;
+  uint8_t* dst = frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES + phyX / 8;
+  const int byteCount = (count + 7) / 8;
+  const int shift = phyX % 8;
+  if (shift == 0) {
+    if (clear) {
+      for (int i = 0; i < byteCount; i++) dst[i] &= ~bits[i];
+    } else {
+      for (int i = 0; i < byteCount; i++) dst[i] |= bits[i];
+    }
+    return;
+  }
 
-    renderCharImpl<TextRotation::Rotated90CW>(*this, renderMode, font, cp, &xPos, &yPos, black, style);
-    prevCp = cp;
+  // Each source byte straddles two framebuffer bytes. Bits past `count` are zero, so the spill into the next byte
+  // only happens when it holds pixels of the run, which the bounds check above keeps on the panel.
+  for (int i = 0; i < byteCount; i++) {
+    const uint8_t high = bits[i] >> shift;
+    const auto low = static_cast<uint8_t>(bits[i] << (8 - shift));
+    if (clear) {
+      dst[i] &= ~high;
+      if (low) dst[i + 1] &= ~low;
+    } else {
+      dst[i] |= high;
+      if (low) dst[i + 1] |= low;
+    }
   }
 }
 
-uint8_t* GfxRenderer::getFrameBuffer() const { return frameBuffer; }
-
-size_t GfxRenderer::getBufferSize() { return HalDisplay::BUFFER_SIZE; }
-
 // unused
 // void GfxRenderer::grayscaleRevert() const { display.grayscaleRevert(); }
 
@@ -1174,9 +1287,9 @@ void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
   }
 }
 
-void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, int* y, bool pixelState,
-                             EpdFontFamily::Style style) const {
-  renderCharImpl<TextRotation::None>(*this, renderMode, fontFamily, cp, x, y, pixelState, style);
+void GfxRenderer::renderGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, const int x, const int y,
+                              const bool pixelState) const {
+  renderGlyphImpl<TextRotation::None>(*this, renderMode, fontData, glyph, x, y, pixelState);
 }
 
 void GfxRenderer::getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const {
@@ -14,6 +14,14 @@
 // 0 = transparent, 1-16 = gray levels (white to black)
 enum Color : uint8_t { Clear = 0x00, White = 0x01, LightGray = 0x05, DarkGray = 0x0A, Black = 0x10 };
 
+// A glyph resolved by GfxRenderer::shapeText. glyphIndex indexes the glyph array of the style's EpdFontData, x is the
+// pen offset from the start of the text and raise lifts combining marks above the baseline.
+struct ShapedGlyph {
+  uint16_t glyphIndex;
+  int16_t x;
+  int16_t raise;
+};
+
 class GfxRenderer {
  public:
   enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
@@ -40,8 +48,7 @@ class GfxRenderer {
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
   std::map<int, EpdFontFamily> fontMap;
   FontDecompressor* fontDecompressor = nullptr;
-  void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, int* y, bool pixelState,
-                  EpdFontFamily::Style style) const;
+  void renderGlyph(const EpdFontData* fontData, const EpdGlyph* glyph, int x, int y, bool pixelState) const;
   void freeBwBufferChunks();
   template <Color color>
   void drawPixelDither(int x, int y) const;
@@ -65,6 +72,9 @@ class GfxRenderer {
   void clearFontCache() {
     if (fontDecompressor) fontDecompressor->clearCache();
   }
+  void logFontCacheStats() {
+    if (fontDecompressor) fontDecompressor->logStats();
+  }
 
   // Orientation control (affects logical width/height and coordinate transforms)
   void setOrientation(const Orientation o) { orientation = o; }
@@ -111,6 +121,12 @@ class GfxRenderer {
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
                 EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  /// Resolve \p text into positioned glyphs (UTF-8 decoding, ligatures, kerning, combining marks) and append them
+  /// to \p out. Drawing the result with drawShapedText matches drawText, so text rendered in several passes (BW and
+  /// the grayscale planes) only needs to be shaped once.
+  void shapeText(int fontId, const char* text, EpdFontFamily::Style style, std::vector<ShapedGlyph>& out) const;
+  void drawShapedText(int fontId, int x, int y, const ShapedGlyph* glyphs, size_t count, bool black = true,
+                      EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getSpaceWidth(int fontId, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   /// Returns the kerning adjustment for a space between two codepoints:
   /// kern(leftCp, ' ') + kern(' ', rightCp). Returns 0 if kerning is unavailable.
@@ -149,4 +165,10 @@ class GfxRenderer {
   // Low level functions
   uint8_t* getFrameBuffer() const;
   static size_t getBufferSize();
+  // Maps logical screen coordinates to panel coordinates for the current orientation
+  void toPanelCoordinates(int x, int y, int* phyX, int* phyY) const;
+  // Merges `count` bits (MSB first) into panel row `phyY` starting at panel x `phyX`. Set bits clear the framebuffer
+  // bit when `clear` (ink in BW mode), otherwise they set it (gray planes); zero bits leave it alone. The run must lie
+  // within the panel.
+  void blitPanelRow(int phyX, int phyY, const uint8_t* bits, int count, bool clear) const;
 };
@@ -0,0 +1,149 @@
+/**
+ * XtcPanelWriter.cpp
+ *
+ * Streams XTG/XTH page data straight into a panel framebuffer
+ * XTC ebook support for CrossPoint Reader
+ */
+
+#include "XtcPanelWriter.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace xtc {
+
+namespace {
+
+constexpr size_t XTH_PLANE_SIZE = XtcPanelWriter::PANEL_BUFFER_SIZE;
+
+// dst = op(dst, src) over `size` bytes, a 32-bit word at a time where the length allows
+template <typename Op>
+void combine(uint8_t* dst, const uint8_t* src, size_t size, Op op) {
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    uint32_t a, b;
+    memcpy(&a, dst + i, 4);
+    memcpy(&b, src + i, 4);
+    a = op(a, b);
+    memcpy(dst + i, &a, 4);
+  }
+  for (; i < size; i++) {
+    dst[i] = static_cast<uint8_t>(op(dst[i], src[i]));
+  }
+}
+
+// Transposes an 8x8 bit block (Hacker's Delight 7-3): bit (7 - i) of out[j] is bit (7 - j) of in[i * stride]
+void transpose8(const uint8_t* in, const size_t stride, uint8_t out[8]) {
+  uint32_t x = (in[0] << 24) | (in[stride] << 16) | (in[2 * stride] << 8) | in[3 * stride];
+  uint32_t y = (in[4 * stride] << 24) | (in[5 * stride] << 16) | (in[6 * stride] << 8) | in[7 * stride];
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  out[0] = x >> 24;
+  out[1] = x >> 16;
+  out[2] = x >> 8;
+  out[3] = x;
+  out[4] = y >> 24;
+  out[5] = y >> 16;
+  out[6] = y >> 8;
+  out[7] = y;
+}
+
+}  // namespace
+
+XtcPanelWriter::XtcPanelWriter(uint8_t* panelBuffer, const uint8_t bitDepth, const Pass pass)
+    : panelBuffer(panelBuffer),
+      bitDepth(bitDepth),
+      pass(pass),
+      pageDataSize(bitDepth == 2 ? 2 * XTH_PLANE_SIZE : XTG_ROW_BYTES * DISPLAY_HEIGHT) {}
+
+void XtcPanelWriter::write(const uint8_t* data, const size_t size, const size_t offset) {
+  // Ignore anything that does not continue the page in order, which leaves complete() false
+  if (offset != written || size > pageDataSize - written) {
+    return;
+  }
+
+  if (bitDepth == 2) {
+    writeXth(data, size, offset);
+  } else {
+    writeXtg(data, size);
+  }
+  written += size;
+}
+
+void XtcPanelWriter::writeXth(const uint8_t* data, size_t size, size_t offset) {
+  // First plane (bit1) is stored as the starting value of the pass, in the polarity the second plane combines with:
+  // BW = ~bit1 & ~bit2, LSB = ~bit1 & bit2, MSB = bit1 ^ bit2
+  if (offset < XTH_PLANE_SIZE) {
+    const size_t n = std::min(size, XTH_PLANE_SIZE - offset);
+    uint8_t* dst = panelBuffer + offset;
+    if (pass == Pass::GRAY_MSB) {
+      memcpy(dst, data, n);
+    } else {
+      for (size_t i = 0; i < n; i++) dst[i] = ~data[i];
+    }
+    data += n;
+    size -= n;
+    offset += n;
+  }
+  if (size == 0) {
+    return;
+  }
+
+  uint8_t* dst = panelBuffer + (offset - XTH_PLANE_SIZE);
+  switch (pass) {
+    case Pass::BW:
+      combine(dst, data, size, [](uint32_t a, uint32_t b) { return a & ~b; });
+      break;
+    case Pass::GRAY_LSB:
+      combine(dst, data, size, [](uint32_t a, uint32_t b) { return a & b; });
+      break;
+    case Pass::GRAY_MSB:
+      combine(dst, data, size, [](uint32_t a, uint32_t b) { return a ^ b; });
+      break;
+  }
+}
+
+void XtcPanelWriter::writeXtg(const uint8_t* data, size_t size) {
+  // XTG pages are black and white only, so every pass draws the BW image
+  while (size > 0) {
+    const size_t n = std::min(size, sizeof(xtgBand) - xtgBandUsed);
+    memcpy(xtgBand + xtgBandUsed, data, n);
+    xtgBandUsed += n;
+    data += n;
+    size -= n;
+    if (xtgBandUsed == sizeof(xtgBand)) {
+      flushXtgRows();
+    }
+  }
+}
+
+void XtcPanelWriter::flushXtgRows() {
+  // Page row y is panel column y, page column x is panel row (DISPLAY_WIDTH - 1 - x). An 8x8 block of the band thus
+  // becomes one byte in each of 8 panel rows.
+  uint8_t column[8];
+  for (size_t srcByte = 0; srcByte < XTG_ROW_BYTES; srcByte++) {
+    transpose8(xtgBand + srcByte, XTG_ROW_BYTES, column);
+    const size_t firstX = srcByte * 8;
+    for (size_t i = 0; i < 8; i++) {
+      panelBuffer[(DISPLAY_WIDTH - 1 - firstX - i) * PANEL_ROW_BYTES + xtgBandIndex] = column[i];
+    }
+  }
+  xtgBandIndex++;
+  xtgBandUsed = 0;
+}
+
+}  // namespace xtc
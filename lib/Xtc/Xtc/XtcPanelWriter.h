@@ -0,0 +1,71 @@
+/**
+ * XtcPanelWriter.h
+ *
+ * Streams XTG/XTH page data straight into a panel framebuffer
+ * XTC ebook support for CrossPoint Reader
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "XtcTypes.h"
+
+namespace xtc {
+
+/**
+ * XTC Panel Writer
+ *
+ * Converts page data, as delivered in chunks by XtcParser::loadPageStreaming, into one of the 1-bit buffers the
+ * display draws for a page: the BW image, or the LSB/MSB plane of a grayscale overlay. The output is in native panel
+ * layout (800x480 landscape, rows of DISPLAY_HEIGHT / 8 bytes, MSB first, 0 = black) as seen by a portrait page, so
+ * the caller passes the renderer's framebuffer while it is in portrait orientation.
+ *
+ * An XTH plane is column-major from the right with 8 vertical pixels per byte, which is exactly the panel layout, so
+ * its passes are word-wise bit operations between the two planes. XTG rows are transposed 8x8 pixels at a time.
+ * Only full-size pages (DISPLAY_WIDTH x DISPLAY_HEIGHT) can be written; check supports() first.
+ */
+class XtcPanelWriter {
+ public:
+  enum class Pass : uint8_t {
+    BW,        // Black wherever the page is not white
+    GRAY_LSB,  // Set for dark gray (XTH value 1)
+    GRAY_MSB,  // Set for dark and light gray (XTH values 1 and 2)
+  };
+
+  static constexpr size_t PANEL_ROW_BYTES = DISPLAY_HEIGHT / 8;
+  static constexpr size_t PANEL_BUFFER_SIZE = PANEL_ROW_BYTES * DISPLAY_WIDTH;
+
+  static bool supports(uint16_t pageWidth, uint16_t pageHeight) {
+    return pageWidth == DISPLAY_WIDTH && pageHeight == DISPLAY_HEIGHT;
+  }
+
+  XtcPanelWriter(uint8_t* panelBuffer, uint8_t bitDepth, Pass pass);
+
+  // Streaming callback: consumes `size` bytes of page data starting at `offset`. Chunks must arrive in order.
+  void write(const uint8_t* data, size_t size, size_t offset);
+
+  // True once every byte of the page has been written
+  bool complete() const { return written == pageDataSize; }
+
+ private:
+  static constexpr size_t XTG_ROW_BYTES = DISPLAY_WIDTH / 8;
+
+  void writeXth(const uint8_t* data, size_t size, size_t offset);
+  void writeXtg(const uint8_t* data, size_t size);
+  void flushXtgRows();
+
+  uint8_t* panelBuffer;
+  uint8_t bitDepth;
+  Pass pass;
+  size_t pageDataSize;
+  size_t written = 0;
+
+  // XTG rows are transposed in bands of 8, which chunk boundaries may split
+  uint8_t xtgBand[8 * XTG_ROW_BYTES];
+  size_t xtgBandUsed = 0;
+  size_t xtgBandIndex = 0;
+};
+
+}  // namespace xtc
@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <strings.h>
+
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 namespace xtc {
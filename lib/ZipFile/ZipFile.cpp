@@ -3,6 +3,7 @@
 #include <HalStorage.h>
 #include <InflateReader.h>
 #include <Logging.h>
+#include <Serialization.h>
 
 #include <algorithm>
 
@@ -18,6 +19,25 @@ namespace {
 constexpr uint16_t ZIP_METHOD_STORED = 0;
 constexpr uint16_t ZIP_METHOD_DEFLATED = 8;
 
+// Central directory index file:
+//   uint8_t version, uint32_t zip file size, uint16_t entry count, then ZipIndexEntry[count] sorted by (hash, nameLen)
+constexpr uint8_t ZIP_INDEX_VERSION = 1;
+constexpr size_t ZIP_INDEX_HEADER_SIZE = sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint16_t);
+
+struct ZipIndexEntry {
+  uint64_t hash;  // FNV-1a 64-bit hash of the entry name
+  uint16_t nameLen;
+  uint16_t method;
+  uint32_t compressedSize;
+  uint32_t uncompressedSize;
+  uint32_t localHeaderOffset;
+};
+static_assert(sizeof(ZipIndexEntry) == 24, "ZipIndexEntry is written to disk as-is");
+
+bool indexEntryLess(const ZipIndexEntry& a, const ZipIndexEntry& b) {
+  return a.hash < b.hash || (a.hash == b.hash && a.nameLen < b.nameLen);
+}
+
 int zipReadCallback(uzlib_uncomp* uncomp) {
   auto* ctx = reinterpret_cast<ZipInflateCtx*>(uncomp);
   if (ctx->fileRemaining == 0) return -1;
@@ -34,6 +54,11 @@ int zipReadCallback(uzlib_uncomp* uncomp) {
 }
 }  // namespace
 
+ZipFile::ZipFile(const std::string& filePath, std::string indexPath)
+    : filePath(filePath), indexPath(std::move(indexPath)) {}
+
+ZipFile::~ZipFile() { endEntryStream(); }
+
 bool ZipFile::loadAllFileStatSlims() {
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
@@ -90,6 +115,160 @@ bool ZipFile::loadAllFileStatSlims() {
   return true;
 }
 
+bool ZipFile::buildIndex() {
+  if (indexPath.empty()) {
+    return false;
+  }
+
+  const bool wasOpen = isOpen();
+  if (!wasOpen && !open()) {
+    return false;
+  }
+
+  if (!loadZipDetails()) {
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
+
+  // One allocation for the whole table; it only lives until the sorted copy is on disk
+  auto* entries = static_cast<ZipIndexEntry*>(malloc(zipDetails.totalEntries * sizeof(ZipIndexEntry)));
+  if (!entries && zipDetails.totalEntries > 0) {
+    LOG_ERR("ZIP", "Failed to allocate index for %u entries", zipDetails.totalEntries);
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
+
+  file.seek(zipDetails.centralDirOffset);
+
+  uint16_t count = 0;
+  uint32_t sig;
+  char itemName[256];
+
+  while (count < zipDetails.totalEntries && file.available()) {
+    file.read(&sig, 4);
+    if (sig != 0x02014b50) break;  // End of list
+
+    ZipIndexEntry& entry = entries[count];
+    file.seekCur(6);
+    file.read(&entry.method, 2);
+    file.seekCur(8);
+    file.read(&entry.compressedSize, 4);
+    file.read(&entry.uncompressedSize, 4);
+    uint16_t m, k;
+    file.read(&entry.nameLen, 2);
+    file.read(&m, 2);
+    file.read(&k, 2);
+    file.seekCur(8);
+    file.read(&entry.localHeaderOffset, 4);
+
+    if (entry.nameLen < 256) {
+      file.read(itemName, entry.nameLen);
+      entry.hash = fnvHash64(itemName, entry.nameLen);
+      count++;
+    } else {
+      // Name too long to be looked up anyway, skip it
+      file.seekCur(entry.nameLen);
+    }
+
+    // Skip the rest of this entry (extra field + comment)
+    file.seekCur(m + k);
+  }
+
+  const uint32_t zipSize = file.size();
+  if (!wasOpen) {
+    close();
+  }
+
+  std::sort(entries, entries + count, indexEntryLess);
+
+  FsFile indexFile;
+  if (!Storage.openFileForWrite("ZIP", indexPath, indexFile)) {
+    free(entries);
+    return false;
+  }
+  serialization::writePod(indexFile, ZIP_INDEX_VERSION);
+  serialization::writePod(indexFile, zipSize);
+  serialization::writePod(indexFile, count);
+  const size_t tableSize = count * sizeof(ZipIndexEntry);
+  const bool written = indexFile.write(entries, tableSize) == tableSize;
+  indexFile.close();
+  free(entries);
+
+  if (!written) {
+    LOG_ERR("ZIP", "Failed to write zip index");
+    Storage.remove(indexPath.c_str());
+    return false;
+  }
+
+  LOG_DBG("ZIP", "Wrote index of %u entries", count);
+  return true;
+}
+
+// Binary search of the on-disk index. Requires the zip file to be open (its size identifies the index as current).
+ZipFile::IndexLookup ZipFile::lookupIndex(const char* filename, FileStatSlim* fileStat) {
+  if (!Storage.exists(indexPath.c_str())) {
+    return IndexLookup::Unavailable;
+  }
+
+  FsFile indexFile;
+  if (!Storage.openFileForRead("ZIP", indexPath, indexFile)) {
+    return IndexLookup::Unavailable;
+  }
+
+  uint8_t version;
+  uint32_t zipSize;
+  uint16_t count;
+  serialization::readPod(indexFile, version);
+  serialization::readPod(indexFile, zipSize);
+  serialization::readPod(indexFile, count);
+  if (version != ZIP_INDEX_VERSION || zipSize != file.size() ||
+      indexFile.size() != ZIP_INDEX_HEADER_SIZE + count * sizeof(ZipIndexEntry)) {
+    LOG_DBG("ZIP", "Zip index is stale, scanning central directory");
+    indexFile.close();
+    return IndexLookup::Unavailable;
+  }
+
+  const size_t nameLen = strlen(filename);
+  ZipIndexEntry key = {};
+  key.hash = fnvHash64(filename, nameLen);
+  key.nameLen = static_cast<uint16_t>(nameLen);
+
+  // Lower bound on (hash, nameLen)
+  uint16_t lo = 0;
+  uint16_t hi = count;
+  ZipIndexEntry entry;
+  while (lo < hi) {
+    const uint16_t mid = lo + (hi - lo) / 2;
+    indexFile.seek(ZIP_INDEX_HEADER_SIZE + mid * sizeof(ZipIndexEntry));
+    indexFile.read(&entry, sizeof(entry));
+    if (indexEntryLess(entry, key)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  IndexLookup result = IndexLookup::NotFound;
+  if (lo < count) {
+    indexFile.seek(ZIP_INDEX_HEADER_SIZE + lo * sizeof(ZipIndexEntry));
+    if (indexFile.read(&entry, sizeof(entry)) == sizeof(entry) && entry.hash == key.hash &&
+        entry.nameLen == key.nameLen) {
+      fileStat->method = entry.method;
+      fileStat->compressedSize = entry.compressedSize;
+      fileStat->uncompressedSize = entry.uncompressedSize;
+      fileStat->localHeaderOffset = entry.localHeaderOffset;
+      result = IndexLookup::Found;
+    }
+  }
+
+  indexFile.close();
+  return result;
+}
+
 bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
   if (!fileStatSlimCache.empty()) {
     const auto it = fileStatSlimCache.find(filename);
@@ -105,6 +284,16 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
     return false;
   }
 
+  if (!indexPath.empty()) {
+    const IndexLookup lookup = lookupIndex(filename, fileStat);
+    if (lookup != IndexLookup::Unavailable) {
+      if (!wasOpen) {
+        close();
+      }
+      return lookup == IndexLookup::Found;
+    }
+  }
+
   if (!loadZipDetails()) {
     if (!wasOpen) {
       close();
@@ -628,3 +817,114 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
   LOG_ERR("ZIP", "Unsupported compression method");
   return false;
 }
+
+bool ZipFile::beginEntryStream(const char* filename, const size_t chunkSize, size_t* inflatedSize) {
+  endEntryStream();
+
+  if (!isOpen() && !open()) {
+    return false;
+  }
+
+  FileStatSlim fileStat = {};
+  if (!loadFileStatSlim(filename, &fileStat)) {
+    close();
+    return false;
+  }
+
+  const long fileOffset = getDataOffset(fileStat);
+  if (fileOffset < 0) {
+    close();
+    return false;
+  }
+
+  if (fileStat.method != ZIP_METHOD_STORED && fileStat.method != ZIP_METHOD_DEFLATED) {
+    LOG_ERR("ZIP", "Unsupported compression method");
+    close();
+    return false;
+  }
+
+  streamCtx.reset(new ZipInflateCtx());
+  if (fileStat.method == ZIP_METHOD_DEFLATED) {
+    streamCtx->readBuf = static_cast<uint8_t*>(malloc(chunkSize));
+    if (!streamCtx->readBuf) {
+      LOG_ERR("ZIP", "Failed to allocate memory for zip file read buffer");
+      endEntryStream();
+      return false;
+    }
+    streamCtx->readBufSize = chunkSize;
+    streamCtx->file = &file;
+    streamCtx->fileRemaining = fileStat.compressedSize;
+
+    if (!streamCtx->reader.init(true)) {
+      LOG_ERR("ZIP", "Failed to init inflate reader");
+      endEntryStream();
+      return false;
+    }
+    streamCtx->reader.setReadCallback(zipReadCallback);
+  }
+
+  file.seek(fileOffset);
+  streamMethod = fileStat.method;
+  streamRemaining = fileStat.uncompressedSize;
+  streamDone = false;
+  if (inflatedSize) *inflatedSize = fileStat.uncompressedSize;
+  return true;
+}
+
+int ZipFile::readEntryStream(uint8_t* dest, const size_t maxLen) {
+  if (!streamCtx) {
+    LOG_ERR("ZIP", "No entry stream open");
+    return -1;
+  }
+  if (streamDone || maxLen == 0) {
+    return 0;
+  }
+
+  if (streamMethod == ZIP_METHOD_STORED) {
+    if (streamRemaining == 0) {
+      streamDone = true;
+      return 0;
+    }
+    const size_t toRead = streamRemaining < maxLen ? streamRemaining : maxLen;
+    const size_t dataRead = file.read(dest, toRead);
+    if (dataRead == 0) {
+      LOG_ERR("ZIP", "Could not read more bytes");
+      return -1;
+    }
+    streamRemaining -= dataRead;
+    return static_cast<int>(dataRead);
+  }
+
+  size_t produced = 0;
+  const InflateStatus status = streamCtx->reader.readAtMost(dest, maxLen, &produced);
+  if (status == InflateStatus::Error) {
+    LOG_ERR("ZIP", "Decompression failed");
+    return -1;
+  }
+  if (produced > streamRemaining) {
+    LOG_ERR("ZIP", "Decompressed size exceeds expected (%zu bytes over)", produced - streamRemaining);
+    return -1;
+  }
+  streamRemaining -= produced;
+
+  if (status == InflateStatus::Done) {
+    if (streamRemaining != 0) {
+      LOG_ERR("ZIP", "Decompressed size mismatch (%zu bytes missing)", streamRemaining);
+      return -1;
+    }
+    streamDone = true;
+  }
+  return static_cast<int>(produced);
+}
+
+void ZipFile::endEntryStream() {
+  if (!streamCtx) {
+    return;
+  }
+  free(streamCtx->readBuf);
+  streamCtx.reset();  // ctx.reader destructor frees the ring buffer
+  streamMethod = 0;
+  streamRemaining = 0;
+  streamDone = false;
+  close();
+}
@@ -1,10 +1,13 @@
 #pragma once
 #include <HalStorage.h>
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+struct ZipInflateCtx;
+
 class ZipFile {
  public:
   struct FileStatSlim {
@@ -39,6 +42,8 @@ class ZipFile {
 
  private:
   const std::string& filePath;
+  // Optional on-disk central directory index (see buildIndex), empty if not used
+  std::string indexPath;
   FsFile file;
   ZipDetails zipDetails = {0, 0, false};
   std::unordered_map<std::string, FileStatSlim> fileStatSlimCache;
@@ -47,19 +52,33 @@ class ZipFile {
   uint32_t lastCentralDirPos = 0;
   bool lastCentralDirPosValid = false;
 
+  // State of the entry currently open via beginEntryStream()
+  std::unique_ptr<ZipInflateCtx> streamCtx;
+  uint16_t streamMethod = 0;
+  size_t streamRemaining = 0;  // Inflated bytes still expected from the entry
+  bool streamDone = false;
+
+  enum class IndexLookup { Found, NotFound, Unavailable };
+
   bool loadFileStatSlim(const char* filename, FileStatSlim* fileStat);
+  IndexLookup lookupIndex(const char* filename, FileStatSlim* fileStat);
   long getDataOffset(const FileStatSlim& fileStat);
   bool loadZipDetails();
 
  public:
-  explicit ZipFile(const std::string& filePath) : filePath(filePath) {}
-  ~ZipFile() = default;
+  // indexPath, if given, names a central directory index written by buildIndex(). Entry lookups binary-search it on
+  // the SD card instead of scanning the central directory, falling back to the scan if it is missing or stale.
+  explicit ZipFile(const std::string& filePath, std::string indexPath = "");
+  ~ZipFile();
   // Zip file can be opened and closed by hand in order to allow for quick calculation of inflated file size
   // It is NOT recommended to pre-open it for any kind of inflation due to memory constraints
   bool isOpen() const { return !!file; }
   bool open();
   bool close();
   bool loadAllFileStatSlims();
+  // Scan the central directory once and write it to indexPath as entries sorted by (name hash, name length), each
+  // holding the entry's compression method, sizes and local header offset.
+  bool buildIndex();
   bool getInflatedFileSize(const char* filename, size_t* size);
   // Batch lookup: scan ZIP central dir once and fill sizes for matching targets.
   // targets must be sorted by (hash, len). sizes[target.index] receives uncompressedSize.
@@ -69,4 +88,14 @@ class ZipFile {
   // These functions will open and close the zip as needed
   uint8_t* readFileToMemory(const char* filename, size_t* size = nullptr, bool trailingNullByte = false);
   bool readFileToStream(const char* filename, Print& out, size_t chunkSize);
+
+  // Pull-based streaming of a single entry. Unlike readFileToStream, the caller asks for bytes when it wants them, so a
+  // consumer such as an XML parser can be fed straight from the inflater without staging the entry on the SD card.
+  // The zip file stays open (plus a 32KB inflate window for deflated entries) until endEntryStream() or destruction.
+  // chunkSize is the size of the compressed read buffer. inflatedSize, if given, receives the entry's inflated size.
+  bool beginEntryStream(const char* filename, size_t chunkSize, size_t* inflatedSize = nullptr);
+  // Reads up to maxLen inflated bytes into dest.
+  // Returns the number of bytes produced, 0 once the entry is exhausted, or -1 on error.
+  int readEntryStream(uint8_t* dest, size_t maxLen);
+  void endEntryStream();
 };
@@ -18,6 +18,9 @@
 
 #define UART0_RXD 20  // Used for USB connection detection
 
+class HalGPIO;
+extern HalGPIO gpio;  // Singleton
+
 class HalGPIO {
 #if CROSSPOINT_EMULATED == 0
   InputManager inputMgr;
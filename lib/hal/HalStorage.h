@@ -86,6 +86,9 @@ class HalFile : public Print {
   size_t write(const void* buf, size_t count);
   size_t write(uint8_t b) override;
   bool rename(const char* newPath);
+  // FAT modification date and time, both 0 if the file has none
+  bool getModifyDateTime(uint16_t* pdate, uint16_t* ptime);
+  uint32_t firstSector() const;
   bool isDirectory() const;
   void rewindDirectory();
   bool close();
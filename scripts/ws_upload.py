@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+"""
+Resumable WebSocket upload client
+
+Uploads a file to a CrossPoint reader over the resumable protocol of the WebSocket port (see
+CrossPointWebServer::onWebSocketEvent), the same way the web page's uploader does: a session per file, chunks with
+their offset and CRC32, several chunks in flight, and reconnecting to resume after a dropped connection.
+
+Faults can be injected to exercise the server's recovery:
+- --drop-after N closes the connection after N bytes were sent on it (--drops times), then resumes
+- --corrupt-every K flips a byte in every Kth chunk after its CRC was computed, which the server must NAK
+- --lose-every K skips every Kth chunk, which leaves a gap the server must NAK
+
+Afterwards the size of the uploaded file is checked against /api/files.
+
+Usage:
+    python ws_upload.py <host> <file> [--path /Books] [--drop-after 200000 --drops 3] [--corrupt-every 50]
+
+Only the standard library is used.
+"""
+
+from __future__ import annotations
+
+import argparse
+import base64
+import json
+import os
+import select
+import socket
+import struct
+import sys
+import time
+import urllib.parse
+import urllib.request
+import zlib
+
+WS_PORT = 81
+CHUNK_SIZE = 8192
+WINDOW_CHUNKS = 4
+MAX_RETRIES = 5
+
+
+class WebSocket:
+    """Minimal client side of RFC 6455: masked frames out, text and binary frames in, no extensions."""
+
+    def __init__(self, host: str, port: int, timeout: float = 10.0):
+        self.sock = socket.create_connection((host, port), timeout=timeout)
+        key = base64.b64encode(os.urandom(16)).decode()
+        request = (
+            f"GET / HTTP/1.1\r\nHost: {host}:{port}\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+            f"Sec-WebSocket-Key: {key}\r\nSec-WebSocket-Version: 13\r\n\r\n"
+        )
+        self.sock.sendall(request.encode())
+        response = b""
+        while b"\r\n\r\n" not in response:
+            data = self.sock.recv(1024)
+            if not data:
+                raise ConnectionError("Connection closed during handshake")
+            response += data
+        head, self.pending = response.split(b"\r\n\r\n", 1)
+        if b" 101 " not in head.split(b"\r\n", 1)[0]:
+            raise ConnectionError(f"Handshake failed: {head.decode(errors='replace')}")
+
+    def send(self, payload: bytes | str) -> None:
+        opcode = 0x1 if isinstance(payload, str) else 0x2
+        data = payload.encode() if isinstance(payload, str) else payload
+        header = bytes([0x80 | opcode])
+        if len(data) < 126:
+            header += bytes([0x80 | len(data)])
+        elif len(data) < 65536:
+            header += bytes([0x80 | 126]) + struct.pack(">H", len(data))
+        else:
+            header += bytes([0x80 | 127]) + struct.pack(">Q", len(data))
+        mask = os.urandom(4)
+        masked = bytes(b ^ mask[i % 4] for i, b in enumerate(data))
+        self.sock.sendall(header + mask + masked)
+
+    def _read(self, count: int) -> bytes:
+        while len(self.pending) < count:
+            data = self.sock.recv(4096)
+            if not data:
+                raise ConnectionError("Connection closed")
+            self.pending += data
+        result, self.pending = self.pending[:count], self.pending[count:]
+        return result
+
+    def readable(self, timeout: float) -> bool:
+        return bool(self.pending) or bool(select.select([self.sock], [], [], timeout)[0])
+
+    def receive(self) -> str | None:
+        """Returns the next text message, None for a binary one. Raises ConnectionError once the server closes."""
+        while True:
+            first, second = self._read(2)
+            opcode = first & 0x0F
+            length = second & 0x7F
+            if length == 126:
+                (length,) = struct.unpack(">H", self._read(2))
+            elif length == 127:
+                (length,) = struct.unpack(">Q", self._read(8))
+            mask = self._read(4) if second & 0x80 else None
+            data = self._read(length)
+            if mask:
+                data = bytes(b ^ mask[i % 4] for i, b in enumerate(data))
+            if opcode == 0x8:
+                raise ConnectionError("Closed by server")
+            if opcode == 0x9:
+                self.sock.sendall(bytes([0x8A, 0x80 | len(data)]) + b"\0\0\0\0" + data)
+                continue
+            return data.decode() if opcode == 0x1 else None
+
+    def close(self) -> None:
+        self.sock.close()
+
+
+def session_id(path: str, name: str, size: int, mtime_ms: int) -> str:
+    # Same key as uploadSessionId() in FilesPage.html
+    return f"{zlib.crc32(f'{path}/{name}:{size}:{mtime_ms}'.encode()):08x}"
+
+
+class Uploader:
+    def __init__(self, args: argparse.Namespace):
+        self.args = args
+        with open(args.file, "rb") as f:
+            self.data = f.read()
+        self.name = os.path.basename(args.file)
+        mtime_ms = int(os.path.getmtime(args.file) * 1000)
+        self.session = session_id(args.path, self.name, len(self.data), mtime_ms)
+        self.drops_left = args.drops
+        self.chunks_sent = 0
+        self.naks = 0
+
+    def attempt(self) -> bool:
+        """One connection. Returns True once the server reported DONE, raises ConnectionError if it dropped."""
+        args = self.args
+        size = len(self.data)
+        ws = WebSocket(args.host, args.port)
+        try:
+            ws.send(f"BEGIN:{self.session}:{self.name}:{size}:{args.path}")
+            acked = next_offset = None
+            sent_here = 0
+            while True:
+                if acked is not None:
+                    while next_offset < size and next_offset - acked < args.window * args.chunk:
+                        if self.drops_left > 0 and args.drop_after and sent_here >= args.drop_after:
+                            self.drops_left -= 1
+                            print(f"  injecting disconnect at offset {next_offset}")
+                            raise ConnectionError("Injected disconnect")
+                        self.send_chunk(ws, next_offset)
+                        sent_here += min(args.chunk, size - next_offset)
+                        next_offset = min(next_offset + args.chunk, size)
+                if not ws.readable(args.timeout):
+                    raise ConnectionError("Timed out waiting for the server")
+                msg = ws.receive()
+                if msg is None:
+                    continue
+                if msg.startswith("OFFSET:"):
+                    acked = next_offset = int(msg[7:])
+                    print(f"  session {self.session} resumes at {acked} of {size}")
+                elif msg.startswith("ACK:"):
+                    acked = max(acked, int(msg[4:]))
+                elif msg.startswith("NAK:"):
+                    self.naks += 1
+                    next_offset = int(msg[4:])
+                    acked = max(acked, next_offset)
+                elif msg == "DONE":
+                    return True
+                elif msg.startswith("ERROR:"):
+                    raise RuntimeError(msg[6:])
+        finally:
+            ws.close()
+
+    def send_chunk(self, ws: WebSocket, offset: int) -> None:
+        args = self.args
+        payload = self.data[offset : offset + args.chunk]
+        self.chunks_sent += 1
+        if args.lose_every and self.chunks_sent % args.lose_every == 0:
+            return
+        header = struct.pack("<II", offset, zlib.crc32(payload))
+        if args.corrupt_every and self.chunks_sent % args.corrupt_every == 0 and payload:
+            payload = bytes([payload[0] ^ 0xFF]) + payload[1:]
+        ws.send(header + payload)
+
+    def run(self) -> bool:
+        retries = 0
+        start = time.monotonic()
+        while True:
+            try:
+                if self.attempt():
+                    break
+            except (ConnectionError, OSError) as e:
+                retries += 1
+                if retries > MAX_RETRIES + self.args.drops:
+                    print(f"Giving up: {e}")
+                    return False
+                print(f"  {e}, reconnecting")
+                time.sleep(self.args.retry_delay)
+        elapsed = time.monotonic() - start
+        size = len(self.data)
+        print(f"Uploaded {self.name}: {size} bytes in {elapsed:.1f} s ({size / 1024 / max(elapsed, 1e-6):.1f} KB/s), "
+              f"{self.chunks_sent} chunks, {self.naks} NAKs")
+        return True
+
+    def verify(self) -> bool:
+        query = urllib.parse.urlencode({"path": self.args.path})
+        with urllib.request.urlopen(f"http://{self.args.host}/api/files?{query}", timeout=10) as response:
+            files = json.load(response)
+        for entry in files:
+            if entry.get("name") == self.name:
+                ok = entry.get("size") == len(self.data)
+                print(f"Server size {entry.get('size')}: {'OK' if ok else 'MISMATCH'}")
+                return ok
+        print("Uploaded file not found on the server")
+        return False
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("host", help="Reader's IP address or hostname")
+    parser.add_argument("file", help="File to upload")
+    parser.add_argument("--path", default="/", help="Destination folder on the SD card")
+    parser.add_argument("--port", type=int, default=WS_PORT)
+    parser.add_argument("--chunk", type=int, default=CHUNK_SIZE, help="Payload bytes per chunk")
+    parser.add_argument("--window", type=int, default=WINDOW_CHUNKS, help="Chunks in flight")
+    parser.add_argument("--drop-after", type=int, default=0, help="Disconnect after this many bytes per connection")
+    parser.add_argument("--drops", type=int, default=0, help="Number of injected disconnects")
+    parser.add_argument("--corrupt-every", type=int, default=0, help="Corrupt every Kth chunk")
+    parser.add_argument("--lose-every", type=int, default=0, help="Skip every Kth chunk")
+    parser.add_argument("--timeout", type=float, default=10.0, help="Seconds to wait for a reply")
+    parser.add_argument("--retry-delay", type=float, default=1.0, help="Seconds between reconnects")
+    parser.add_argument("--no-verify", action="store_true", help="Skip the size check through /api/files")
+    args = parser.parse_args()
+
+    uploader = Uploader(args)
+    try:
+        if not uploader.run():
+            return 1
+    except RuntimeError as e:
+        print(f"Server error: {e}")
+        return 1
+    if not args.no_verify and not uploader.verify():
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
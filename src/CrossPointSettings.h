@@ -192,6 +192,8 @@ class CrossPointSettings {
   uint8_t fadingFix = 0;
   // Use book's embedded CSS styles for EPUB rendering (1 = enabled, 0 = disabled)
   uint8_t embeddedStyle = 1;
+  // Reader layouts (font, spacing, orientation, ...) whose chapter caches are kept per book
+  uint8_t cachedLayouts = 2;
 
   ~CrossPointSettings() = default;
 
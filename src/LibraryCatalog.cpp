@@ -0,0 +1,564 @@
+#include "LibraryCatalog.h"
+
+#include <Arduino.h>
+#include <Epub.h>
+#include <Epub/BookMetadataCache.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+#include <Xtc.h>
+#include <esp_task_wdt.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstring>
+
+#include "components/UITheme.h"
+#include "util/MutexGuard.h"
+#include "util/StringUtils.h"
+
+LibraryCatalog LibraryCatalog::instance;
+
+namespace {
+constexpr uint8_t CATALOG_VERSION = 1;
+constexpr char CATALOG_DIR[] = "/.crosspoint/library";
+constexpr char CACHE_DIR[] = "/.crosspoint";
+// Header: version, folder stamp, entry count, journal offset, journal count, folder path. The stamp and the journal
+// count are updated in place when a change is appended.
+constexpr size_t STAMP_OFFSET = sizeof(uint8_t);
+constexpr size_t JOURNAL_COUNT_OFFSET = STAMP_OFFSET + 3 * sizeof(uint32_t);
+// Changes appended before the folder is walked again and its catalog rewritten
+constexpr uint8_t MAX_JOURNAL = 32;
+constexpr size_t MAX_VERIFIED_FOLDERS = 16;
+// Longer strings mean a damaged catalog
+constexpr uint32_t MAX_STRING_LENGTH = 1024;
+
+enum class JournalOp : uint8_t { Upsert = 1, Remove = 2 };
+
+const char* const HIDDEN_NAMES[] = {"System Volume Information", "XTCache"};
+
+using Entry = LibraryCatalog::Entry;
+using Type = LibraryCatalog::Type;
+
+struct Header {
+  uint32_t stamp = 0;
+  uint32_t entryCount = 0;
+  uint32_t journalOffset = 0;  // End of the entries, where the appended changes start
+  uint8_t journalCount = 0;
+};
+
+std::string catalogPath(const std::string& folder) {
+  return std::string(CATALOG_DIR) + "/" + std::to_string(std::hash<std::string>{}(folder)) + ".bin";
+}
+
+// "/Books/" and "Books" both become "/Books", the root stays "/"
+std::string normalizePath(const std::string& path) {
+  std::string result = path.empty() || path[0] != '/' ? "/" + path : path;
+  while (result.size() > 1 && result.back() == '/') {
+    result.pop_back();
+  }
+  return result;
+}
+
+// Splits "/Books/a.epub" into "/Books" and "a.epub"
+void splitPath(const std::string& path, std::string& folder, std::string& name) {
+  const std::string normalized = normalizePath(path);
+  const size_t slash = normalized.find_last_of('/');
+  folder = slash == 0 ? "/" : normalized.substr(0, slash);
+  name = normalized.substr(slash + 1);
+}
+
+// Changes refer to folders without their trailing '/'
+std::string entryKey(const std::string& name) {
+  return !name.empty() && name.back() == '/' ? name.substr(0, name.size() - 1) : name;
+}
+
+uint32_t modifiedOf(HalFile& file) {
+  uint16_t date = 0;
+  uint16_t time = 0;
+  if (!file.getModifyDateTime(&date, &time)) {
+    return 0;
+  }
+  return static_cast<uint32_t>(date) << 16 | time;
+}
+
+uint32_t folderStamp(const std::string& folder) {
+  auto dir = Storage.open(folder.c_str());
+  if (!dir) {
+    return 0;
+  }
+  const uint32_t stamp = modifiedOf(dir);
+  dir.close();
+  return stamp;
+}
+
+template <typename T>
+bool readValue(HalFile& file, T& value) {
+  return file.read(&value, sizeof(T)) == static_cast<int>(sizeof(T));
+}
+
+bool readString(HalFile& file, std::string& s) {
+  uint32_t length = 0;
+  if (!readValue(file, length) || length > MAX_STRING_LENGTH) {
+    return false;
+  }
+  s.resize(length);
+  return length == 0 || file.read(&s[0], length) == static_cast<int>(length);
+}
+
+void writeHeader(HalFile& file, const std::string& folder, const Header& header) {
+  serialization::writePod(file, CATALOG_VERSION);
+  serialization::writePod(file, header.stamp);
+  serialization::writePod(file, header.entryCount);
+  serialization::writePod(file, header.journalOffset);
+  serialization::writePod(file, header.journalCount);
+  serialization::writeString(file, folder);
+}
+
+bool readHeader(HalFile& file, const std::string& folder, Header& header) {
+  uint8_t version = 0;
+  std::string storedFolder;
+  if (!readValue(file, version) || version != CATALOG_VERSION || !readValue(file, header.stamp) ||
+      !readValue(file, header.entryCount) || !readValue(file, header.journalOffset) ||
+      !readValue(file, header.journalCount) || !readString(file, storedFolder)) {
+    return false;
+  }
+  // Otherwise another folder whose path has the same hash
+  return storedFolder == folder;
+}
+
+void writeEntry(HalFile& file, const Entry& entry) {
+  const uint8_t flags = (entry.hasMetadata ? 1 : 0) | (entry.hasThumb ? 2 : 0);
+  serialization::writeString(file, entry.name);
+  serialization::writePod(file, entry.size);
+  serialization::writePod(file, entry.modified);
+  serialization::writePod(file, entry.type);
+  serialization::writePod(file, flags);
+  serialization::writeString(file, entry.title);
+  serialization::writeString(file, entry.author);
+}
+
+bool readEntry(HalFile& file, Entry& entry) {
+  uint8_t type = 0;
+  uint8_t flags = 0;
+  if (!readString(file, entry.name) || !readValue(file, entry.size) || !readValue(file, entry.modified) ||
+      !readValue(file, type) || !readValue(file, flags) || !readString(file, entry.title) ||
+      !readString(file, entry.author)) {
+    return false;
+  }
+  entry.type = static_cast<Type>(type);
+  entry.hasMetadata = flags & 1;
+  entry.hasThumb = flags & 2;
+  return true;
+}
+
+// The appended changes, as the names they touch and the final entry of those that still exist
+bool readJournal(HalFile& file, const Header& header, std::vector<std::string>& keys, std::vector<Entry>& upserts) {
+  if (!file.seekSet(header.journalOffset)) {
+    return false;
+  }
+  Entry entry;
+  for (uint8_t i = 0; i < header.journalCount; i++) {
+    uint8_t op = 0;
+    if (!readValue(file, op) || !readEntry(file, entry)) {
+      return false;
+    }
+    const std::string key = entryKey(entry.name);
+    upserts.erase(std::remove_if(upserts.begin(), upserts.end(),
+                                 [&key](const Entry& upsert) { return entryKey(upsert.name) == key; }),
+                  upserts.end());
+    if (std::find(keys.begin(), keys.end(), key) == keys.end()) {
+      keys.push_back(key);
+    }
+    if (static_cast<JournalOp>(op) == JournalOp::Upsert) {
+      upserts.push_back(entry);
+    }
+  }
+  return true;
+}
+
+// Fills in type, title, author and thumbnail of the entry named `entry.name` in `folder`
+void describe(const std::string& folder, Entry& entry) {
+  entry.type = LibraryCatalog::typeOf(entry.name);
+  entry.hasMetadata = true;
+  entry.hasThumb = false;
+  entry.title.clear();
+  entry.author.clear();
+
+  const std::string path = (folder == "/" ? folder : folder + "/") + entry.name;
+  const int thumbHeight = UITheme::getInstance().getMetrics().homeCoverHeight;
+  if (entry.type == Type::Epub) {
+    // Only what earlier opens left in the metadata cache, the book itself is not parsed here
+    const Epub epub(path, CACHE_DIR);
+    BookMetadataCache metadata(epub.getCachePath());
+    entry.hasMetadata = metadata.load();
+    if (entry.hasMetadata) {
+      entry.title = metadata.coreMetadata.title;
+      entry.author = metadata.coreMetadata.author;
+    }
+    entry.hasThumb = thumbHeight > 0 && Storage.exists(epub.getThumbBmpPath(thumbHeight).c_str());
+  } else if (entry.type == Type::Xtc) {
+    // The XTC header is small and read directly
+    Xtc xtc(path, CACHE_DIR);
+    entry.hasMetadata = xtc.load();
+    if (entry.hasMetadata) {
+      entry.title = xtc.getTitle();
+      entry.author = xtc.getAuthor();
+    }
+    entry.hasThumb = thumbHeight > 0 && Storage.exists(xtc.getThumbBmpPath(thumbHeight).c_str());
+  }
+}
+}  // namespace
+
+LibraryCatalog::LibraryCatalog() {
+  mutex = xSemaphoreCreateMutex();
+  assert(mutex != nullptr);
+}
+
+LibraryCatalog::~LibraryCatalog() { vSemaphoreDelete(mutex); }
+
+LibraryCatalog::Type LibraryCatalog::typeOf(const std::string& name) {
+  if (!name.empty() && name.back() == '/') {
+    return Type::Directory;
+  }
+  if (StringUtils::checkFileExtension(name, ".epub")) {
+    return Type::Epub;
+  }
+  if (StringUtils::checkFileExtension(name, ".xtch") || StringUtils::checkFileExtension(name, ".xtc")) {
+    return Type::Xtc;
+  }
+  if (StringUtils::checkFileExtension(name, ".txt") || StringUtils::checkFileExtension(name, ".md")) {
+    return Type::Txt;
+  }
+  if (StringUtils::checkFileExtension(name, ".bmp")) {
+    return Type::Image;
+  }
+  return Type::Other;
+}
+
+bool LibraryCatalog::isHidden(const char* name) {
+  if (name[0] == '.') {
+    return true;
+  }
+  for (const char* hidden : HIDDEN_NAMES) {
+    if (strcmp(name, hidden) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool LibraryCatalog::compareNames(const std::string& a, const std::string& b) {
+  // Directories first
+  const bool isDir1 = !a.empty() && a.back() == '/';
+  const bool isDir2 = !b.empty() && b.back() == '/';
+  if (isDir1 != isDir2) return isDir1;
+
+  // Start naive natural sort
+  const char* s1 = a.c_str();
+  const char* s2 = b.c_str();
+
+  // Iterate while both strings have characters
+  while (*s1 && *s2) {
+    // Check if both are at the start of a number
+    if (isdigit(*s1) && isdigit(*s2)) {
+      // Skip leading zeros
+      while (*s1 == '0') s1++;
+      while (*s2 == '0') s2++;
+
+      // Count digits to compare lengths first
+      int len1 = 0, len2 = 0;
+      while (isdigit(s1[len1])) len1++;
+      while (isdigit(s2[len2])) len2++;
+
+      // Different length so return smaller integer value
+      if (len1 != len2) return len1 < len2;
+
+      // Same length so compare digit by digit
+      for (int i = 0; i < len1; i++) {
+        if (s1[i] != s2[i]) return s1[i] < s2[i];
+      }
+
+      // Numbers equal so advance pointers
+      s1 += len1;
+      s2 += len2;
+    } else {
+      // Regular case-insensitive character comparison
+      char c1 = tolower(*s1);
+      char c2 = tolower(*s2);
+      if (c1 != c2) return c1 < c2;
+      s1++;
+      s2++;
+    }
+  }
+
+  // One string is prefix of other
+  return *s1 == '\0' && *s2 != '\0';
+}
+
+bool LibraryCatalog::forEach(const std::string& folderPath, const std::function<void(const Entry&)>& visitor) {
+  const std::string folder = normalizePath(folderPath);
+  MutexGuard guard(mutex);
+
+  const uint32_t stamp = folderStamp(folder);
+  if (isVerified(folder) && stream(folder, stamp, visitor)) {
+    return true;
+  }
+  if (!rebuild(folder, stamp)) {
+    setVerified(folder, false);
+    return false;
+  }
+  setVerified(folder, true);
+  return stream(folder, stamp, visitor);
+}
+
+void LibraryCatalog::fileChanged(const std::string& path) { appendJournal(path, true); }
+
+void LibraryCatalog::fileRemoved(const std::string& path) {
+  {
+    MutexGuard guard(mutex);
+    forgetFolder(normalizePath(path));
+  }
+  appendJournal(path, false);
+}
+
+void LibraryCatalog::fileRenamed(const std::string& from, const std::string& to) {
+  fileRemoved(from);
+  fileChanged(to);
+}
+
+bool LibraryCatalog::isVerified(const std::string& folder) const {
+  return std::find(verifiedFolders.begin(), verifiedFolders.end(), folder) != verifiedFolders.end();
+}
+
+void LibraryCatalog::setVerified(const std::string& folder, const bool verified) {
+  verifiedFolders.erase(std::remove(verifiedFolders.begin(), verifiedFolders.end(), folder), verifiedFolders.end());
+  if (!verified) {
+    return;
+  }
+  if (verifiedFolders.size() >= MAX_VERIFIED_FOLDERS) {
+    verifiedFolders.erase(verifiedFolders.begin());
+  }
+  verifiedFolders.push_back(folder);
+}
+
+void LibraryCatalog::forgetFolder(const std::string& folder) {
+  // The catalogs of the folders below stay on the card, unverified, and are rewritten if such a folder is listed again
+  const std::string prefix = folder == "/" ? folder : folder + "/";
+  verifiedFolders.erase(std::remove_if(verifiedFolders.begin(), verifiedFolders.end(),
+                                       [&](const std::string& verified) {
+                                         return verified == folder || verified.compare(0, prefix.size(), prefix) == 0;
+                                       }),
+                        verifiedFolders.end());
+  const std::string path = catalogPath(folder);
+  if (Storage.exists(path.c_str())) {
+    Storage.remove(path.c_str());
+  }
+}
+
+bool LibraryCatalog::rebuild(const std::string& folder, const uint32_t stamp) {
+  auto dir = Storage.open(folder.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    LOG_DBG("LIB", "Not a folder: %s", folder.c_str());
+    return false;
+  }
+  [[maybe_unused]] const auto start = millis();
+
+  // Only names, sizes and times while walking, the way the listing used to hold them
+  struct Stub {
+    std::string name;
+    uint32_t size;
+    uint32_t modified;
+  };
+  std::vector<Stub> stubs;
+  char name[500];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    if (!isHidden(name)) {
+      const bool isDirectory = file.isDirectory();
+      stubs.push_back({isDirectory ? std::string(name) + "/" : std::string(name),
+                       isDirectory ? 0 : static_cast<uint32_t>(file.size()), modifiedOf(file)});
+    }
+    file.close();
+    esp_task_wdt_reset();
+  }
+  dir.close();
+  std::sort(stubs.begin(), stubs.end(), [](const Stub& a, const Stub& b) { return compareNames(a.name, b.name); });
+
+  // The old catalog is in the same order, so its entries are matched in one pass alongside the new ones
+  const std::string path = catalogPath(folder);
+  auto old = Storage.open(path.c_str());
+  Header oldHeader;
+  std::vector<std::string> changedKeys;
+  std::vector<Entry> changed;
+  bool hasOld = old && readHeader(old, folder, oldHeader);
+  const size_t oldStart = hasOld ? old.position() : 0;
+  hasOld = hasOld && readJournal(old, oldHeader, changedKeys, changed) && old.seekSet(oldStart);
+  uint32_t oldRemaining = hasOld ? oldHeader.entryCount : 0;
+  Entry oldEntry;
+  bool oldValid = false;
+  const auto nextOld = [&] {
+    oldValid = oldRemaining > 0 && readEntry(old, oldEntry);
+    oldRemaining = oldValid ? oldRemaining - 1 : 0;
+  };
+  nextOld();
+
+  Storage.mkdir(CATALOG_DIR);
+  const std::string tmpPath = path + ".tmp";
+  HalFile out;
+  if (!Storage.openFileForWrite("LIB", tmpPath, out)) {
+    if (old) old.close();
+    return false;
+  }
+  Header header;
+  header.stamp = stamp;
+  header.entryCount = stubs.size();
+  // Written again once the journal offset is known
+  writeHeader(out, folder, header);
+
+  int described = 0;
+  for (auto& stub : stubs) {
+    const Entry* known = nullptr;
+    const auto changedEntry =
+        std::find_if(changed.begin(), changed.end(), [&stub](const Entry& entry) { return entry.name == stub.name; });
+    if (changedEntry != changed.end()) {
+      known = &*changedEntry;
+    } else if (std::find(changedKeys.begin(), changedKeys.end(), entryKey(stub.name)) == changedKeys.end()) {
+      while (oldValid && compareNames(oldEntry.name, stub.name)) {
+        nextOld();
+      }
+      if (oldValid && oldEntry.name == stub.name) {
+        known = &oldEntry;
+      }
+    }
+
+    if (known && known->size == stub.size && known->modified == stub.modified) {
+      writeEntry(out, *known);
+    } else {
+      Entry entry;
+      entry.name = std::move(stub.name);
+      entry.size = stub.size;
+      entry.modified = stub.modified;
+      describe(folder, entry);
+      writeEntry(out, entry);
+      described++;
+    }
+    esp_task_wdt_reset();
+  }
+
+  header.journalOffset = out.position();
+  out.seekSet(0);
+  writeHeader(out, folder, header);
+  out.close();
+  if (old) old.close();
+
+  if (Storage.exists(path.c_str())) {
+    Storage.remove(path.c_str());
+  }
+  if (!Storage.rename(tmpPath.c_str(), path.c_str())) {
+    LOG_ERR("LIB", "Failed to write the catalog of %s", folder.c_str());
+    Storage.remove(tmpPath.c_str());
+    return false;
+  }
+  LOG_DBG("LIB", "Cataloged %s: %u entries, %d described anew, %lu ms", folder.c_str(),
+          static_cast<unsigned>(stubs.size()), described, millis() - start);
+  return true;
+}
+
+bool LibraryCatalog::stream(const std::string& folder, const uint32_t stamp,
+                            const std::function<void(const Entry&)>& visitor) {
+  auto file = Storage.open(catalogPath(folder).c_str());
+  if (!file) {
+    return false;
+  }
+  Header header;
+  std::vector<std::string> changedKeys;
+  std::vector<Entry> changed;
+  bool valid = readHeader(file, folder, header) && header.stamp == stamp;
+  const size_t entriesStart = valid ? file.position() : 0;
+  valid = valid && readJournal(file, header, changedKeys, changed) && file.seekSet(entriesStart);
+  if (!valid) {
+    file.close();
+    return false;
+  }
+
+  // Appended changes take the place of the stored entries they name
+  std::sort(changed.begin(), changed.end(),
+            [](const Entry& a, const Entry& b) { return compareNames(a.name, b.name); });
+  auto nextChanged = changed.begin();
+  Entry entry;
+  for (uint32_t i = 0; i < header.entryCount; i++) {
+    if (!readEntry(file, entry)) {
+      // Rewritten on the next listing
+      LOG_ERR("LIB", "Catalog of %s is damaged", folder.c_str());
+      setVerified(folder, false);
+      break;
+    }
+    while (nextChanged != changed.end() && compareNames(nextChanged->name, entry.name)) {
+      visitor(*nextChanged++);
+    }
+    if (std::find(changedKeys.begin(), changedKeys.end(), entryKey(entry.name)) == changedKeys.end()) {
+      visitor(entry);
+    }
+    esp_task_wdt_reset();
+  }
+  while (nextChanged != changed.end()) {
+    visitor(*nextChanged++);
+  }
+  file.close();
+  return true;
+}
+
+void LibraryCatalog::appendJournal(const std::string& path, const bool exists) {
+  std::string folder;
+  std::string name;
+  splitPath(path, folder, name);
+  if (name.empty() || isHidden(name.c_str())) {
+    return;
+  }
+
+  MutexGuard guard(mutex);
+  // Folders not checked since boot are walked when they are listed next, which picks the change up
+  if (!isVerified(folder)) {
+    return;
+  }
+
+  Entry entry;
+  entry.name = name;
+  JournalOp op = JournalOp::Remove;
+  if (exists) {
+    auto file = Storage.open(path.c_str());
+    if (file) {
+      if (file.isDirectory()) {
+        entry.name += '/';
+      } else {
+        entry.size = file.size();
+      }
+      entry.modified = modifiedOf(file);
+      file.close();
+      describe(folder, entry);
+      op = JournalOp::Upsert;
+    }
+  }
+
+  auto file = Storage.open(catalogPath(folder).c_str(), O_RDWR);
+  Header header;
+  if (!file || !readHeader(file, folder, header) || header.journalCount >= MAX_JOURNAL) {
+    if (file) file.close();
+    // Rewritten on the next listing
+    setVerified(folder, false);
+    return;
+  }
+  header.journalCount++;
+  file.seekSet(file.fileSize());
+  serialization::writePod(file, static_cast<uint8_t>(op));
+  writeEntry(file, entry);
+  // The change may have touched the folder's time; it is accounted for now
+  file.seekSet(STAMP_OFFSET);
+  serialization::writePod(file, folderStamp(folder));
+  file.seekSet(JOURNAL_COUNT_OFFSET);
+  serialization::writePod(file, header.journalCount);
+  file.close();
+}
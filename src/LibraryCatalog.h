@@ -0,0 +1,84 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * LibraryCatalog
+ *
+ * Listing of the SD card folders as the library shows them, kept in /.crosspoint/library with one file per folder.
+ * It holds the name, size, modification time and type of every entry. For books it also holds the title and author
+ * from their metadata cache and whether the home screen thumbnail exists. Entries are stored in library order
+ * (folders first, then natural name order), so a listing is one sequential read and sorting by title, author or date
+ * needs no book to be opened.
+ *
+ * A folder's catalog is checked against the folder the first time it is listed after boot, and again whenever the
+ * folder's modification time changes (the root folder has none). That walk reuses the entries of files whose size and
+ * time are unchanged, so only new or changed books are opened. Changes the reader makes itself are reported through
+ * fileChanged(), fileRemoved() and fileRenamed(), which append them to the folder's catalog instead of rewriting it.
+ * That includes a book's metadata cache or thumbnail being written, which the walk never looks for again.
+ */
+class LibraryCatalog {
+ public:
+  enum class Type : uint8_t { Directory, Epub, Xtc, Txt, Image, Other };
+
+  struct Entry {
+    std::string name;       // Folders end with '/'
+    uint32_t size = 0;      // 0 for folders
+    uint32_t modified = 0;  // FAT date << 16 | FAT time, 0 if the file has none
+    Type type = Type::Other;
+    bool hasMetadata = false;  // Title and author are known, or the type has none
+    bool hasThumb = false;
+    std::string title;
+    std::string author;
+  };
+
+  LibraryCatalog();
+  ~LibraryCatalog();
+  LibraryCatalog(const LibraryCatalog&) = delete;
+  LibraryCatalog& operator=(const LibraryCatalog&) = delete;
+
+  static LibraryCatalog& getInstance() { return instance; }
+
+  // Calls `visitor` for every visible entry of `folder` in library order, bringing the catalog up to date first.
+  // Returns false if the folder cannot be read. The visitor must not call back into the catalog.
+  bool forEach(const std::string& folder, const std::function<void(const Entry&)>& visitor);
+
+  // Hooks for changes made on the device. Call them once the change is on the card.
+  // The file or folder at `path` was created or written, or its book was prepared
+  void fileChanged(const std::string& path);
+  // The file or folder at `path` was deleted
+  void fileRemoved(const std::string& path);
+  void fileRenamed(const std::string& from, const std::string& to);
+
+  static Type typeOf(const std::string& name);
+  // Dot files and system folders, which neither the library nor the web file list show
+  static bool isHidden(const char* name);
+  // Library order: folders first, then names in case-insensitive natural order ("2" before "10")
+  static bool compareNames(const std::string& a, const std::string& b);
+
+ private:
+  static LibraryCatalog instance;
+
+  // Guards the catalog files and `verifiedFolders`, as uploads report changes from other tasks
+  SemaphoreHandle_t mutex = nullptr;
+  // Folders whose catalog was checked against the folder since boot, most recent last
+  std::vector<std::string> verifiedFolders;
+
+  bool isVerified(const std::string& folder) const;
+  void setVerified(const std::string& folder, bool verified);
+  // Drops what is known about `folder` and the folders below it
+  void forgetFolder(const std::string& folder);
+
+  bool rebuild(const std::string& folder, uint32_t stamp);
+  // Returns false, without visiting anything, if the catalog is missing or out of date
+  bool stream(const std::string& folder, uint32_t stamp, const std::function<void(const Entry&)>& visitor);
+  void appendJournal(const std::string& path, bool exists);
+};
+
+#define LIBRARY_CATALOG LibraryCatalog::getInstance()
@@ -13,8 +13,10 @@
 #include "NetworkModeSelectionActivity.h"
 #include "WifiSelectionActivity.h"
 #include "activities/network/CalibreConnectActivity.h"
+#include "activities/reader/EpubReaderActivity.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
+#include "network/BookIngest.h"
 #include "util/QrUtils.h"
 
 namespace {
@@ -30,6 +32,10 @@ constexpr int QR_CODE_HEIGHT = 198;
 // DNS server for captive portal (redirects all DNS queries to our IP)
 DNSServer* dnsServer = nullptr;
 constexpr uint16_t DNS_PORT = 53;
+
+// Uploaded books are prepared once no transfer has run for this long, so a batch of uploads is not slowed down
+constexpr unsigned long INGEST_IDLE_MS = 5000;
+constexpr unsigned long INGEST_CHECK_INTERVAL_MS = 500;
 }  // namespace
 
 void CrossPointWebServerActivity::onEnter() {
@@ -44,6 +50,9 @@ void CrossPointWebServerActivity::onEnter() {
   connectedIP.clear();
   connectedSSID.clear();
   lastHandleClientTime = 0;
+  lastIngestCheck = 0;
+  lastTransferAt = millis();
+  shownIngestState = 0;
   requestUpdate();
 
   // Launch network mode selection subactivity
@@ -65,6 +74,9 @@ void CrossPointWebServerActivity::onExit() {
 
   state = WebServerActivityState::SHUTTING_DOWN;
 
+  // Books still queued are prepared on their first open instead
+  BOOK_INGEST.stop();
+
   // Stop the web server first (before disconnecting WiFi)
   stopWebServer();
 
@@ -332,6 +344,8 @@ void CrossPointWebServerActivity::loop() {
         }
       }
       lastHandleClientTime = millis();
+
+      updateIngest();
     }
 
     // Handle exit on Back button (also check outside loop)
@@ -342,6 +356,42 @@ void CrossPointWebServerActivity::loop() {
   }
 }
 
+void CrossPointWebServerActivity::updateIngest() {
+  const unsigned long now = millis();
+  if (now - lastIngestCheck < INGEST_CHECK_INTERVAL_MS) {
+    return;
+  }
+  lastIngestCheck = now;
+
+  // A transfer is running, or one has just queued a book (every upload path does, WebDAV included)
+  BookIngest::Status ingest = BOOK_INGEST.status();
+  if (UploadWriter::stats().active) {
+    lastTransferAt = now;
+  } else if (ingest.lastQueuedAt > lastTransferAt) {
+    lastTransferAt = ingest.lastQueuedAt;
+  }
+
+  const bool onPower = gpio.isUsbConnected();
+  if (onPower && now - lastTransferAt >= INGEST_IDLE_MS && !BOOK_INGEST.isRunning() && BOOK_INGEST.hasPending()) {
+    SectionPrefetcher::Layout layout = {};
+    {
+      // Measuring the reader layout switches the renderer's orientation for a moment
+      RenderLock lock(*this);
+      layout = EpubReaderActivity::settingsLayout(renderer);
+    }
+    BOOK_INGEST.startNext(renderer, layout);
+  }
+
+  // Redraw the progress line when a book is started or finished, not on every step of one
+  ingest = BOOK_INGEST.status();
+  const uint32_t ingestState = static_cast<uint32_t>(ingest.done) << 16 | (ingest.pending & 0x3FFF) << 2 |
+                               static_cast<uint32_t>(ingest.running) << 1 | static_cast<uint32_t>(onPower);
+  if (ingestState != shownIngestState) {
+    shownIngestState = ingestState;
+    requestUpdate();
+  }
+}
+
 void CrossPointWebServerActivity::render(RenderLock&&) {
   // Only render our own UI when server is running
   // Subactivities handle their own rendering
@@ -437,6 +487,25 @@ void CrossPointWebServerActivity::renderServerRunning() const {
     renderer.drawCenteredText(SMALL_FONT_ID, startY, hostnameUrl.c_str(), true);
   }
 
+  renderIngestStatus(renderer.getScreenHeight() - metrics.buttonHintsHeight - metrics.verticalSpacing -
+                     renderer.getLineHeight(SMALL_FONT_ID));
+
   const auto labels = mappedInput.mapLabels(tr(STR_EXIT), "", "", "");
   GUI.drawButtonHints(renderer, labels.btn1, labels.btn2, labels.btn3, labels.btn4);
 }
+
+void CrossPointWebServerActivity::renderIngestStatus(const int y) const {
+  const BookIngest::Status ingest = BOOK_INGEST.status();
+  const int active = ingest.running ? 1 : 0;
+  char line[96];
+  if (ingest.running || (ingest.pending > 0 && gpio.isUsbConnected())) {
+    snprintf(line, sizeof(line), tr(STR_PREPARING_BOOKS), ingest.done + 1, ingest.done + active + ingest.pending);
+  } else if (ingest.pending > 0) {
+    snprintf(line, sizeof(line), tr(STR_BOOKS_WAIT_FOR_POWER), static_cast<int>(ingest.pending));
+  } else if (ingest.done > 0) {
+    snprintf(line, sizeof(line), tr(STR_BOOKS_READY), ingest.done - ingest.failed);
+  } else {
+    return;
+  }
+  renderer.drawCenteredText(SMALL_FONT_ID, y, line, true);
+}
@@ -25,6 +25,7 @@ enum class WebServerActivityState {
  * - For AP mode: Creates an Access Point that clients can connect to
  * - Starts the CrossPointWebServer when connected
  * - Handles client requests in its loop() function
+ * - Prepares uploaded books for their first open (BookIngest) while no transfer is running and USB power is connected
  * - Cleans up the server and shuts down WiFi on exit
  */
 class CrossPointWebServerActivity final : public Activity {
@@ -44,7 +45,15 @@ class CrossPointWebServerActivity final : public Activity {
   // Performance monitoring
   unsigned long lastHandleClientTime = 0;
 
+  // Preparation of uploaded books (see BookIngest)
+  unsigned long lastIngestCheck = 0;
+  unsigned long lastTransferAt = 0;
+  // Counts shown by the progress line when it was drawn, it is redrawn once they change
+  uint32_t shownIngestState = 0;
+
   void renderServerRunning() const;
+  void renderIngestStatus(int y) const;
+  void updateIngest();
 
   void onNetworkModeSelected(NetworkMode mode);
   void onWifiSelectionComplete(bool connected);
@@ -1,7 +1,8 @@
 #include "EpubReaderActivity.h"
 
 #include <Epub/Page.h>
-#include <Epub/blocks/TextBlock.h>
+#include <Epub/SectionLayoutCache.h>
+#include <Epub/hyphenation/Hyphenator.h>
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
 #include <HalStorage.h>
@@ -62,6 +63,60 @@ void applyReaderOrientation(GfxRenderer& renderer, const uint8_t orientation) {
 
 }  // namespace
 
+void EpubReaderActivity::getReaderMargins(const GfxRenderer& renderer, const bool automaticPageTurnActive,
+                                          int* orientedMarginTop, int* orientedMarginRight, int* orientedMarginBottom,
+                                          int* orientedMarginLeft) {
+  renderer.getOrientedViewableTRBL(orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+  *orientedMarginTop += SETTINGS.screenMargin;
+  *orientedMarginLeft += SETTINGS.screenMargin;
+  *orientedMarginRight += SETTINGS.screenMargin;
+
+  const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
+
+  // reserves space for automatic page turn indicator when no status bar or progress bar only
+  if (automaticPageTurnActive &&
+      (statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight())) {
+    *orientedMarginBottom +=
+        std::max(SETTINGS.screenMargin,
+                 static_cast<uint8_t>(statusBarHeight + UITheme::getInstance().getMetrics().statusBarVerticalMargin));
+  } else {
+    *orientedMarginBottom += std::max(SETTINGS.screenMargin, statusBarHeight);
+  }
+}
+
+SectionPrefetcher::Layout EpubReaderActivity::layoutForMargins(const GfxRenderer& renderer,
+                                                               const int orientedMarginTop,
+                                                               const int orientedMarginRight,
+                                                               const int orientedMarginBottom,
+                                                               const int orientedMarginLeft) {
+  const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
+  const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
+  return {
+      SETTINGS.getReaderFontId(),
+      SETTINGS.getReaderLineCompression(),
+      static_cast<bool>(SETTINGS.extraParagraphSpacing),
+      SETTINGS.paragraphAlignment,
+      viewportWidth,
+      viewportHeight,
+      static_cast<bool>(SETTINGS.hyphenationEnabled),
+      static_cast<bool>(SETTINGS.embeddedStyle),
+  };
+}
+
+SectionPrefetcher::Layout EpubReaderActivity::settingsLayout(GfxRenderer& renderer) {
+  const GfxRenderer::Orientation orientation = renderer.getOrientation();
+  applyReaderOrientation(renderer, SETTINGS.orientation);
+
+  int orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft;
+  getReaderMargins(renderer, false, &orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
+                   &orientedMarginLeft);
+  const SectionPrefetcher::Layout layout =
+      layoutForMargins(renderer, orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+
+  renderer.setOrientation(orientation);
+  return layout;
+}
+
 void EpubReaderActivity::onEnter() {
   Activity::onEnter();
 
@@ -118,7 +173,10 @@ void EpubReaderActivity::onExit() {
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
   section.reset();
+  prefetcher.cancel();
   epub.reset();
+  Hyphenator::releaseMemo();
+  renderer.clearFontCache();
 }
 
 void EpubReaderActivity::loop() {
@@ -357,27 +415,19 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     }
     case EpubReaderMenuActivity::MenuAction::DISPLAY_QR: {
       if (section && section->currentPage >= 0 && section->currentPage < section->pageCount) {
-        auto p = section->loadPageFromSectionFile();
-        if (p) {
-          std::string fullText;
-          for (const auto& el : p->elements) {
-            if (el->getTag() == TAG_PageLine) {
-              const auto& line = static_cast<const PageLine&>(*el);
-              if (line.getBlock()) {
-                const auto& words = line.getBlock()->getWords();
-                for (const auto& w : words) {
-                  if (!fullText.empty()) fullText += " ";
-                  fullText += w;
-                }
-              }
-            }
-          }
-          if (!fullText.empty()) {
-            startActivityForResult(std::make_unique<QrDisplayActivity>(renderer, mappedInput, fullText),
-                                   [this](const ActivityResult& result) {});
-            break;
+        std::string fullText;
+        {
+          // The section's page cache is shared with the render task
+          RenderLock lock(*this);
+          if (const auto p = section->loadPageFromSectionFile()) {
+            fullText = p->getText();
           }
         }
+        if (!fullText.empty()) {
+          startActivityForResult(std::make_unique<QrDisplayActivity>(renderer, mappedInput, fullText),
+                                 [this](const ActivityResult& result) {});
+          break;
+        }
       }
       // If no text or page loading failed, just close menu
       requestUpdate();
@@ -393,7 +443,8 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
         if (epub && section) {
           uint16_t backupSpine = currentSpineIndex;
           uint16_t backupPage = section->currentPage;
-          uint16_t backupPageCount = section->pageCount;
+          uint16_t backupPageCount = section->isPartial() ? 0 : section->pageCount;
+          prefetcher.cancel();
           section.reset();
           epub->clearCache();
           epub->setupCacheDir();
@@ -446,7 +497,7 @@ void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
     RenderLock lock(*this);
     if (section) {
       cachedSpineIndex = currentSpineIndex;
-      cachedChapterTotalPageCount = section->pageCount;
+      cachedChapterTotalPageCount = section->isPartial() ? 0 : section->pageCount;
       nextPageNumber = section->currentPage;
     }
 
@@ -480,7 +531,7 @@ void EpubReaderActivity::toggleAutoPageTurn(const uint8_t selectedPageTurnOption
     RenderLock lock(*this);
     if (section) {
       cachedSpineIndex = currentSpineIndex;
-      cachedChapterTotalPageCount = section->pageCount;
+      cachedChapterTotalPageCount = section->isPartial() ? 0 : section->pageCount;
       nextPageNumber = section->currentPage;
     }
     section.reset();
@@ -489,7 +540,8 @@ void EpubReaderActivity::toggleAutoPageTurn(const uint8_t selectedPageTurnOption
 
 void EpubReaderActivity::pageTurn(bool isForwardTurn) {
   if (isForwardTurn) {
-    if (section->currentPage < section->pageCount - 1) {
+    // While the chapter is still being indexed its last page is not known yet, render() sorts that out
+    if (section->currentPage < section->pageCount - 1 || section->isPartial()) {
       section->currentPage++;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
@@ -543,42 +595,48 @@ void EpubReaderActivity::render(RenderLock&& lock) {
 
   // Apply screen viewable areas and additional padding
   int orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft;
-  renderer.getOrientedViewableTRBL(&orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
-                                   &orientedMarginLeft);
-  orientedMarginTop += SETTINGS.screenMargin;
-  orientedMarginLeft += SETTINGS.screenMargin;
-  orientedMarginRight += SETTINGS.screenMargin;
-
-  const uint8_t statusBarHeight = UITheme::getInstance().getStatusBarHeight();
-
-  // reserves space for automatic page turn indicator when no status bar or progress bar only
-  if (automaticPageTurnActive &&
-      (statusBarHeight == 0 || statusBarHeight == UITheme::getInstance().getProgressBarHeight())) {
-    orientedMarginBottom +=
-        std::max(SETTINGS.screenMargin,
-                 static_cast<uint8_t>(statusBarHeight + UITheme::getInstance().getMetrics().statusBarVerticalMargin));
-  } else {
-    orientedMarginBottom += std::max(SETTINGS.screenMargin, statusBarHeight);
-  }
+  getReaderMargins(renderer, automaticPageTurnActive, &orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
+                   &orientedMarginLeft);
+  const SectionPrefetcher::Layout layout =
+      layoutForMargins(renderer, orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
 
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
     LOG_DBG("ERS", "Loading file: %s, index: %d", filepath.c_str(), currentSpineIndex);
     section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
 
-    const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
-    const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
+    const uint32_t fingerprint = SectionLayoutCache::fingerprint(
+        layout.fontId, layout.lineCompression, layout.extraParagraphSpacing, layout.paragraphAlignment,
+        layout.viewportWidth, layout.viewportHeight, layout.hyphenationEnabled, layout.embeddedStyle);
+    if (fingerprint != layoutFingerprint) {
+      // A background build of the previous layout could be writing into a directory that is about to be evicted
+      prefetcher.cancel();
+      SectionLayoutCache::use(epub->getCachePath(), fingerprint, SETTINGS.cachedLayouts, SECTION_CACHE_MAX_BYTES);
+      layoutFingerprint = fingerprint;
+    }
 
-    if (!section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
-                                  SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
-                                  viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle)) {
+    // Unless the position depends on the chapter's final page count, its page can be shown as soon as it is laid out
+    const bool targetPageKnown =
+        nextPageNumber != UINT16_MAX && cachedChapterTotalPageCount == 0 && !pendingPercentJump;
+    bool loaded = targetPageKnown && openSectionWhileIndexing(layout);
+    if (!loaded) {
+      // A background build of this section has to finish before its file is read, any other one is abandoned
+      prefetcher.settle(currentSpineIndex, layout);
+      loaded = section->loadSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                        layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                        layout.hyphenationEnabled, layout.embeddedStyle);
+    }
+
+    if (!loaded) {
       LOG_DBG("ERS", "Cache not found, building...");
+      // Layout only needs glyph metrics; give the decompressed glyph cache back to the parser
+      renderer.clearFontCache();
 
       const auto popupFn = [this]() { GUI.drawPopup(renderer, tr(STR_INDEXING)); };
 
-      if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
-                                      SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
-                                      viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle, popupFn)) {
+      if (!section->createSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                      layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                      layout.hyphenationEnabled, layout.embeddedStyle, popupFn)) {
         LOG_ERR("ERS", "Failed to persist page data to SD");
         section.reset();
         return;
@@ -615,6 +673,11 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     }
   }
 
+  // Pages committed since the last render, or the complete file once the chapter has been indexed
+  if (section->isPartial() && !refreshPartialSection(layout)) {
+    return;
+  }
+
   renderer.clearScreen();
 
   if (section->pageCount == 0) {
@@ -648,19 +711,92 @@ void EpubReaderActivity::render(RenderLock&& lock) {
     }
 
     // Collect footnotes from the loaded page
-    currentPageFootnotes = std::move(p->footnotes);
+    currentPageFootnotes.assign(p->getFootnotes(), p->getFootnotes() + p->getFootnoteCount());
 
     const auto start = millis();
-    renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+    renderContents(*p, orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
     LOG_DBG("ERS", "Rendered page in %dms", millis() - start);
-    renderer.clearFontCache();
+    renderer.logFontCacheStats();
+  }
+  // A page count that is still growing would misplace the position if it were used to reflow it later
+  saveProgress(currentSpineIndex, section->currentPage, section->isPartial() ? 0 : section->pageCount);
+
+  // Lay out the next chapter while this one is being read, so turning into it does not wait for indexing. That has
+  // to wait until the prefetcher is done with this chapter.
+  if (!section->isPartial() && currentSpineIndex + 1 < epub->getSpineItemsCount()) {
+    prefetcher.start(epub, renderer, currentSpineIndex + 1, layout);
   }
-  saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
 
   if (pendingScreenshot) {
     pendingScreenshot = false;
     ScreenshotUtil::takeScreenshot(renderer);
   }
+
+  // The page is on screen: decode its neighbours now, so the next turn in either direction only has to render
+  section->prefetchPages(PAGE_PREFETCH_RADIUS, PAGE_PREFETCH_BUDGET);
+}
+
+bool EpubReaderActivity::openSectionWhileIndexing(const SectionPrefetcher::Layout& layout) {
+  if (!prefetcher.isBuilding(currentSpineIndex, layout)) {
+    // Nothing else may be laid out next to this build (see SectionPrefetcher)
+    prefetcher.cancel();
+    if (section->loadSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                 layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                 layout.hyphenationEnabled, layout.embeddedStyle)) {
+      return true;
+    }
+    // Layout only needs glyph metrics; give the decompressed glyph cache back to the parser
+    renderer.clearFontCache();
+    if (!prefetcher.start(epub, renderer, currentSpineIndex, layout)) {
+      return false;
+    }
+  }
+
+  // Page 0 is usually laid out in a fraction of a second, a resumed page further in may take a while
+  if (nextPageNumber > 0) {
+    GUI.drawPopup(renderer, tr(STR_INDEXING));
+  }
+  const int committed = prefetcher.waitForPages(currentSpineIndex, layout, nextPageNumber + 1);
+  if (committed < 0) {
+    // The build has already ended, so its file is complete unless it failed
+    return section->loadSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                    layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                    layout.hyphenationEnabled, layout.embeddedStyle);
+  }
+  return section->loadPartialSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                         layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                         layout.hyphenationEnabled, layout.embeddedStyle, committed);
+}
+
+bool EpubReaderActivity::refreshPartialSection(const SectionPrefetcher::Layout& layout) {
+  const int committed = prefetcher.waitForPages(currentSpineIndex, layout, section->currentPage + 1);
+  if (committed >= 0) {
+    return section->loadPartialSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                           layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                           layout.hyphenationEnabled, layout.embeddedStyle, committed);
+  }
+
+  const int page = section->currentPage;
+  if (!section->loadSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                layout.hyphenationEnabled, layout.embeddedStyle)) {
+    LOG_ERR("ERS", "Background indexing of section %d failed", currentSpineIndex);
+    nextPageNumber = page;
+    section.reset();
+    requestUpdate();  // Builds the section in the foreground
+    return false;
+  }
+  LOG_DBG("ERS", "Section indexed, %d pages", section->pageCount);
+
+  // Turned past the last page before it was known
+  if (page >= section->pageCount && section->pageCount > 0) {
+    nextPageNumber = 0;
+    currentSpineIndex++;
+    section.reset();
+    requestUpdate();
+    return false;
+  }
+  return true;
 }
 
 void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
@@ -680,13 +816,12 @@ void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageC
     LOG_ERR("ERS", "Could not save progress!");
   }
 }
-void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
-                                        const int orientedMarginRight, const int orientedMarginBottom,
-                                        const int orientedMarginLeft) {
+void EpubReaderActivity::renderContents(const Page& page, const int orientedMarginTop, const int orientedMarginRight,
+                                        const int orientedMarginBottom, const int orientedMarginLeft) {
   // Force special handling for pages with images when anti-aliasing is on
-  bool imagePageWithAA = page->hasImages() && SETTINGS.textAntiAliasing;
+  bool imagePageWithAA = page.hasImages() && SETTINGS.textAntiAliasing;
 
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
   renderStatusBar();
   if (imagePageWithAA) {
     // Double FAST_REFRESH with selective image blanking (pablohc's technique):
@@ -695,12 +830,12 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
     // Step 1: Display page with image area blanked (text appears, image area white)
     // Step 2: Re-render with images and display again (images appear clean)
     int16_t imgX, imgY, imgW, imgH;
-    if (page->getImageBoundingBox(imgX, imgY, imgW, imgH)) {
+    if (page.getImageBoundingBox(imgX, imgY, imgW, imgH)) {
       renderer.fillRect(imgX + orientedMarginLeft, imgY + orientedMarginTop, imgW, imgH, false);
       renderer.displayBuffer(HalDisplay::FAST_REFRESH);
 
       // Re-render page content to restore images into the blanked area
-      page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+      page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
       renderStatusBar();
       renderer.displayBuffer(HalDisplay::FAST_REFRESH);
     } else {
@@ -716,20 +851,24 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
   }
 
   // Save bw buffer to reset buffer state after grayscale data sync
-  renderer.storeBwBuffer();
+  if (!renderer.storeBwBuffer()) {
+    // The glyph cache persists across pages, hand its memory back and retry once
+    renderer.clearFontCache();
+    renderer.storeBwBuffer();
+  }
 
   // grayscale rendering
   // TODO: Only do this if font supports it
   if (SETTINGS.textAntiAliasing) {
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
     renderer.copyGrayscaleLsbBuffers();
 
     // Render and copy to MSB buffer
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
     renderer.copyGrayscaleMsbBuffers();
 
     // display grayscale part
@@ -4,11 +4,20 @@
 #include <Epub/Section.h>
 
 #include "EpubReaderMenuActivity.h"
+#include "SectionPrefetcher.h"
 #include "activities/Activity.h"
 
 class EpubReaderActivity final : public Activity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
+  // Lays out the next spine item in the background while the current one is read
+  SectionPrefetcher prefetcher;
+  // Decoded pages kept on each side of the current one for instant page turns, and the heap they may use in total
+  // (the page on screen included). The budget leaves room for the grayscale buffers of anti-aliased rendering.
+  static constexpr int PAGE_PREFETCH_RADIUS = 1;
+  static constexpr size_t PAGE_PREFETCH_BUDGET = 32 * 1024;
+  // Layout the section cache was last switched to, 0 before the first section is opened
+  uint32_t layoutFingerprint = 0;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
   int pagesUntilFullRefresh = 0;
@@ -35,8 +44,8 @@ class EpubReaderActivity final : public Activity {
   SavedPosition savedPositions[MAX_FOOTNOTE_DEPTH] = {};
   int footnoteDepth = 0;
 
-  void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
-                      int orientedMarginBottom, int orientedMarginLeft);
+  void renderContents(const Page& page, int orientedMarginTop, int orientedMarginRight, int orientedMarginBottom,
+                      int orientedMarginLeft);
   void renderStatusBar() const;
   void saveProgress(int spineIndex, int currentPage, int pageCount);
   // Jump to a percentage of the book (0-100), mapping it to spine and page.
@@ -45,12 +54,30 @@ class EpubReaderActivity final : public Activity {
   void applyOrientation(uint8_t orientation);
   void toggleAutoPageTurn(uint8_t selectedPageTurnOption);
   void pageTurn(bool isForwardTurn);
+  // Opens the current section as soon as the page at nextPageNumber is readable, indexing the rest of it on the
+  // prefetcher's task. Returns false if that is not possible, in which case the section is built in the foreground.
+  bool openSectionWhileIndexing(const SectionPrefetcher::Layout& layout);
+  // Catches a partially indexed section up with its build. Returns false if the section had to be dropped.
+  bool refreshPartialSection(const SectionPrefetcher::Layout& layout);
+  // Text area margins for the settings in the renderer's current orientation
+  static void getReaderMargins(const GfxRenderer& renderer, bool automaticPageTurnActive, int* orientedMarginTop,
+                               int* orientedMarginRight, int* orientedMarginBottom, int* orientedMarginLeft);
+  static SectionPrefetcher::Layout layoutForMargins(const GfxRenderer& renderer, int orientedMarginTop,
+                                                    int orientedMarginRight, int orientedMarginBottom,
+                                                    int orientedMarginLeft);
 
   // Footnote navigation
   void navigateToHref(const std::string& href, bool savePosition = false);
   void restoreSavedPosition();
 
  public:
+  // Section files of older layouts (see SectionLayoutCache) are evicted once a book's cached layouts take more
+  static constexpr uint32_t SECTION_CACHE_MAX_BYTES = 16 * 1024 * 1024;
+
+  // Layout a book opened now would be read with: the current settings in the reader orientation, without the auto
+  // turn indicator. Switches the renderer's orientation while measuring, so nothing else may draw meanwhile.
+  static SectionPrefetcher::Layout settingsLayout(GfxRenderer& renderer);
+
   explicit EpubReaderActivity(GfxRenderer& renderer, MappedInputManager& mappedInput, std::unique_ptr<Epub> epub)
       : Activity("EpubReader", renderer, mappedInput), epub(std::move(epub)) {}
   void onEnter() override;
@@ -5,6 +5,7 @@
 #include "CrossPointSettings.h"
 #include "Epub.h"
 #include "EpubReaderActivity.h"
+#include "LibraryCatalog.h"
 #include "Txt.h"
 #include "TxtReaderActivity.h"
 #include "Xtc.h"
@@ -39,7 +40,13 @@ std::unique_ptr<Epub> ReaderActivity::loadEpub(const std::string& path) {
   }
 
   auto epub = std::unique_ptr<Epub>(new Epub(path, "/.crosspoint"));
+  // A book without a cache folder has never been opened or prepared, so loading it builds its metadata
+  const bool firstOpen = !Storage.exists(epub->getCachePath().c_str());
   if (epub->load(true, SETTINGS.embeddedStyle == 0)) {
+    if (firstOpen) {
+      LIBRARY_CATALOG.fileChanged(path);
+    }
+    epub->loadResidentTables();
     return epub;
   }
 
@@ -0,0 +1,127 @@
+#include "SectionPrefetcher.h"
+
+#include <Arduino.h>
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <Logging.h>
+
+#include <cassert>
+
+bool SectionPrefetcher::Layout::operator==(const Layout& other) const {
+  return fontId == other.fontId && lineCompression == other.lineCompression &&
+         extraParagraphSpacing == other.extraParagraphSpacing && paragraphAlignment == other.paragraphAlignment &&
+         viewportWidth == other.viewportWidth && viewportHeight == other.viewportHeight &&
+         hyphenationEnabled == other.hyphenationEnabled && embeddedStyle == other.embeddedStyle;
+}
+
+SectionPrefetcher::SectionPrefetcher() {
+  idleSemaphore = xSemaphoreCreateBinary();
+  assert(idleSemaphore != nullptr);
+  xSemaphoreGive(idleSemaphore);
+}
+
+SectionPrefetcher::~SectionPrefetcher() {
+  cancel();
+  vSemaphoreDelete(idleSemaphore);
+}
+
+bool SectionPrefetcher::start(const std::shared_ptr<Epub>& epub, GfxRenderer& renderer, const int spineIndex,
+                              const Layout& layout) {
+  if (spineIndex == requestedSpineIndex && layout == this->layout) {
+    return true;
+  }
+  cancel();
+
+  if (ESP.getFreeHeap() < MIN_FREE_HEAP) {
+    LOG_DBG("SPF", "Not enough heap to prefetch section %d (%u free)", spineIndex, ESP.getFreeHeap());
+    return false;
+  }
+
+  requestedSpineIndex = spineIndex;
+  this->layout = layout;
+  section = std::unique_ptr<Section>(new Section(epub, spineIndex, renderer));
+  cancelRequested = false;
+  committedPages = 0;
+  running = true;
+
+  xSemaphoreTake(idleSemaphore, portMAX_DELAY);
+  if (xTaskCreate(&taskTrampoline, "SectionPrefetch", TASK_STACK_SIZE, this, TASK_PRIORITY, nullptr) != pdPASS) {
+    LOG_ERR("SPF", "Failed to create prefetch task");
+    running = false;
+    section.reset();
+    requestedSpineIndex = -1;
+    xSemaphoreGive(idleSemaphore);
+    return false;
+  }
+  return true;
+}
+
+void SectionPrefetcher::settle(const int spineIndex, const Layout& layout) {
+  if (spineIndex == requestedSpineIndex && layout == this->layout) {
+    waitUntilIdle();
+  } else {
+    cancel();
+  }
+}
+
+void SectionPrefetcher::cancel() {
+  cancelRequested = true;
+  waitUntilIdle();
+  requestedSpineIndex = -1;
+}
+
+bool SectionPrefetcher::isBuilding(const int spineIndex, const Layout& layout) const {
+  return running && spineIndex == requestedSpineIndex && layout == this->layout;
+}
+
+int SectionPrefetcher::waitForPages(const int spineIndex, const Layout& layout, const int pages) const {
+  if (spineIndex != requestedSpineIndex || !(layout == this->layout)) {
+    return -1;
+  }
+  while (running) {
+    const int committed = committedPages;
+    if (committed >= pages) {
+      return committed;
+    }
+    vTaskDelay(PROGRESS_POLL_TICKS);
+  }
+  return -1;
+}
+
+void SectionPrefetcher::waitUntilIdle() {
+  xSemaphoreTake(idleSemaphore, portMAX_DELAY);
+  xSemaphoreGive(idleSemaphore);
+}
+
+void SectionPrefetcher::taskTrampoline(void* param) {
+  auto* self = static_cast<SectionPrefetcher*>(param);
+  // The owner may destroy the prefetcher as soon as the semaphore is given back, so keep a copy of the handle
+  const SemaphoreHandle_t idle = self->idleSemaphore;
+  self->build();
+  self->running = false;
+  xSemaphoreGive(idle);
+  vTaskDelete(nullptr);
+}
+
+void SectionPrefetcher::build() {
+  [[maybe_unused]] const int spineIndex = section->getSpineIndex();
+  [[maybe_unused]] const auto start = millis();
+
+  if (section->loadSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                               layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                               layout.hyphenationEnabled, layout.embeddedStyle)) {
+    LOG_DBG("SPF", "Section %d already cached", spineIndex);
+  } else if (section->createSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                        layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                        layout.hyphenationEnabled, layout.embeddedStyle, nullptr,
+                                        [this] { return cancelRequested.load(); },
+                                        [this](const uint16_t pages) { committedPages = pages; })) {
+    LOG_DBG("SPF", "Prefetched section %d (%d pages) in %lu ms", spineIndex, section->pageCount, millis() - start);
+  } else if (cancelRequested) {
+    LOG_DBG("SPF", "Prefetch of section %d cancelled", spineIndex);
+  } else {
+    LOG_ERR("SPF", "Failed to prefetch section %d", spineIndex);
+  }
+
+  section.reset();
+}
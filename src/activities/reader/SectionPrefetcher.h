@@ -0,0 +1,96 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+class Epub;
+class GfxRenderer;
+class Section;
+
+/**
+ * SectionPrefetcher
+ *
+ * Builds the section cache (sections/<layout>/<n>.bin) of an upcoming spine item on a low-priority task while the
+ * reader is still showing the current one, so crossing into the next chapter loads a finished file instead of
+ * indexing behind the "Indexing" popup.
+ *
+ * At most one build runs at a time. The caller must hold the RenderLock when calling start(): the job's Section is
+ * constructed there, which is the only point that reads the shared book.bin handle. From then on the task only reads
+ * the epub through its own ZipFile handles, writes its own section file and measures text with read-only font data.
+ * All of its SD access goes through HalStorage's mutex, and it never takes the RenderLock itself, so the render task
+ * may block on it while holding that lock.
+ *
+ * Layout of the foreground and the background section must not overlap (they share the book's CssParser and the
+ * hyphenator language), so the reader calls settle() before it touches a section file itself.
+ *
+ * The reader may also build the section it is about to show here and display its first pages while the rest is still
+ * being indexed: waitForPages() reports how many pages the build has committed to the file so far, which
+ * Section::loadPartialSectionFile() can read.
+ */
+class SectionPrefetcher {
+ public:
+  struct Layout {
+    int fontId;
+    float lineCompression;
+    bool extraParagraphSpacing;
+    uint8_t paragraphAlignment;
+    uint16_t viewportWidth;
+    uint16_t viewportHeight;
+    bool hyphenationEnabled;
+    bool embeddedStyle;
+
+    bool operator==(const Layout& other) const;
+  };
+
+  SectionPrefetcher();
+  ~SectionPrefetcher();
+  SectionPrefetcher(const SectionPrefetcher&) = delete;
+  SectionPrefetcher& operator=(const SectionPrefetcher&) = delete;
+
+  // Starts building the given spine item with the given layout unless that build was already requested. Any other
+  // build still in flight is cancelled first. Returns false if the build could not be started.
+  bool start(const std::shared_ptr<Epub>& epub, GfxRenderer& renderer, int spineIndex, const Layout& layout);
+  // Returns once no build is running. A build of exactly this section is waited for so its file can be used, any
+  // other build is cancelled and its partial file removed.
+  void settle(int spineIndex, const Layout& layout);
+  // Cancels the running build, if any, and waits for the task to finish.
+  void cancel();
+  // True while a build of exactly this section is running
+  bool isBuilding(int spineIndex, const Layout& layout) const;
+  // Waits until the running build of this section has committed at least `pages` pages, and returns the number
+  // committed so far. Returns -1 once that build has ended, or if this section is not being built; its file is then
+  // either complete or gone.
+  int waitForPages(int spineIndex, const Layout& layout, int pages) const;
+
+ private:
+  static constexpr uint32_t TASK_STACK_SIZE = 8192;
+  static constexpr UBaseType_t TASK_PRIORITY = tskIDLE_PRIORITY;
+  // Free heap needed before a build is started next to the reader (inflate window, expat and layout buffers)
+  static constexpr uint32_t MIN_FREE_HEAP = 80 * 1024;
+  // How often waitForPages() looks at the build's progress
+  static constexpr TickType_t PROGRESS_POLL_TICKS = pdMS_TO_TICKS(10);
+
+  // Given while no task is running, held by the task for the duration of a build
+  SemaphoreHandle_t idleSemaphore = nullptr;
+  std::atomic<bool> cancelRequested{false};
+  // Cleared by the task once its build has ended, just before it gives the semaphore back
+  std::atomic<bool> running{false};
+  // Pages of the running build that are flushed to its file
+  std::atomic<int> committedPages{0};
+
+  // Only touched by the owner while idle, and by the task while it runs
+  std::unique_ptr<Section> section;
+  Layout layout = {};
+
+  // Last requested build, used to skip duplicate requests. Only touched by the owner.
+  int requestedSpineIndex = -1;
+
+  static void taskTrampoline(void* param);
+  void build();
+  void waitUntilIdle();
+};
@@ -71,6 +71,7 @@ void TxtReaderActivity::onExit() {
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
   txt.reset();
+  renderer.clearFontCache();
 }
 
 void TxtReaderActivity::loop() {
@@ -349,7 +350,7 @@ void TxtReaderActivity::render(RenderLock&&) {
 
   renderer.clearScreen();
   renderPage();
-  renderer.clearFontCache();
+  renderer.logFontCacheStats();
 
   // Save progress
   saveProgress();
@@ -23,6 +23,7 @@
 namespace {
 constexpr unsigned long skipPageMs = 700;
 constexpr unsigned long goHomeMs = 1000;
+constexpr size_t pageStreamChunkSize = 4096;
 }  // namespace
 
 void XtcReaderActivity::onEnter() {
@@ -142,11 +143,67 @@ void XtcReaderActivity::render(RenderLock&&) {
   saveProgress();
 }
 
+bool XtcReaderActivity::streamPagePass(const xtc::XtcPanelWriter::Pass pass) const {
+  xtc::XtcPanelWriter writer(renderer.getFrameBuffer(), xtc->getBitDepth(), pass);
+  const xtc::XtcError err = xtc->loadPageStreaming(
+      currentPage, [&writer](const uint8_t* data, size_t size, size_t offset) { writer.write(data, size, offset); },
+      pageStreamChunkSize);
+  if (err != xtc::XtcError::OK || !writer.complete()) {
+    LOG_ERR("XTR", "Failed to stream page %lu: %s", currentPage, xtc::errorToString(err));
+    return false;
+  }
+  return true;
+}
+
+bool XtcReaderActivity::renderPageStreamed() {
+  // The first pass fails without touching the display, so the caller can still fall back to a buffered render
+  if (!streamPagePass(xtc::XtcPanelWriter::Pass::BW)) {
+    return false;
+  }
+
+  if (pagesUntilFullRefresh <= 1) {
+    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
+  } else {
+    renderer.displayBuffer();
+    pagesUntilFullRefresh--;
+  }
+
+  if (xtc->getBitDepth() != 2) {
+    LOG_DBG("XTR", "Rendered page %lu/%lu (1-bit, streamed)", currentPage + 1, xtc->getPageCount());
+    return true;
+  }
+
+  // Same flow as the buffered grayscale render below, each pass streamed from the card into the framebuffer
+  if (streamPagePass(xtc::XtcPanelWriter::Pass::GRAY_LSB)) {
+    renderer.copyGrayscaleLsbBuffers();
+    if (streamPagePass(xtc::XtcPanelWriter::Pass::GRAY_MSB)) {
+      renderer.copyGrayscaleMsbBuffers();
+      renderer.displayGrayBuffer();
+    }
+  }
+
+  // Restore the BW frame for the next refresh
+  if (!streamPagePass(xtc::XtcPanelWriter::Pass::BW)) {
+    renderer.clearScreen();
+  }
+  renderer.cleanupGrayscaleWithFrameBuffer();
+
+  LOG_DBG("XTR", "Rendered page %lu/%lu (2-bit grayscale, streamed)", currentPage + 1, xtc->getPageCount());
+  return true;
+}
+
 void XtcReaderActivity::renderPage() {
   const uint16_t pageWidth = xtc->getPageWidth();
   const uint16_t pageHeight = xtc->getPageHeight();
   const uint8_t bitDepth = xtc->getBitDepth();
 
+  // Full-size pages in portrait are streamed into the framebuffer plane by plane, without a page buffer
+  if (renderer.getOrientation() == GfxRenderer::Portrait && xtc::XtcPanelWriter::supports(pageWidth, pageHeight) &&
+      renderPageStreamed()) {
+    return;
+  }
+
   // Calculate buffer size for one page
   // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
   // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
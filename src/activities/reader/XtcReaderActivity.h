@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Xtc.h>
+#include <Xtc/XtcPanelWriter.h>
 
 #include "activities/Activity.h"
 
@@ -18,6 +19,8 @@ class XtcReaderActivity final : public Activity {
   int pagesUntilFullRefresh = 0;
 
   void renderPage();
+  bool renderPageStreamed();
+  bool streamPagePass(xtc::XtcPanelWriter::Pass pass) const;
   void saveProgress() const;
   void loadProgress();
 
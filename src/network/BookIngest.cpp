@@ -0,0 +1,323 @@
+#include "BookIngest.h"
+
+#include <Arduino.h>
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <Epub/SectionLayoutCache.h>
+#include <Epub/hyphenation/Hyphenator.h>
+#include <Logging.h>
+#include <Txt.h>
+#include <Xtc.h>
+#include <esp_task_wdt.h>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+
+#include "CrossPointSettings.h"
+#include "LibraryCatalog.h"
+#include "activities/reader/EpubReaderActivity.h"
+#include "components/UITheme.h"
+#include "util/MutexGuard.h"
+#include "util/StringUtils.h"
+
+BookIngest BookIngest::instance;
+
+namespace {
+constexpr const char* CACHE_DIR = "/.crosspoint";
+
+bool isEpub(const std::string& path) { return StringUtils::checkFileExtension(path, ".epub"); }
+
+bool isXtc(const std::string& path) {
+  return StringUtils::checkFileExtension(path, ".xtc") || StringUtils::checkFileExtension(path, ".xtch");
+}
+
+bool isTxt(const std::string& path) {
+  return StringUtils::checkFileExtension(path, ".txt") || StringUtils::checkFileExtension(path, ".md");
+}
+}  // namespace
+
+BookIngest::BookIngest() {
+  mutex = xSemaphoreCreateMutex();
+  idleSemaphore = xSemaphoreCreateBinary();
+  assert(mutex != nullptr && idleSemaphore != nullptr);
+  xSemaphoreGive(idleSemaphore);
+}
+
+BookIngest::~BookIngest() {
+  cancelAndWait();
+  vSemaphoreDelete(idleSemaphore);
+  vSemaphoreDelete(mutex);
+}
+
+bool BookIngest::isIngestible(const std::string& path) { return isEpub(path) || isXtc(path) || isTxt(path); }
+
+void BookIngest::enqueue(const std::string& path) {
+  if (!isIngestible(path)) {
+    return;
+  }
+  MutexGuard guard(mutex);
+  if (std::find(queue.begin(), queue.end(), path) != queue.end()) {
+    return;
+  }
+  if (queue.empty() && !running) {
+    done = 0;
+    failed = 0;
+  }
+  queue.push_back(path);
+  lastQueuedAt = millis();
+  LOG_DBG("ING", "Queued %s (%u pending)", path.c_str(), static_cast<unsigned>(queue.size()));
+}
+
+void BookIngest::forget(const std::string& path) {
+  bool isCurrent;
+  {
+    MutexGuard guard(mutex);
+    queue.erase(std::remove(queue.begin(), queue.end(), path), queue.end());
+    isCurrent = running && current == path;
+  }
+  if (isCurrent) {
+    LOG_DBG("ING", "Stopping preparation of %s", path.c_str());
+    cancelAndWait();
+  }
+}
+
+void BookIngest::stop() {
+  {
+    MutexGuard guard(mutex);
+    queue.clear();
+  }
+  cancelAndWait();
+  MutexGuard guard(mutex);
+  done = 0;
+  failed = 0;
+}
+
+bool BookIngest::hasPending() const {
+  MutexGuard guard(mutex);
+  return !queue.empty();
+}
+
+bool BookIngest::startNext(GfxRenderer& renderer, const SectionPrefetcher::Layout& layout) {
+  if (running) {
+    return false;
+  }
+  if (ESP.getFreeHeap() < MIN_FREE_HEAP) {
+    LOG_DBG("ING", "Not enough heap to prepare a book (%u free)", ESP.getFreeHeap());
+    return false;
+  }
+
+  // The task must not see the owner's state change while it runs, so wait for the last one to be gone entirely
+  xSemaphoreTake(idleSemaphore, portMAX_DELAY);
+  {
+    MutexGuard guard(mutex);
+    if (queue.empty()) {
+      xSemaphoreGive(idleSemaphore);
+      return false;
+    }
+    current = queue.front();
+    queue.pop_front();
+  }
+
+  this->renderer = &renderer;
+  this->layout = layout;
+  thumbHeight = UITheme::getInstance().getMetrics().homeCoverHeight;
+  sleepCover = SETTINGS.sleepScreen == CrossPointSettings::SLEEP_SCREEN_MODE::COVER ||
+               SETTINGS.sleepScreen == CrossPointSettings::SLEEP_SCREEN_MODE::COVER_CUSTOM;
+  sleepCoverCropped = SETTINGS.sleepScreenCoverMode == CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP;
+  cachedLayouts = SETTINGS.cachedLayouts;
+  cancelRequested = false;
+  stage = Stage::Metadata;
+  running = true;
+
+  if (xTaskCreate(&taskTrampoline, "BookIngest", TASK_STACK_SIZE, this, TASK_PRIORITY, nullptr) != pdPASS) {
+    LOG_ERR("ING", "Failed to create ingest task");
+    running = false;
+    stage = Stage::Idle;
+    MutexGuard guard(mutex);
+    // Put it back, it is tried again once the heap allows
+    queue.push_front(current);
+    current.clear();
+    xSemaphoreGive(idleSemaphore);
+    return false;
+  }
+  return true;
+}
+
+BookIngest::Status BookIngest::status() const {
+  MutexGuard guard(mutex);
+  Status result;
+  result.running = running;
+  result.stage = stage;
+  result.current = running ? current : std::string();
+  result.pending = static_cast<uint16_t>(queue.size());
+  result.done = done;
+  result.failed = failed;
+  result.lastQueuedAt = lastQueuedAt;
+  return result;
+}
+
+const char* BookIngest::stageName(const Stage stage) {
+  switch (stage) {
+    case Stage::Metadata:
+      return "metadata";
+    case Stage::Thumbnail:
+      return "thumbnail";
+    case Stage::Cover:
+      return "cover";
+    case Stage::Section:
+      return "section";
+    case Stage::Idle:
+      break;
+  }
+  return "idle";
+}
+
+void BookIngest::cancelAndWait() {
+  cancelRequested = true;
+  // A book is only abandoned between SD operations, which can take a while on a slow card
+  while (xSemaphoreTake(idleSemaphore, WAIT_TICKS) != pdTRUE) {
+    esp_task_wdt_reset();
+  }
+  xSemaphoreGive(idleSemaphore);
+}
+
+void BookIngest::taskTrampoline(void* param) {
+  auto* self = static_cast<BookIngest*>(param);
+  // The owner may destroy the ingest as soon as the semaphore is given back, so keep a copy of the handle
+  const SemaphoreHandle_t idle = self->idleSemaphore;
+  self->run();
+  xSemaphoreGive(idle);
+  vTaskDelete(nullptr);
+}
+
+void BookIngest::run() {
+  std::string path;
+  {
+    MutexGuard guard(mutex);
+    path = current;
+  }
+  [[maybe_unused]] const auto start = millis();
+
+  bool ok = false;
+  if (isEpub(path)) {
+    ok = prepareEpub(path);
+  } else if (isXtc(path)) {
+    ok = prepareXtc(path);
+  } else {
+    ok = prepareTxt(path);
+  }
+  // The reader frees the memo when it closes a book; ingest runs next to WiFi, where the heap is worth more than the
+  // hit rate on the next book
+  Hyphenator::releaseMemo();
+
+  if (cancelRequested) {
+    LOG_DBG("ING", "Preparation of %s cancelled", path.c_str());
+  } else if (ok) {
+    LOG_DBG("ING", "Prepared %s in %lu ms", path.c_str(), millis() - start);
+    // Its title, author and thumbnail are known now
+    LIBRARY_CATALOG.fileChanged(path);
+  } else {
+    LOG_ERR("ING", "Failed to prepare %s", path.c_str());
+  }
+
+  MutexGuard guard(mutex);
+  if (!cancelRequested) {
+    done++;
+    if (!ok) {
+      failed++;
+    }
+  }
+  current.clear();
+  stage = Stage::Idle;
+  running = false;
+}
+
+bool BookIngest::prepareEpub(const std::string& path) {
+  const auto epub = std::make_shared<Epub>(path, CACHE_DIR);
+  stage = Stage::Metadata;
+  // Same as the reader: the CSS cache is only needed when embedded styles are used
+  if (!epub->load(true, !layout.embeddedStyle) || cancelRequested) {
+    return false;
+  }
+
+  stage = Stage::Thumbnail;
+  if (thumbHeight > 0 && !epub->generateThumbBmp(thumbHeight)) {
+    LOG_DBG("ING", "No thumbnail for %s", path.c_str());
+  }
+  if (cancelRequested) {
+    return false;
+  }
+
+  if (sleepCover) {
+    stage = Stage::Cover;
+    if (!epub->generateCoverBmp(sleepCoverCropped)) {
+      LOG_DBG("ING", "No cover for %s", path.c_str());
+    }
+    if (cancelRequested) {
+      return false;
+    }
+  }
+
+  if (epub->getSpineItemsCount() == 0) {
+    return true;
+  }
+
+  // The chapter a first open starts at (see EpubReaderActivity::onEnter)
+  stage = Stage::Section;
+  const int spineIndex = epub->getSpineIndexForTextReference();
+  SectionLayoutCache::use(
+      epub->getCachePath(),
+      SectionLayoutCache::fingerprint(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                      layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                      layout.hyphenationEnabled, layout.embeddedStyle),
+      cachedLayouts, EpubReaderActivity::SECTION_CACHE_MAX_BYTES);
+
+  Section section(epub, spineIndex, *renderer);
+  if (section.loadSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                              layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                              layout.hyphenationEnabled, layout.embeddedStyle)) {
+    return true;
+  }
+  return section.createSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                   layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                   layout.hyphenationEnabled, layout.embeddedStyle, nullptr,
+                                   [this] { return cancelRequested.load(); }, nullptr);
+}
+
+bool BookIngest::prepareXtc(const std::string& path) {
+  Xtc xtc(path, CACHE_DIR);
+  stage = Stage::Metadata;
+  if (!xtc.load() || cancelRequested) {
+    return false;
+  }
+
+  stage = Stage::Thumbnail;
+  if (thumbHeight > 0 && !xtc.generateThumbBmp(thumbHeight)) {
+    LOG_DBG("ING", "No thumbnail for %s", path.c_str());
+  }
+  if (sleepCover && !cancelRequested) {
+    stage = Stage::Cover;
+    if (!xtc.generateCoverBmp()) {
+      LOG_DBG("ING", "No cover for %s", path.c_str());
+    }
+  }
+  return !cancelRequested;
+}
+
+bool BookIngest::prepareTxt(const std::string& path) {
+  // The page index depends on the reader's line layout and is built by TxtReaderActivity on first open
+  Txt txt(path, CACHE_DIR);
+  stage = Stage::Metadata;
+  if (!txt.load() || cancelRequested) {
+    return false;
+  }
+
+  if (sleepCover) {
+    stage = Stage::Cover;
+    if (!txt.generateCoverBmp()) {
+      LOG_DBG("ING", "No cover for %s", path.c_str());
+    }
+  }
+  return !cancelRequested;
+}
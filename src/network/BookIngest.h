@@ -0,0 +1,116 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <string>
+
+#include "activities/reader/SectionPrefetcher.h"
+
+class GfxRenderer;
+
+/**
+ * BookIngest
+ *
+ * Prepares uploaded books so that their first open is instant. Uploads only queue their path here; the file transfer
+ * activity starts the work once transfers have gone quiet and the device runs on USB power, one book at a time on a
+ * low-priority task:
+ *  - EPUB: book.bin (spine, TOC) and the CSS cache via Epub::load(), the home screen thumbnail, the sleep screen cover
+ *    if the sleep screen shows covers, and the section file of the chapter a first open starts at, laid out for the
+ *    current reader settings
+ *  - XTC: the header, thumbnail and cover
+ *  - TXT: the cache directory and the cover found next to the file
+ * Every step skips what is already cached, so books that were prepared before cost next to nothing.
+ *
+ * A book that is overwritten, moved or deleted must be forgotten first (forget()), which also stops the work on it
+ * if it is under way. The metadata and image steps cannot be interrupted, so that may take a few seconds.
+ *
+ * The task touches only its own Epub/Xtc/Txt objects and measures text with read-only font data like the
+ * SectionPrefetcher does; it never takes the RenderLock. Its SD access goes through HalStorage's mutex.
+ */
+class BookIngest {
+ public:
+  enum class Stage : uint8_t { Idle, Metadata, Thumbnail, Cover, Section };
+
+  struct Status {
+    bool running = false;
+    Stage stage = Stage::Idle;
+    std::string current;  // Book being prepared
+    uint16_t pending = 0;
+    // Books finished since the queue last ran empty, successfully or not
+    uint16_t done = 0;
+    uint16_t failed = 0;
+    unsigned long lastQueuedAt = 0;  // millis() of the last enqueue()
+  };
+
+  BookIngest();
+  ~BookIngest();
+  BookIngest(const BookIngest&) = delete;
+  BookIngest& operator=(const BookIngest&) = delete;
+
+  static BookIngest& getInstance() { return instance; }
+
+  // True for the formats that are prepared here
+  static bool isIngestible(const std::string& path);
+
+  // Queues an uploaded book, unless it is queued already. Other files are ignored.
+  void enqueue(const std::string& path);
+  // Drops the book from the queue and stops the work on it. Call before its file or cache is changed.
+  void forget(const std::string& path);
+  // Stops the work in progress and empties the queue
+  void stop();
+
+  bool hasPending() const;
+  bool isRunning() const { return running; }
+  // Starts preparing the next queued book for `layout` (see EpubReaderActivity::settingsLayout). Returns false if
+  // nothing is queued, a book is still being prepared or there is not enough heap.
+  bool startNext(GfxRenderer& renderer, const SectionPrefetcher::Layout& layout);
+
+  Status status() const;
+  static const char* stageName(Stage stage);
+
+ private:
+  static constexpr uint32_t TASK_STACK_SIZE = 8192;
+  static constexpr UBaseType_t TASK_PRIORITY = tskIDLE_PRIORITY;
+  // Free heap needed before a book is started next to WiFi and the web server (expat, inflate window, CSS parser)
+  static constexpr uint32_t MIN_FREE_HEAP = 80 * 1024;
+  // How long cancelAndWait() waits for the task before feeding the watchdog and looking again
+  static constexpr TickType_t WAIT_TICKS = pdMS_TO_TICKS(100);
+
+  static BookIngest instance;
+
+  // Guards the queue, `current` and the counters
+  SemaphoreHandle_t mutex = nullptr;
+  // Given while no task is running, held by the task while it prepares a book
+  SemaphoreHandle_t idleSemaphore = nullptr;
+  std::atomic<bool> cancelRequested{false};
+  std::atomic<bool> running{false};
+  std::atomic<Stage> stage{Stage::Idle};
+
+  std::deque<std::string> queue;
+  std::string current;
+  uint16_t done = 0;
+  uint16_t failed = 0;
+  unsigned long lastQueuedAt = 0;
+
+  // Only touched by the owner while idle, and by the task while it runs
+  GfxRenderer* renderer = nullptr;
+  SectionPrefetcher::Layout layout = {};
+  int thumbHeight = 0;
+  bool sleepCover = false;
+  bool sleepCoverCropped = false;
+  uint8_t cachedLayouts = 0;
+
+  static void taskTrampoline(void* param);
+  void run();
+  bool prepareEpub(const std::string& path);
+  bool prepareXtc(const std::string& path);
+  bool prepareTxt(const std::string& path);
+  void cancelAndWait();
+};
+
+#define BOOK_INGEST BookIngest::getInstance()
@@ -9,8 +9,12 @@
 #include <esp_task_wdt.h>
 
 #include <algorithm>
+#include <utility>
 
+#include "BookIngest.h"
 #include "CrossPointSettings.h"
+#include "FileResponse.h"
+#include "LibraryCatalog.h"
 #include "SettingsList.h"
 #include "WebDAVHandler.h"
 #include "html/FilesPageHtml.generated.h"
@@ -30,7 +34,8 @@ constexpr uint16_t LOCAL_UDP_PORT = 8134;
 CrossPointWebServer* wsInstance = nullptr;
 
 // WebSocket upload state
-FsFile wsUploadFile;
+UploadWriter wsUploadWriter;
+ResumableUpload wsResumableUpload;
 String wsUploadFileName;
 String wsUploadPath;
 size_t wsUploadSize = 0;
@@ -41,8 +46,23 @@ String wsLastCompleteName;
 size_t wsLastCompleteSize = 0;
 unsigned long wsLastCompleteAt = 0;
 
-// Helper function to clear epub cache after upload
+// Stops a plain (START) upload that has not finished and deletes the incomplete file
+void abortWsUpload() {
+  if (!wsUploadInProgress || !wsUploadWriter.isOpen()) {
+    return;
+  }
+  wsUploadWriter.abort();
+  String filePath = wsUploadPath;
+  if (!filePath.endsWith("/")) filePath += "/";
+  filePath += wsUploadFileName;
+  Storage.remove(filePath.c_str());
+  LIBRARY_CATALOG.fileRemoved(filePath.c_str());
+  LOG_DBG("WS", "Deleted incomplete upload: %s", filePath.c_str());
+}
+
+// Helper function to clear epub cache after upload. Stops the preparation of the book first, it may be writing there.
 void clearEpubCacheIfNeeded(const String& filePath) {
+  BOOK_INGEST.forget(filePath.c_str());
   // Only clear cache for .epub files
   if (StringUtils::checkFileExtension(filePath, ".epub")) {
     Epub(filePath.c_str(), "/.crosspoint").clearCache();
@@ -160,9 +180,11 @@ void CrossPointWebServer::begin() {
   server->onNotFound([this] { handleNotFound(); });
   LOG_DBG("WEB", "[MEM] Free heap after route setup: %d bytes", ESP.getFreeHeap());
 
-  // Collect WebDAV headers and register handler
-  const char* davHeaders[] = {"Depth", "Destination", "Overwrite", "If", "Lock-Token", "Timeout"};
-  server->collectHeaders(davHeaders, 6);
+  // Collect WebDAV headers, and the conditional and range headers of file downloads (see FileResponse), then
+  // register the WebDAV handler
+  const char* collectedHeaders[] = {"Depth", "Destination", "Overwrite",     "If",           "Lock-Token",
+                                    "Timeout", "Range",       "If-Range",      "If-None-Match", "If-Modified-Since"};
+  server->collectHeaders(collectedHeaders, sizeof(collectedHeaders) / sizeof(collectedHeaders[0]));
   server->addHandler(new WebDAVHandler());  // Note: WebDAVHandler will be deleted by WebServer when server is stopped
   LOG_DBG("WEB", "WebDAV handler initialized");
 
@@ -201,8 +223,9 @@ void CrossPointWebServer::stop() {
   LOG_DBG("WEB", "[MEM] Free heap before stop: %d bytes", ESP.getFreeHeap());
 
   // Close any in-progress WebSocket upload
-  if (wsUploadInProgress && wsUploadFile) {
-    wsUploadFile.close();
+  if (wsUploadInProgress) {
+    abortWsUpload();
+    wsResumableUpload.suspend();  // Kept for resuming once the server is back
     wsUploadInProgress = false;
   }
 
@@ -328,67 +351,67 @@ void CrossPointWebServer::handleStatus() const {
   doc["freeHeap"] = ESP.getFreeHeap();
   doc["uptime"] = millis() / 1000;
 
+  // Current or most recent upload, for tuning the write-behind buffers
+  const UploadWriter::Stats& stats = UploadWriter::stats();
+  const bool uploading = stats.active;
+  const uint32_t elapsed = uploading ? millis() - stats.startedAt : stats.elapsedMs.load();
+  JsonObject uploadJson = doc["upload"].to<JsonObject>();
+  uploadJson["active"] = uploading;
+  uploadJson["bytes"] = stats.bytes.load();
+  uploadJson["elapsedMs"] = elapsed;
+  uploadJson["kbps"] = elapsed > 0 ? stats.bytes / 1.024f / elapsed : 0.0f;
+  uploadJson["writes"] = stats.writes.load();
+  uploadJson["writeMs"] = stats.writeMs.load();
+  uploadJson["stallMs"] = stats.stallMs.load();
+  // SD write latency histogram: writeLatency[i] counts the writes that took at most bucketsMs[i] ms, the last entry
+  // the slower ones
+  JsonArray buckets = uploadJson["bucketsMs"].to<JsonArray>();
+  for (const uint32_t bound : UploadWriter::LATENCY_BUCKET_MS) {
+    buckets.add(bound);
+  }
+  JsonArray latency = uploadJson["writeLatency"].to<JsonArray>();
+  for (const auto& count : stats.latency) {
+    latency.add(count.load());
+  }
+
+  // Preparation of uploaded books for their first open (see BookIngest)
+  const BookIngest::Status ingest = BOOK_INGEST.status();
+  JsonObject ingestJson = doc["ingest"].to<JsonObject>();
+  ingestJson["active"] = ingest.running;
+  ingestJson["current"] = ingest.current;
+  ingestJson["stage"] = BookIngest::stageName(ingest.stage);
+  ingestJson["pending"] = ingest.pending;
+  ingestJson["done"] = ingest.done;
+  ingestJson["failed"] = ingest.failed;
+
   String json;
   serializeJson(doc, json);
   server->send(200, "application/json", json);
 }
 
 void CrossPointWebServer::scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const {
-  FsFile root = Storage.open(path);
-  if (!root) {
-    LOG_DBG("WEB", "Failed to open directory: %s", path);
-    return;
-  }
-
-  if (!root.isDirectory()) {
-    LOG_DBG("WEB", "Not a directory: %s", path);
-    root.close();
-    return;
-  }
-
   LOG_DBG("WEB", "Scanning files in: %s", path);
 
-  FsFile file = root.openNextFile();
-  char name[500];
-  while (file) {
-    file.getName(name, sizeof(name));
-    auto fileName = String(name);
-
-    // Skip hidden items (starting with ".")
-    bool shouldHide = fileName.startsWith(".");
-
-    // Check against explicitly hidden items list
-    if (!shouldHide) {
-      for (size_t i = 0; i < HIDDEN_ITEMS_COUNT; i++) {
-        if (fileName.equals(HIDDEN_ITEMS[i])) {
-          shouldHide = true;
-          break;
-        }
-      }
-    }
-
-    if (!shouldHide) {
-      FileInfo info;
-      info.name = fileName;
-      info.isDirectory = file.isDirectory();
-
-      if (info.isDirectory) {
-        info.size = 0;
-        info.isEpub = false;
-      } else {
-        info.size = file.size();
-        info.isEpub = isEpubFile(info.name);
-      }
-
-      callback(info);
+  // The catalog walks the folder only if it changed since it was last listed, see LibraryCatalog
+  const bool found = LIBRARY_CATALOG.forEach(path, [&callback](const LibraryCatalog::Entry& entry) {
+    FileInfo info;
+    info.isDirectory = entry.type == LibraryCatalog::Type::Directory;
+    info.name = String(entry.name.c_str());
+    if (info.isDirectory) {
+      info.name.remove(info.name.length() - 1);
     }
-
-    file.close();
-    yield();               // Yield to allow WiFi and other tasks to process during long scans
-    esp_task_wdt_reset();  // Reset watchdog to prevent timeout on large directories
-    file = root.openNextFile();
+    info.size = entry.size;
+    info.isEpub = entry.type == LibraryCatalog::Type::Epub;
+    info.title = String(entry.title.c_str());
+    info.author = String(entry.author.c_str());
+    info.modified = entry.modified;
+
+    callback(info);
+    yield();  // Yield to allow WiFi and other tasks to process during long listings
+  });
+  if (!found) {
+    LOG_DBG("WEB", "Failed to list directory: %s", path);
   }
-  root.close();
 }
 
 bool CrossPointWebServer::isEpubFile(const String& filename) const {
@@ -430,8 +453,24 @@ void CrossPointWebServer::handleFileListData() const {
     doc["size"] = info.size;
     doc["isDirectory"] = info.isDirectory;
     doc["isEpub"] = info.isEpub;
+    if (!info.title.isEmpty()) {
+      doc["title"] = info.title;
+    }
+    if (!info.author.isEmpty()) {
+      doc["author"] = info.author;
+    }
+    const String modified = FileResponse::lastModified(info.modified >> 16, info.modified & 0xFFFF);
+    if (!modified.isEmpty()) {
+      doc["modified"] = modified;
+    }
 
-    const size_t written = serializeJson(doc, output, outputSize);
+    size_t written = serializeJson(doc, output, outputSize);
+    if (written >= outputSize) {
+      // Drop the book details before the entry itself
+      doc.remove("title");
+      doc.remove("author");
+      written = serializeJson(doc, output, outputSize);
+    }
     if (written >= outputSize) {
       // JSON output truncated; skip this entry to avoid sending malformed JSON
       LOG_DBG("WEB", "Skipping file entry with oversized JSON for name: %s", info.name.c_str());
@@ -505,39 +544,11 @@ void CrossPointWebServer::handleDownload() const {
     filename = nameBuf;
   }
 
-  server->setContentLength(file.size());
   server->sendHeader("Content-Disposition", "attachment; filename=\"" + filename + "\"");
-  server->send(200, contentType.c_str(), "");
-
-  NetworkClient client = server->client();
-  client.write(file);
+  FileResponse::send(*server, file, contentType);
   file.close();
 }
 
-// Diagnostic counters for upload performance analysis
-static unsigned long uploadStartTime = 0;
-static unsigned long totalWriteTime = 0;
-static size_t writeCount = 0;
-
-static bool flushUploadBuffer(CrossPointWebServer::UploadState& state) {
-  if (state.bufferPos > 0 && state.file) {
-    esp_task_wdt_reset();  // Reset watchdog before potentially slow SD write
-    const unsigned long writeStart = millis();
-    const size_t written = state.file.write(state.buffer.data(), state.bufferPos);
-    totalWriteTime += millis() - writeStart;
-    writeCount++;
-    esp_task_wdt_reset();  // Reset watchdog after SD write
-
-    if (written != state.bufferPos) {
-      LOG_DBG("WEB", "[UPLOAD] Buffer flush failed: expected %d, wrote %d", state.bufferPos, written);
-      state.bufferPos = 0;
-      return false;
-    }
-    state.bufferPos = 0;
-  }
-  return true;
-}
-
 void CrossPointWebServer::handleUpload(UploadState& state) const {
   static size_t lastLoggedSize = 0;
 
@@ -560,11 +571,7 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
     state.size = 0;
     state.success = false;
     state.error = "";
-    uploadStartTime = millis();
     lastLoggedSize = 0;
-    state.bufferPos = 0;
-    totalWriteTime = 0;
-    writeCount = 0;
 
     // Get upload path from query parameter (defaults to root if not specified)
     // Note: We use query parameter instead of form data because multipart form
@@ -591,90 +598,82 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
     if (!filePath.endsWith("/")) filePath += "/";
     filePath += state.fileName;
 
+    // A book being replaced must not be read by its preparation meanwhile
+    BOOK_INGEST.forget(filePath.c_str());
+
     // Check if file already exists - SD operations can be slow
     esp_task_wdt_reset();
     if (Storage.exists(filePath.c_str())) {
       LOG_DBG("WEB", "[UPLOAD] Overwriting existing file: %s", filePath.c_str());
       esp_task_wdt_reset();
       Storage.remove(filePath.c_str());
+      LIBRARY_CATALOG.fileRemoved(filePath.c_str());
     }
 
     // Open file for writing - this can be slow due to FAT cluster allocation
     esp_task_wdt_reset();
-    if (!Storage.openFileForWrite("WEB", filePath, state.file)) {
+    FsFile file;
+    if (!Storage.openFileForWrite("WEB", filePath, file)) {
       state.error = "Failed to create file on SD card";
       LOG_DBG("WEB", "[UPLOAD] FAILED to create file: %s", filePath.c_str());
       return;
     }
+    state.writer.begin(std::move(file));
     esp_task_wdt_reset();
 
     LOG_DBG("WEB", "[UPLOAD] File created successfully: %s", filePath.c_str());
   } else if (upload.status == UPLOAD_FILE_WRITE) {
-    if (state.file && state.error.isEmpty()) {
-      // Buffer incoming data and flush when buffer is full
-      // This reduces SD card write operations and improves throughput
-      const uint8_t* data = upload.buf;
-      size_t remaining = upload.currentSize;
-
-      while (remaining > 0) {
-        const size_t space = UploadState::UPLOAD_BUFFER_SIZE - state.bufferPos;
-        const size_t toCopy = (remaining < space) ? remaining : space;
-
-        memcpy(state.buffer.data() + state.bufferPos, data, toCopy);
-        state.bufferPos += toCopy;
-        data += toCopy;
-        remaining -= toCopy;
-
-        // Flush buffer when full
-        if (state.bufferPos >= UploadState::UPLOAD_BUFFER_SIZE) {
-          if (!flushUploadBuffer(state)) {
-            state.error = "Failed to write to SD card - disk may be full";
-            state.file.close();
-            return;
-          }
-        }
+    if (state.writer.isOpen() && state.error.isEmpty()) {
+      // Blocks while both buffers wait for the SD card, which holds back the client
+      if (!state.writer.write(upload.buf, upload.currentSize)) {
+        state.error = "Failed to write to SD card - disk may be full";
+        state.writer.abort();
+        return;
       }
 
       state.size += upload.currentSize;
 
       // Log progress every 100KB
       if (state.size - lastLoggedSize >= 102400) {
-        const unsigned long elapsed = millis() - uploadStartTime;
+        const UploadWriter::Stats& stats = UploadWriter::stats();
+        const unsigned long elapsed = millis() - stats.startedAt;
         const float kbps = (elapsed > 0) ? (state.size / 1024.0) / (elapsed / 1000.0) : 0;
-        LOG_DBG("WEB", "[UPLOAD] %d bytes (%.1f KB), %.1f KB/s, %d writes", state.size, state.size / 1024.0, kbps,
-                writeCount);
+        LOG_DBG("WEB", "[UPLOAD] %d bytes (%.1f KB), %.1f KB/s, %u writes", state.size, state.size / 1024.0, kbps,
+                static_cast<unsigned>(stats.writes));
         lastLoggedSize = state.size;
       }
     }
   } else if (upload.status == UPLOAD_FILE_END) {
-    if (state.file) {
-      // Flush any remaining buffered data
-      if (!flushUploadBuffer(state)) {
+    if (state.writer.isOpen()) {
+      // Write the remaining buffered data and wait for the storage task
+      if (!state.writer.finish()) {
         state.error = "Failed to write final data to SD card";
       }
-      state.file.close();
 
       if (state.error.isEmpty()) {
         state.success = true;
-        const unsigned long elapsed = millis() - uploadStartTime;
+        const UploadWriter::Stats& stats = UploadWriter::stats();
+        const unsigned long elapsed = stats.elapsedMs;
         const float avgKbps = (elapsed > 0) ? (state.size / 1024.0) / (elapsed / 1000.0) : 0;
-        const float writePercent = (elapsed > 0) ? (totalWriteTime * 100.0 / elapsed) : 0;
+        const float writePercent = (elapsed > 0) ? (stats.writeMs * 100.0 / elapsed) : 0;
         LOG_DBG("WEB", "[UPLOAD] Complete: %s (%d bytes in %lu ms, avg %.1f KB/s)", state.fileName.c_str(), state.size,
                 elapsed, avgKbps);
-        LOG_DBG("WEB", "[UPLOAD] Diagnostics: %d writes, total write time: %lu ms (%.1f%%)", writeCount, totalWriteTime,
-                writePercent);
+        LOG_DBG("WEB", "[UPLOAD] Diagnostics: %u writes, write time: %u ms (%.1f%%), stalled: %u ms",
+                static_cast<unsigned>(stats.writes), static_cast<unsigned>(stats.writeMs), writePercent,
+                static_cast<unsigned>(stats.stallMs));
 
         // Clear epub cache to prevent stale metadata issues when overwriting files
         String filePath = state.path;
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += state.fileName;
         clearEpubCacheIfNeeded(filePath);
+        LIBRARY_CATALOG.fileChanged(filePath.c_str());
+        BOOK_INGEST.enqueue(filePath.c_str());
       }
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
-    state.bufferPos = 0;  // Discard buffered data
-    if (state.file) {
-      state.file.close();
+    if (state.writer.isOpen()) {
+      state.writer.abort();  // Discards buffered data
       // Try to delete the incomplete file
       String filePath = state.path;
       if (!filePath.endsWith("/")) filePath += "/";
@@ -738,6 +737,7 @@ void CrossPointWebServer::handleCreateFolder() const {
   // Create the folder
   if (Storage.mkdir(folderPath.c_str())) {
     LOG_DBG("WEB", "Folder created successfully: %s", folderPath.c_str());
+    LIBRARY_CATALOG.fileChanged(folderPath.c_str());
     server->send(200, "text/plain", "Folder created: " + folderName);
   } else {
     LOG_DBG("WEB", "Failed to create folder: %s", folderPath.c_str());
@@ -820,6 +820,8 @@ void CrossPointWebServer::handleRename() const {
 
   if (success) {
     LOG_DBG("WEB", "Renamed file: %s -> %s", itemPath.c_str(), newPath.c_str());
+    LIBRARY_CATALOG.fileRenamed(itemPath.c_str(), newPath.c_str());
+    BOOK_INGEST.enqueue(newPath.c_str());
     server->send(200, "text/plain", "Renamed successfully");
   } else {
     LOG_ERR("WEB", "Failed to rename file: %s -> %s", itemPath.c_str(), newPath.c_str());
@@ -913,6 +915,8 @@ void CrossPointWebServer::handleMove() const {
 
   if (success) {
     LOG_DBG("WEB", "Moved file: %s -> %s", itemPath.c_str(), newPath.c_str());
+    LIBRARY_CATALOG.fileRenamed(itemPath.c_str(), newPath.c_str());
+    BOOK_INGEST.enqueue(newPath.c_str());
     server->send(200, "text/plain", "Moved successfully");
   } else {
     LOG_ERR("WEB", "Failed to move file: %s -> %s", itemPath.c_str(), newPath.c_str());
@@ -1010,11 +1014,13 @@ void CrossPointWebServer::handleDelete() const {
     } else {
       // It's a file (or couldn't open as dir) — remove file
       if (f) f.close();
-      success = Storage.remove(itemPath.c_str());
       clearEpubCacheIfNeeded(itemPath);
+      success = Storage.remove(itemPath.c_str());
     }
 
-    if (!success) {
+    if (success) {
+      LIBRARY_CATALOG.fileRemoved(itemPath.c_str());
+    } else {
       failedItems += itemPath + " (deletion failed); ";
       allSuccess = false;
     }
@@ -1203,20 +1209,20 @@ void CrossPointWebServer::wsEventCallback(uint8_t num, WStype_t type, uint8_t* p
 //   2. Client sends BINARY messages with file data chunks
 //   3. Server sends TEXT "PROGRESS:<received>:<total>" after each chunk
 //   4. Server sends TEXT "DONE" or "ERROR:<message>" when complete
+// Resumable protocol (see ResumableUpload):
+//   1. Client sends TEXT "BEGIN:<session>:<filename>:<size>:<path>", server answers "OFFSET:<n>" to continue from
+//   2. Client sends BINARY chunks "<u32 offset><u32 crc32><data>", several ahead of the acknowledged offset
+//   3. Server sends TEXT "ACK:<n>" for every chunk written, or "NAK:<n>" to resend from n
+//   4. Server sends TEXT "DONE" once the file is in place, or "ERROR:<message>"
+//   After a dropped connection the client sends BEGIN with the same session again and continues at the OFFSET.
 void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
   switch (type) {
     case WStype_DISCONNECTED:
       LOG_DBG("WS", "Client %u disconnected", num);
       // Clean up any in-progress upload
-      if (wsUploadInProgress && wsUploadFile) {
-        wsUploadFile.close();
-        // Delete incomplete file
-        String filePath = wsUploadPath;
-        if (!filePath.endsWith("/")) filePath += "/";
-        filePath += wsUploadFileName;
-        Storage.remove(filePath.c_str());
-        LOG_DBG("WS", "Deleted incomplete upload: %s", filePath.c_str());
-      }
+      abortWsUpload();
+      // A resumable upload keeps what arrived, the client continues from there when it reconnects
+      wsResumableUpload.suspend();
       wsUploadInProgress = false;
       break;
 
@@ -1236,6 +1242,8 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         int secondColon = msg.indexOf(':', firstColon + 1);
 
         if (firstColon > 0 && secondColon > 0) {
+          abortWsUpload();
+          wsResumableUpload.suspend();
           wsUploadFileName = msg.substring(6, firstColon);
           wsUploadSize = msg.substring(firstColon + 1, secondColon).toInt();
           wsUploadPath = msg.substring(secondColon + 1);
@@ -1257,18 +1265,22 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
                   filePath.c_str());
 
           // Check if file exists and remove it
+          BOOK_INGEST.forget(filePath.c_str());
           esp_task_wdt_reset();
           if (Storage.exists(filePath.c_str())) {
             Storage.remove(filePath.c_str());
+            LIBRARY_CATALOG.fileRemoved(filePath.c_str());
           }
 
           // Open file for writing
           esp_task_wdt_reset();
-          if (!Storage.openFileForWrite("WS", filePath, wsUploadFile)) {
+          FsFile file;
+          if (!Storage.openFileForWrite("WS", filePath, file)) {
             wsServer->sendTXT(num, "ERROR:Failed to create file");
             wsUploadInProgress = false;
             return;
           }
+          wsUploadWriter.begin(std::move(file));
           esp_task_wdt_reset();
 
           wsUploadInProgress = true;
@@ -1276,29 +1288,33 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         } else {
           wsServer->sendTXT(num, "ERROR:Invalid START format");
         }
+      } else if (msg.startsWith("BEGIN:")) {
+        beginResumableUpload(num, msg);
       }
       break;
     }
 
     case WStype_BIN: {
-      if (!wsUploadInProgress || !wsUploadFile) {
+      if (wsResumableUpload.isOpen()) {
+        receiveResumableChunk(num, payload, length);
+        return;
+      }
+      if (!wsUploadInProgress || !wsUploadWriter.isOpen()) {
         wsServer->sendTXT(num, "ERROR:No upload in progress");
         return;
       }
 
-      // Write binary data directly to file
-      esp_task_wdt_reset();
-      size_t written = wsUploadFile.write(payload, length);
+      // Hand the data to the storage task. This blocks while both buffers wait for the SD card, and the client's
+      // bufferedAmount then grows until it pauses sending.
       esp_task_wdt_reset();
-
-      if (written != length) {
-        wsUploadFile.close();
+      if (!wsUploadWriter.write(payload, length)) {
+        abortWsUpload();
         wsUploadInProgress = false;
         wsServer->sendTXT(num, "ERROR:Write failed - disk full?");
         return;
       }
 
-      wsUploadReceived += written;
+      wsUploadReceived += length;
 
       // Send progress update (every 64KB or at end)
       static size_t lastProgressSent = 0;
@@ -1310,8 +1326,13 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
 
       // Check if upload complete
       if (wsUploadReceived >= wsUploadSize) {
-        wsUploadFile.close();
+        const bool written = wsUploadWriter.finish();
         wsUploadInProgress = false;
+        if (!written) {
+          wsServer->sendTXT(num, "ERROR:Write failed - disk full?");
+          lastProgressSent = 0;
+          return;
+        }
 
         wsLastCompleteName = wsUploadFileName;
         wsLastCompleteSize = wsUploadSize;
@@ -1328,6 +1349,8 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += wsUploadFileName;
         clearEpubCacheIfNeeded(filePath);
+        LIBRARY_CATALOG.fileChanged(filePath.c_str());
+        BOOK_INGEST.enqueue(filePath.c_str());
 
         wsServer->sendTXT(num, "DONE");
         lastProgressSent = 0;
@@ -1339,3 +1362,99 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
       break;
   }
 }
+
+void CrossPointWebServer::beginResumableUpload(const uint8_t num, const String& msg) {
+  // Parse: BEGIN:<session>:<filename>:<size>:<path>
+  const int sessionEnd = msg.indexOf(':', 6);
+  const int nameEnd = sessionEnd > 0 ? msg.indexOf(':', sessionEnd + 1) : -1;
+  const int sizeEnd = nameEnd > 0 ? msg.indexOf(':', nameEnd + 1) : -1;
+  if (sizeEnd < 0) {
+    wsServer->sendTXT(num, "ERROR:Invalid BEGIN format");
+    return;
+  }
+
+  abortWsUpload();  // A plain upload that never finished
+  const String session = msg.substring(6, sessionEnd);
+  wsUploadFileName = msg.substring(sessionEnd + 1, nameEnd);
+  wsUploadSize = msg.substring(nameEnd + 1, sizeEnd).toInt();
+  wsUploadPath = msg.substring(sizeEnd + 1);
+  if (!wsUploadPath.startsWith("/")) wsUploadPath = "/" + wsUploadPath;
+  if (wsUploadPath.length() > 1 && wsUploadPath.endsWith("/")) {
+    wsUploadPath = wsUploadPath.substring(0, wsUploadPath.length() - 1);
+  }
+  String filePath = wsUploadPath;
+  if (!filePath.endsWith("/")) filePath += "/";
+  filePath += wsUploadFileName;
+
+  // The part file replaces the book once complete, so its preparation has to stop before then
+  BOOK_INGEST.forget(filePath.c_str());
+  esp_task_wdt_reset();
+  if (!wsResumableUpload.begin(session.c_str(), wsUploadSize, filePath.c_str())) {
+    String reply = "ERROR:" + String(wsResumableUpload.error().c_str());
+    wsServer->sendTXT(num, reply);
+    return;
+  }
+  esp_task_wdt_reset();
+
+  wsUploadReceived = wsResumableUpload.offset();
+  wsUploadStartTime = millis();
+  wsUploadInProgress = true;
+  String reply = "OFFSET:" + String(wsUploadReceived);
+  wsServer->sendTXT(num, reply);
+
+  // Everything arrived before the connection dropped, only the rename is left
+  if (wsResumableUpload.isComplete()) {
+    if (wsResumableUpload.complete() == ResumableUpload::Result::Done) {
+      finishResumableUpload(num);
+      return;
+    }
+    wsUploadInProgress = false;
+    reply = "ERROR:" + String(wsResumableUpload.error().c_str());
+    wsServer->sendTXT(num, reply);
+  }
+}
+
+void CrossPointWebServer::receiveResumableChunk(const uint8_t num, const uint8_t* payload, const size_t length) {
+  esp_task_wdt_reset();
+  String reply;
+  switch (wsResumableUpload.receive(payload, length)) {
+    case ResumableUpload::Result::Ack:
+      wsUploadReceived = wsResumableUpload.offset();
+      reply = "ACK:" + String(wsUploadReceived);
+      break;
+    case ResumableUpload::Result::Nak:
+      reply = "NAK:" + String(wsResumableUpload.offset());
+      break;
+    case ResumableUpload::Result::Ignored:
+      return;
+    case ResumableUpload::Result::Done:
+      finishResumableUpload(num);
+      return;
+    case ResumableUpload::Result::Failed:
+      wsUploadInProgress = false;
+      reply = "ERROR:" + String(wsResumableUpload.error().c_str());
+      break;
+  }
+  wsServer->sendTXT(num, reply);
+}
+
+void CrossPointWebServer::finishResumableUpload(const uint8_t num) {
+  wsUploadInProgress = false;
+  wsUploadReceived = wsUploadSize;
+  wsLastCompleteName = wsUploadFileName;
+  wsLastCompleteSize = wsUploadSize;
+  wsLastCompleteAt = millis();
+
+  const unsigned long elapsed = millis() - wsUploadStartTime;
+  LOG_DBG("WS", "Resumable upload complete: %s (%d bytes, last connection %lu ms)", wsUploadFileName.c_str(),
+          wsUploadSize, elapsed);
+
+  // Clear epub cache to prevent stale metadata issues when overwriting files
+  clearEpubCacheIfNeeded(String(wsResumableUpload.targetPath().c_str()));
+  LIBRARY_CATALOG.fileChanged(wsResumableUpload.targetPath());
+  BOOK_INGEST.enqueue(wsResumableUpload.targetPath());
+
+  String reply = "ACK:" + String(wsUploadSize);
+  wsServer->sendTXT(num, reply);
+  wsServer->sendTXT(num, "DONE");
+}
@@ -9,12 +9,19 @@
 #include <string>
 #include <vector>
 
+#include "ResumableUpload.h"
+#include "UploadWriter.h"
+
 // Structure to hold file information
 struct FileInfo {
   String name;
   size_t size;
   bool isEpub;
   bool isDirectory;
+  // From the book's metadata cache, empty until the book was opened or prepared
+  String title;
+  String author;
+  uint32_t modified;  // FAT date << 16 | FAT time, 0 if the file has none
 };
 
 class CrossPointWebServer {
@@ -31,21 +38,13 @@ class CrossPointWebServer {
 
   // Used by POST upload handler
   struct UploadState {
-    FsFile file;
+    // Batches the received data into large SD card writes, done on a storage task while the next part arrives
+    UploadWriter writer;
     String fileName;
     String path = "/";
     size_t size = 0;
     bool success = false;
     String error = "";
-
-    // Upload write buffer - batches small writes into larger SD card operations
-    // 4KB is a good balance: large enough to reduce syscall overhead, small enough
-    // to keep individual write times short and avoid watchdog issues
-    static constexpr size_t UPLOAD_BUFFER_SIZE = 4096;  // 4KB buffer
-    std::vector<uint8_t> buffer;
-    size_t bufferPos = 0;
-
-    UploadState() { buffer.resize(UPLOAD_BUFFER_SIZE); }
   } upload;
 
   CrossPointWebServer();
@@ -81,6 +80,9 @@ class CrossPointWebServer {
   // WebSocket upload state
   void onWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
   static void wsEventCallback(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+  void beginResumableUpload(uint8_t num, const String& msg);
+  void receiveResumableChunk(uint8_t num, const uint8_t* payload, size_t length);
+  void finishResumableUpload(uint8_t num);
 
   // File scanning
   void scanFiles(const char* path, const std::function<void(FileInfo)>& callback) const;
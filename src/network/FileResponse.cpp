@@ -0,0 +1,335 @@
+#include "FileResponse.h"
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include <esp_task_wdt.h>
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace {
+const char* const WEEKDAYS[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+const char* const MONTHS[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+// What SdFat stamps files with when no clock is set: 2000-01-01 00:00:00
+constexpr uint16_t FAT_DEFAULT_DATE = (2000 - 1980) << 9 | 1 << 5 | 1;
+constexpr uint16_t FAT_DEFAULT_TIME = 0;
+
+// Days since 1970-01-01 of a civil date
+int64_t daysFromCivil(int year, const unsigned month, const unsigned day) {
+  year -= month <= 2;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+  const unsigned dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return static_cast<int64_t>(era) * 146097 + dayOfEra - 719468;
+}
+
+struct FatTime {
+  uint16_t date = 0;
+  uint16_t time = 0;
+  bool valid = false;  // A real timestamp, not SdFat's default
+};
+
+bool isRealTime(const uint16_t date, const uint16_t time) {
+  return date != 0 && !(date == FAT_DEFAULT_DATE && time == FAT_DEFAULT_TIME);
+}
+
+FatTime modifyTime(FsFile& file) {
+  FatTime result;
+  if (file.getModifyDateTime(&result.date, &result.time)) {
+    result.valid = isRealTime(result.date, result.time);
+  }
+  return result;
+}
+
+int64_t fatToEpoch(const uint16_t date, const uint16_t time) {
+  const int64_t days = daysFromCivil(1980 + (date >> 9), (date >> 5) & 0x0F, date & 0x1F);
+  return days * 86400 + (time >> 11) * 3600 + ((time >> 5) & 0x3F) * 60 + (time & 0x1F) * 2;
+}
+
+bool parseSize(const char*& p, size_t& value) {
+  if (!isdigit(static_cast<unsigned char>(*p))) {
+    return false;
+  }
+  char* end = nullptr;
+  const unsigned long long parsed = strtoull(p, &end, 10);
+  value = static_cast<size_t>(parsed);
+  p = end;
+  return parsed == value;
+}
+
+void skipSpaces(const char*& p) {
+  while (*p == ' ' || *p == '\t') p++;
+}
+
+// If-None-Match: a list of entity tags or "*", compared weakly
+bool etagListMatches(const String& header, const String& tag) {
+  const char* p = header.c_str();
+  while (*p) {
+    skipSpaces(p);
+    if (*p == '*') {
+      return true;
+    }
+    if (strncmp(p, "W/", 2) == 0) {
+      p += 2;
+    }
+    const char* start = p;
+    while (*p && *p != ',') p++;
+    const char* end = p;
+    while (end > start && (end[-1] == ' ' || end[-1] == '\t')) end--;
+    if (static_cast<size_t>(end - start) == tag.length() && strncmp(start, tag.c_str(), tag.length()) == 0) {
+      return true;
+    }
+    if (*p == ',') p++;
+  }
+  return false;
+}
+
+bool isWeak(const String& tag) { return strncmp(tag.c_str(), "W/", 2) == 0; }
+
+bool isNotModified(WebServer& server, const String& tag, const FatTime& modified) {
+  // A weak tag cannot tell a rewritten file of the same size from the old one, so it never earns a 304
+  if (server.hasHeader("If-None-Match") && !isWeak(tag)) {
+    return etagListMatches(server.header("If-None-Match"), tag);
+  }
+  if (server.hasHeader("If-Modified-Since") && modified.valid) {
+    const int64_t since = FileResponse::parseHttpDate(server.header("If-Modified-Since").c_str());
+    return since >= 0 && fatToEpoch(modified.date, modified.time) <= since;
+  }
+  return false;
+}
+
+// If-Range holds either an entity tag, compared strongly, or the Last-Modified date, compared exactly. Weak tags
+// never match.
+bool rangeStillApplies(WebServer& server, const String& tag, const String& modified) {
+  if (!server.hasHeader("If-Range")) {
+    return true;
+  }
+  const String ifRange = server.header("If-Range");
+  if (ifRange.c_str()[0] == '"' || isWeak(ifRange)) {
+    return !isWeak(tag) && ifRange == tag;
+  }
+  return !modified.isEmpty() && ifRange == modified;
+}
+
+String contentRange(const FileResponse::Range& range, const size_t size) {
+  char value[48];
+  snprintf(value, sizeof(value), "bytes %u-%u/%u", static_cast<unsigned>(range.first),
+           static_cast<unsigned>(range.last), static_cast<unsigned>(size));
+  return String(value);
+}
+
+// Streams [first, first + length) of the file. Stops early if the client goes away.
+void streamRange(NetworkClient& client, FsFile& file, const size_t first, size_t length) {
+  size_t chunkSize = FileResponse::STREAM_CHUNK_SIZE;
+  std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[chunkSize]);
+  if (!buffer) {
+    chunkSize = 1024;
+    buffer.reset(new (std::nothrow) uint8_t[chunkSize]);
+    if (!buffer) {
+      return;
+    }
+  }
+
+  if (!file.seekSet(first)) {
+    return;
+  }
+  while (length > 0) {
+    const int read = file.read(buffer.get(), length < chunkSize ? length : chunkSize);
+    if (read <= 0) {
+      return;
+    }
+    if (client.write(buffer.get(), read) != static_cast<size_t>(read)) {
+      return;
+    }
+    length -= read;
+    esp_task_wdt_reset();
+  }
+}
+}  // namespace
+
+void FileResponse::send(WebServer& server, FsFile& file, const String& contentType, const bool sendBody) {
+  const size_t size = file.size();
+  const FatTime modified = modifyTime(file);
+  const String tag = etag(file);
+  const String modifiedDate = modified.valid ? httpDate(modified.date, modified.time) : String("");
+
+  server.sendHeader("Accept-Ranges", "bytes");
+  server.sendHeader("ETag", tag);
+  if (!modifiedDate.isEmpty()) {
+    server.sendHeader("Last-Modified", modifiedDate);
+  }
+
+  if (isNotModified(server, tag, modified)) {
+    server.send(304);
+    return;
+  }
+
+  std::vector<Range> ranges;
+  RangeRequest request = RangeRequest::Whole;
+  if (server.hasHeader("Range") && rangeStillApplies(server, tag, modifiedDate)) {
+    request = parseRanges(server.header("Range").c_str(), size, ranges);
+  }
+
+  NetworkClient client = server.client();
+  switch (request) {
+    case RangeRequest::Whole:
+      server.setContentLength(size);
+      server.send(200, contentType.c_str(), "");
+      if (sendBody) {
+        streamRange(client, file, 0, size);
+      }
+      return;
+
+    case RangeRequest::Unsatisfiable: {
+      char value[24];
+      snprintf(value, sizeof(value), "bytes */%u", static_cast<unsigned>(size));
+      server.sendHeader("Content-Range", value);
+      server.send(416, "text/plain", "Range Not Satisfiable");
+      return;
+    }
+
+    case RangeRequest::Partial:
+      break;
+  }
+
+  if (ranges.size() == 1) {
+    const Range& range = ranges.front();
+    server.sendHeader("Content-Range", contentRange(range, size));
+    server.setContentLength(range.last - range.first + 1);
+    server.send(206, contentType.c_str(), "");
+    if (sendBody) {
+      streamRange(client, file, range.first, range.last - range.first + 1);
+    }
+    return;
+  }
+
+  // multipart/byteranges: every part has its own headers, the length of the whole body is known up front
+  char boundary[24];
+  snprintf(boundary, sizeof(boundary), "CROSSPOINT%08lX", static_cast<unsigned long>(millis() ^ size));
+  const String partHeaderStart = String("\r\n--") + boundary + "\r\nContent-Type: " + contentType +
+                                 "\r\nContent-Range: ";
+  const String closing = String("\r\n--") + boundary + "--\r\n";
+  size_t bodyLength = closing.length();
+  for (const Range& range : ranges) {
+    bodyLength += partHeaderStart.length() + contentRange(range, size).length() + 4 + range.last - range.first + 1;
+  }
+
+  server.setContentLength(bodyLength);
+  server.send(206, (String("multipart/byteranges; boundary=") + boundary).c_str(), "");
+  if (!sendBody) {
+    return;
+  }
+  for (const Range& range : ranges) {
+    const String partHeader = partHeaderStart + contentRange(range, size) + "\r\n\r\n";
+    client.write(reinterpret_cast<const uint8_t*>(partHeader.c_str()), partHeader.length());
+    streamRange(client, file, range.first, range.last - range.first + 1);
+  }
+  client.write(reinterpret_cast<const uint8_t*>(closing.c_str()), closing.length());
+}
+
+String FileResponse::etag(FsFile& file) {
+  const FatTime modified = modifyTime(file);
+  char tag[42];
+  snprintf(tag, sizeof(tag), "%s\"%x-%04x%04x-%x\"", modified.valid ? "" : "W/", static_cast<unsigned>(file.size()),
+           modified.date, modified.time, static_cast<unsigned>(file.firstSector()));
+  return String(tag);
+}
+
+String FileResponse::lastModified(FsFile& file) {
+  const FatTime modified = modifyTime(file);
+  return modified.valid ? httpDate(modified.date, modified.time) : String("");
+}
+
+String FileResponse::lastModified(const uint16_t fatDate, const uint16_t fatTime) {
+  return isRealTime(fatDate, fatTime) ? httpDate(fatDate, fatTime) : String("");
+}
+
+FileResponse::RangeRequest FileResponse::parseRanges(const char* header, const size_t size,
+                                                     std::vector<Range>& ranges) {
+  ranges.clear();
+  const char* p = header;
+  skipSpaces(p);
+  if (strncmp(p, "bytes=", 6) != 0) {
+    return RangeRequest::Whole;
+  }
+  p += 6;
+
+  size_t specs = 0;
+  while (true) {
+    skipSpaces(p);
+    size_t first = 0;
+    size_t last = 0;
+    if (*p == '-') {
+      // Suffix range: the last N bytes
+      p++;
+      size_t suffix = 0;
+      if (!parseSize(p, suffix)) {
+        return RangeRequest::Whole;
+      }
+      if (suffix > 0 && size > 0) {
+        first = suffix >= size ? 0 : size - suffix;
+        ranges.push_back({first, size - 1});
+      }
+    } else {
+      if (!parseSize(p, first) || *p != '-') {
+        return RangeRequest::Whole;
+      }
+      p++;
+      const bool open = !isdigit(static_cast<unsigned char>(*p));
+      if (!open && (!parseSize(p, last) || last < first)) {
+        return RangeRequest::Whole;
+      }
+      if (first < size) {
+        ranges.push_back({first, open || last >= size ? size - 1 : last});
+      }
+    }
+    if (++specs > MAX_RANGES) {
+      return RangeRequest::Whole;
+    }
+
+    skipSpaces(p);
+    if (*p == '\0') {
+      break;
+    }
+    if (*p != ',') {
+      return RangeRequest::Whole;
+    }
+    p++;
+  }
+  return ranges.empty() ? RangeRequest::Unsatisfiable : RangeRequest::Partial;
+}
+
+String FileResponse::httpDate(const uint16_t fatDate, const uint16_t fatTime) {
+  const unsigned year = 1980 + (fatDate >> 9);
+  const unsigned month = (fatDate >> 5) & 0x0F;
+  const unsigned day = fatDate & 0x1F;
+  if (month < 1 || month > 12 || day < 1 || day > 31) {
+    return String("");
+  }
+  const int64_t days = daysFromCivil(static_cast<int>(year), month, day);
+  char date[32];
+  snprintf(date, sizeof(date), "%s, %02u %s %04u %02u:%02u:%02u GMT", WEEKDAYS[(days + 4) % 7], day,
+           MONTHS[month - 1], year, fatTime >> 11, (fatTime >> 5) & 0x3F, (fatTime & 0x1F) * 2);
+  return String(date);
+}
+
+int64_t FileResponse::parseHttpDate(const char* date) {
+  char weekday[4];
+  char monthName[4];
+  int day, year, hour, minute, second;
+  if (sscanf(date, "%3s, %d %3s %d %d:%d:%d GMT", weekday, &day, monthName, &year, &hour, &minute, &second) != 7) {
+    return -1;
+  }
+  for (unsigned month = 1; month <= 12; month++) {
+    if (strcmp(monthName, MONTHS[month - 1]) == 0) {
+      return daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    }
+  }
+  return -1;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <HalStorage.h>
+#include <WString.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class WebServer;
+
+/**
+ * File responses for /download and WebDAV
+ *
+ * send() answers a GET or HEAD for a file the way HTTP caches, backup tools and WebDAV clients expect:
+ *  - ETag and Last-Modified validators, and 304 Not Modified for a matching If-None-Match or If-Modified-Since
+ *  - Range requests: one range as a plain 206, several as multipart/byteranges, 416 when none is satisfiable. A Range
+ *    with an If-Range that no longer matches gets the whole file.
+ *  - the body streamed from the SD card in STREAM_CHUNK_SIZE reads
+ *
+ * The reader has no clock, so files it wrote itself carry SdFat's default timestamp. Those get no Last-Modified and
+ * only a weak ETag from the size and the first sector, which a rewrite may keep: it never answers a conditional
+ * request with 304, and an If-Range on it always gets the whole file.
+ */
+namespace FileResponse {
+
+// Inclusive byte range
+struct Range {
+  size_t first;
+  size_t last;
+};
+
+enum class RangeRequest : uint8_t {
+  Whole,          // No usable Range header: send the whole file
+  Partial,        // Send the parsed ranges
+  Unsatisfiable,  // None of the ranges lies within the file
+};
+
+// More ranges than this are answered with the whole file
+constexpr size_t MAX_RANGES = 8;
+constexpr size_t STREAM_CHUNK_SIZE = 8192;
+
+// Sends `file` as the response to the current request. Without `sendBody` only the headers go out, for HEAD. Headers
+// such as Content-Disposition may be added with server.sendHeader() before. The server has to collect the Range,
+// If-Range, If-None-Match and If-Modified-Since request headers.
+void send(WebServer& server, FsFile& file, const String& contentType, bool sendBody = true);
+
+// Validator from size, modification time and first sector, quoted. Weak (W/) for files without a real timestamp.
+String etag(FsFile& file);
+// Modification time as an HTTP date, empty if the file has no real one
+String lastModified(FsFile& file);
+String lastModified(uint16_t fatDate, uint16_t fatTime);
+
+// Parses a "bytes=..." header for a file of `size` bytes. Malformed headers and units other than bytes give Whole.
+RangeRequest parseRanges(const char* header, size_t size, std::vector<Range>& ranges);
+// "Sun, 06 Nov 1994 08:49:37 GMT" for a FAT date and time, empty if there is none
+String httpDate(uint16_t fatDate, uint16_t fatTime);
+// Seconds since 1970 of an HTTP date (IMF-fixdate), -1 if it cannot be parsed
+int64_t parseHttpDate(const char* date);
+
+}  // namespace FileResponse
@@ -12,6 +12,7 @@
 #include <utility>
 
 #include "CrossPointSettings.h"
+#include "LibraryCatalog.h"
 #include "util/UrlUtils.h"
 
 namespace {
@@ -146,6 +147,7 @@ HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string&
   // Remove existing file if present
   if (Storage.exists(destPath.c_str())) {
     Storage.remove(destPath.c_str());
+    LIBRARY_CATALOG.fileRemoved(destPath);
   }
 
   // Open file for writing
@@ -192,5 +194,6 @@ HttpDownloader::DownloadError HttpDownloader::downloadToFile(const std::string&
     return HTTP_ERROR;
   }
 
+  LIBRARY_CATALOG.fileChanged(destPath);
   return OK;
 }
@@ -0,0 +1,224 @@
+#include "ResumableUpload.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <array>
+#include <utility>
+
+namespace {
+// CRC-32 (IEEE 802.3, reflected), the same as zlib's and the browser uploader's
+constexpr std::array<uint32_t, 256> makeCrcTable() {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+constexpr std::array<uint32_t, 256> CRC_TABLE = makeCrcTable();
+
+uint32_t readLe32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16 |
+         static_cast<uint32_t>(p[3]) << 24;
+}
+
+bool isValidSessionId(const std::string& id) {
+  if (id.empty() || id.size() > ResumableUpload::MAX_SESSION_ID_LENGTH) {
+    return false;
+  }
+  for (const char c : id) {
+    const bool valid = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-' ||
+                       c == '_';
+    if (!valid) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+ResumableUpload::~ResumableUpload() { suspend(); }
+
+uint32_t ResumableUpload::crc32(const uint8_t* data, const size_t length) {
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < length; i++) {
+    crc = CRC_TABLE[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+std::string ResumableUpload::partPath() const { return std::string(UPLOAD_DIR) + "/" + session + ".part"; }
+
+std::string ResumableUpload::metaPath() const { return std::string(UPLOAD_DIR) + "/" + session + ".meta"; }
+
+bool ResumableUpload::begin(const std::string& sessionId, const size_t size, const std::string& targetPath) {
+  suspend();
+  lastError.clear();
+  if (!isValidSessionId(sessionId)) {
+    lastError = "Invalid session ID";
+    return false;
+  }
+  session = sessionId;
+  target = targetPath;
+  totalSize = size;
+
+  const bool resuming = readMeta(size, targetPath);
+  if (!resuming) {
+    // A new upload, or a session whose destination or size changed: start over and drop any other session's parts
+    Storage.removeDir(UPLOAD_DIR);
+    Storage.mkdir(UPLOAD_DIR);
+    if (!writeMeta()) {
+      lastError = "Failed to create upload session";
+      return false;
+    }
+  }
+
+  FsFile file = Storage.open(partPath().c_str(), O_RDWR | O_CREAT);
+  if (!file) {
+    lastError = "Failed to create file";
+    return false;
+  }
+  received = file.size();
+  if (received > totalSize) {
+    // Not the part of this upload after all
+    file.close();
+    Storage.remove(partPath().c_str());
+    file = Storage.open(partPath().c_str(), O_RDWR | O_CREAT);
+    received = 0;
+  }
+  file.seekSet(received);
+  syncedAt = received;
+  writer.begin(std::move(file));
+  open = true;
+  nakSent = false;
+
+  LOG_DBG("RUP", "%s session %s for %s at %u of %u bytes", resuming ? "Resuming" : "Starting", session.c_str(),
+          target.c_str(), static_cast<unsigned>(received), static_cast<unsigned>(totalSize));
+  return true;
+}
+
+ResumableUpload::Result ResumableUpload::receive(const uint8_t* frame, const size_t length) {
+  if (!open) {
+    return Result::Failed;
+  }
+  if (length < HEADER_SIZE) {
+    return Result::Nak;
+  }
+
+  const uint32_t chunkOffset = readLe32(frame);
+  const uint32_t chunkCrc = readLe32(frame + 4);
+  const uint8_t* payload = frame + HEADER_SIZE;
+  const size_t payloadLength = length - HEADER_SIZE;
+
+  if (chunkOffset > received) {
+    // An earlier chunk went missing
+    if (nakSent) {
+      return Result::Ignored;
+    }
+    nakSent = true;
+    return Result::Nak;
+  }
+  if (chunkOffset + payloadLength <= received) {
+    return Result::Ignored;
+  }
+  if (crc32(payload, payloadLength) != chunkCrc) {
+    LOG_DBG("RUP", "CRC mismatch in chunk at %u", static_cast<unsigned>(chunkOffset));
+    nakSent = true;
+    return Result::Nak;
+  }
+  if (chunkOffset + payloadLength > totalSize) {
+    return fail("Chunk past the end of the file");
+  }
+
+  // A resend may overlap what is already written
+  const size_t skip = received - chunkOffset;
+  if (!writer.write(payload + skip, payloadLength - skip)) {
+    return fail("Write failed - disk full?");
+  }
+  received += payloadLength - skip;
+  nakSent = false;
+
+  if (received < totalSize && received - syncedAt >= SYNC_INTERVAL) {
+    if (!writer.sync()) {
+      return fail("Write failed - disk full?");
+    }
+    syncedAt = received;
+  }
+
+  return received == totalSize ? complete() : Result::Ack;
+}
+
+ResumableUpload::Result ResumableUpload::complete() {
+  if (!writer.finish()) {
+    return fail("Write failed - disk full?");
+  }
+  open = false;
+
+  if (Storage.exists(target.c_str())) {
+    Storage.remove(target.c_str());
+  }
+  if (!Storage.rename(partPath().c_str(), target.c_str())) {
+    lastError = "Failed to move upload into place";
+    LOG_ERR("RUP", "Failed to rename %s to %s", partPath().c_str(), target.c_str());
+    return Result::Failed;
+  }
+  Storage.remove(metaPath().c_str());
+  LOG_DBG("RUP", "Session %s complete: %s", session.c_str(), target.c_str());
+  return Result::Done;
+}
+
+void ResumableUpload::suspend() {
+  if (!open) {
+    return;
+  }
+  writer.finish();
+  open = false;
+  LOG_DBG("RUP", "Suspended session %s at %u of %u bytes", session.c_str(), static_cast<unsigned>(received),
+          static_cast<unsigned>(totalSize));
+}
+
+ResumableUpload::Result ResumableUpload::fail(const char* error) {
+  lastError = error;
+  LOG_ERR("RUP", "Session %s: %s", session.c_str(), error);
+  // The part stays, so the client can retry once the cause is fixed
+  suspend();
+  return Result::Failed;
+}
+
+bool ResumableUpload::readMeta(const size_t size, const std::string& targetPath) const {
+  FsFile file;
+  if (!Storage.openFileForRead("RUP", metaPath(), file)) {
+    return false;
+  }
+  uint8_t version = 0;
+  uint32_t metaSize = 0;
+  uint32_t targetLength = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, metaSize);
+  serialization::readPod(file, targetLength);
+  if (version != META_FILE_VERSION || metaSize != size || targetLength != targetPath.size()) {
+    file.close();
+    return false;
+  }
+  std::string metaTarget(targetLength, '\0');
+  file.read(&metaTarget[0], targetLength);
+  file.close();
+  return metaTarget == targetPath;
+}
+
+bool ResumableUpload::writeMeta() const {
+  FsFile file;
+  if (!Storage.openFileForWrite("RUP", metaPath(), file)) {
+    return false;
+  }
+  serialization::writePod(file, META_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint32_t>(totalSize));
+  serialization::writeString(file, target);
+  file.close();
+  return true;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "UploadWriter.h"
+
+/**
+ * ResumableUpload
+ *
+ * Receiving side of the resumable WebSocket upload protocol. An upload is identified by a session ID chosen by the
+ * client, and its data arrives in chunks that carry their file offset and a CRC32:
+ *
+ *   chunk = u32 offset (LE) | u32 CRC32 of the payload (LE) | payload
+ *
+ * Chunks are written in offset order to UPLOAD_DIR/<session>.part, next to <session>.meta which records the size and
+ * destination of the upload. When the connection drops, whatever arrived stays there, and begin() with the same
+ * session on a later connection (or after a reboot) resumes from the end of the part file. Once every byte is in, the
+ * part file is renamed into place, so the destination never holds a partial file.
+ *
+ * Only one session is kept: beginning a different one deletes the parts of the others.
+ *
+ * The client may send several chunks ahead. A chunk that fails its CRC, or one that leaves a gap because an earlier
+ * chunk was lost, is answered with Nak; the client then resends from offset(). Further chunks after a gap are ignored
+ * until the missing one arrives, so a window of chunks in flight draws a single Nak.
+ *
+ * The part file is synced every SYNC_INTERVAL bytes, before the chunk is acknowledged, so that a power loss costs at
+ * most that much of the upload rather than everything since begin().
+ */
+class ResumableUpload {
+ public:
+  enum class Result : uint8_t {
+    Ack,      // Written, offset() advanced
+    Nak,      // Rejected, resend from offset()
+    Ignored,  // Already received, or behind a gap that was already reported
+    Done,     // Last chunk written and the file moved into place
+    Failed    // See error(); the session is closed
+  };
+
+  static constexpr size_t HEADER_SIZE = 8;
+  static constexpr size_t MAX_SESSION_ID_LENGTH = 16;
+  static constexpr char UPLOAD_DIR[] = "/.crosspoint/uploads";
+
+  ResumableUpload() = default;
+  // Same as suspend()
+  ~ResumableUpload();
+  ResumableUpload(const ResumableUpload&) = delete;
+  ResumableUpload& operator=(const ResumableUpload&) = delete;
+
+  // Starts or resumes the upload of `size` bytes to `targetPath`. An open session is suspended first. On success
+  // offset() tells the client where to continue; it may already equal size(), see isComplete().
+  bool begin(const std::string& sessionId, size_t size, const std::string& targetPath);
+  // Takes one chunk frame, header included
+  Result receive(const uint8_t* frame, size_t length);
+  // Moves a session whose data is all in into place. Only needed when begin() found it complete.
+  Result complete();
+  // Writes out what was received and closes the session, keeping it for a later begin()
+  void suspend();
+
+  bool isOpen() const { return open; }
+  bool isComplete() const { return open && received == totalSize; }
+  size_t offset() const { return received; }
+  size_t size() const { return totalSize; }
+  const std::string& targetPath() const { return target; }
+  const std::string& error() const { return lastError; }
+
+  static uint32_t crc32(const uint8_t* data, size_t length);
+
+ private:
+  static constexpr uint8_t META_FILE_VERSION = 1;
+  static constexpr size_t SYNC_INTERVAL = 256 * 1024;
+
+  UploadWriter writer;
+  bool open = false;
+  bool nakSent = false;  // A gap at `received` was reported, don't report it again for every chunk in flight
+  size_t received = 0;
+  size_t syncedAt = 0;  // `received` at the last sync of the part file
+  size_t totalSize = 0;
+  std::string session;
+  std::string target;
+  std::string lastError;
+
+  std::string partPath() const;
+  std::string metaPath() const;
+  bool readMeta(size_t size, const std::string& targetPath) const;
+  bool writeMeta() const;
+  Result fail(const char* error);
+};
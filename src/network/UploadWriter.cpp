@@ -0,0 +1,250 @@
+#include "UploadWriter.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+#include <esp_task_wdt.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+UploadWriter::Stats UploadWriter::sharedStats;
+
+UploadWriter::~UploadWriter() { abort(); }
+
+void UploadWriter::begin(FsFile&& file) {
+  abort();
+  this->file = std::move(file);
+  open = true;
+  failed = false;
+  discard = false;
+
+  sharedStats.bytes = 0;
+  sharedStats.startedAt = millis();
+  sharedStats.elapsedMs = 0;
+  sharedStats.writes = 0;
+  sharedStats.writeMs = 0;
+  sharedStats.stallMs = 0;
+  for (auto& bucket : sharedStats.latency) {
+    bucket = 0;
+  }
+  sharedStats.active = true;
+
+  allocate();
+}
+
+bool UploadWriter::allocate() {
+  if (ESP.getFreeHeap() >= BUFFER_COUNT * BUFFER_SIZE + MIN_FREE_HEAP) {
+    storage.reset(new (std::nothrow) uint32_t[BUFFER_COUNT * BUFFER_SIZE / sizeof(uint32_t)]);
+    bufferSize = BUFFER_SIZE;
+    if (storage && startTask()) {
+      return true;
+    }
+  }
+
+  LOG_DBG("UPW", "Writing upload inline, could not start the writer task");
+  storage.reset(new (std::nothrow) uint32_t[INLINE_BUFFER_SIZE / sizeof(uint32_t)]);
+  bufferSize = storage ? INLINE_BUFFER_SIZE : 0;
+  current = reinterpret_cast<uint8_t*>(storage.get());
+  return false;
+}
+
+bool UploadWriter::startTask() {
+  freeQueue = xQueueCreate(BUFFER_COUNT, sizeof(Chunk));
+  // One slot more than there are buffers, for the end marker
+  writeQueue = freeQueue ? xQueueCreate(BUFFER_COUNT + 1, sizeof(Chunk)) : nullptr;
+  idleSemaphore = writeQueue ? xSemaphoreCreateBinary() : nullptr;
+  if (idleSemaphore) {
+    auto* buffers = reinterpret_cast<uint8_t*>(storage.get());
+    for (size_t i = 0; i < BUFFER_COUNT; i++) {
+      const Chunk chunk{buffers + i * BUFFER_SIZE, 0};
+      xQueueSend(freeQueue, &chunk, 0);
+    }
+    if (xTaskCreate(&taskTrampoline, "UploadWrite", TASK_STACK_SIZE, this, uxTaskPriorityGet(nullptr), nullptr) ==
+        pdPASS) {
+      return true;
+    }
+  }
+
+  if (idleSemaphore) vSemaphoreDelete(idleSemaphore);
+  if (writeQueue) vQueueDelete(writeQueue);
+  if (freeQueue) vQueueDelete(freeQueue);
+  idleSemaphore = nullptr;
+  writeQueue = nullptr;
+  freeQueue = nullptr;
+  return false;
+}
+
+bool UploadWriter::write(const uint8_t* data, size_t length) {
+  if (!open || failed) {
+    return false;
+  }
+  sharedStats.bytes += length;
+  if (bufferSize == 0) {
+    return writeChunk(data, length);
+  }
+
+  while (length > 0) {
+    if (!current) {
+      // Both buffers are with the task: wait for one, which keeps the connection from being read meanwhile
+      const unsigned long waitStart = millis();
+      Chunk chunk{};
+      while (xQueueReceive(freeQueue, &chunk, WAIT_TICKS) != pdTRUE) {
+        esp_task_wdt_reset();
+      }
+      sharedStats.stallMs += millis() - waitStart;
+      current = chunk.data;
+    }
+
+    const size_t toCopy = std::min(length, bufferSize - currentLength);
+    memcpy(current + currentLength, data, toCopy);
+    currentLength += toCopy;
+    data += toCopy;
+    length -= toCopy;
+
+    if (currentLength == bufferSize && !flushCurrent()) {
+      return false;
+    }
+  }
+  return !failed;
+}
+
+bool UploadWriter::flushCurrent() {
+  if (currentLength == 0) {
+    return !failed;
+  }
+  if (!writeQueue) {
+    esp_task_wdt_reset();
+    const bool ok = writeChunk(current, currentLength);
+    esp_task_wdt_reset();
+    currentLength = 0;
+    return ok;
+  }
+
+  const Chunk chunk{current, currentLength};
+  xQueueSend(writeQueue, &chunk, portMAX_DELAY);
+  current = nullptr;
+  currentLength = 0;
+  return !failed;
+}
+
+bool UploadWriter::sync() {
+  if (!open || failed) {
+    return false;
+  }
+  if (!writeQueue) {
+    esp_task_wdt_reset();
+    file.flush();
+    esp_task_wdt_reset();
+    return !failed;
+  }
+
+  const Chunk marker{nullptr, SYNC_MARKER};
+  xQueueSend(writeQueue, &marker, portMAX_DELAY);
+  while (xSemaphoreTake(idleSemaphore, WAIT_TICKS) != pdTRUE) {
+    esp_task_wdt_reset();
+  }
+  return !failed;
+}
+
+bool UploadWriter::finish() {
+  if (!open) {
+    return false;
+  }
+  flushCurrent();
+  stopTask();
+  close();
+  return !failed;
+}
+
+void UploadWriter::abort() {
+  if (!open) {
+    return;
+  }
+  discard = true;
+  stopTask();
+  close();
+}
+
+void UploadWriter::stopTask() {
+  if (!writeQueue) {
+    return;
+  }
+  const Chunk end{nullptr, 0};
+  xQueueSend(writeQueue, &end, portMAX_DELAY);
+  while (xSemaphoreTake(idleSemaphore, WAIT_TICKS) != pdTRUE) {
+    esp_task_wdt_reset();
+  }
+  vSemaphoreDelete(idleSemaphore);
+  vQueueDelete(writeQueue);
+  vQueueDelete(freeQueue);
+  idleSemaphore = nullptr;
+  writeQueue = nullptr;
+  freeQueue = nullptr;
+}
+
+void UploadWriter::close() {
+  file.close();
+  open = false;
+  storage.reset();
+  bufferSize = 0;
+  current = nullptr;
+  currentLength = 0;
+  sharedStats.elapsedMs = millis() - sharedStats.startedAt;
+  sharedStats.active = false;
+}
+
+bool UploadWriter::writeChunk(const uint8_t* data, const size_t length) {
+  const unsigned long writeStart = millis();
+  const size_t written = file.write(data, length);
+  const uint32_t elapsed = millis() - writeStart;
+
+  sharedStats.writes++;
+  sharedStats.writeMs += elapsed;
+  size_t bucket = 0;
+  while (bucket < LATENCY_BUCKETS - 1 && elapsed > LATENCY_BUCKET_MS[bucket]) {
+    bucket++;
+  }
+  sharedStats.latency[bucket]++;
+
+  if (written != length) {
+    LOG_ERR("UPW", "Write failed: expected %u, wrote %u", static_cast<unsigned>(length),
+            static_cast<unsigned>(written));
+    failed = true;
+    return false;
+  }
+  return true;
+}
+
+void UploadWriter::taskTrampoline(void* param) {
+  auto* self = static_cast<UploadWriter*>(param);
+  // The owner may destroy the writer as soon as the semaphore is given, so keep a copy of the handle
+  const SemaphoreHandle_t idle = self->idleSemaphore;
+  self->run();
+  xSemaphoreGive(idle);
+  vTaskDelete(nullptr);
+}
+
+void UploadWriter::run() {
+  while (true) {
+    Chunk chunk{};
+    xQueueReceive(writeQueue, &chunk, portMAX_DELAY);
+    if (chunk.length == 0) {
+      return;
+    }
+    if (chunk.length == SYNC_MARKER) {
+      // Every buffer queued before the marker is written by now
+      if (!failed && !discard) {
+        file.flush();
+      }
+      xSemaphoreGive(idleSemaphore);
+      continue;
+    }
+    // After a failure the rest of the upload is dropped, but the buffers still go back so write() never hangs
+    if (!failed && !discard) {
+      writeChunk(chunk.data, chunk.length);
+    }
+    xQueueSend(freeQueue, &chunk, portMAX_DELAY);
+  }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <HalStorage.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * UploadWriter
+ *
+ * Write-behind for uploaded files. Received data is copied into one of BUFFER_COUNT buffers; a full buffer is handed
+ * to a storage task that writes it to the SD card while the network side keeps receiving into the next one. Before,
+ * every SD write ran inside the upload callback and the radio sat idle for its whole duration.
+ *
+ * Backpressure: when every buffer is waiting to be written, write() blocks. The upload callback then stops reading
+ * from its socket, so the client's TCP window closes until the card catches up.
+ *
+ * The buffers are allocated for the duration of an upload. Every buffer is a multiple of the SD sector size and
+ * word aligned, so all writes but the last one cover whole sectors. If the buffers or the task cannot be created,
+ * write() falls back to writing through a single smaller buffer on the caller's task, as uploads did before.
+ *
+ * Statistics of the current or last upload are kept for /api/status (see stats()).
+ */
+class UploadWriter {
+ public:
+  // Upper bounds of the SD write latency buckets in ms; the last bucket counts everything slower
+  static constexpr uint32_t LATENCY_BUCKET_MS[] = {2, 5, 10, 20, 50, 100, 200};
+  static constexpr size_t LATENCY_BUCKETS = sizeof(LATENCY_BUCKET_MS) / sizeof(LATENCY_BUCKET_MS[0]) + 1;
+
+  struct Stats {
+    std::atomic<bool> active{false};
+    std::atomic<uint32_t> bytes{0};      // Received so far
+    std::atomic<uint32_t> startedAt{0};  // millis() at begin()
+    std::atomic<uint32_t> elapsedMs{0};  // Begin to finish, once finished
+    std::atomic<uint32_t> writes{0};     // SD writes
+    std::atomic<uint32_t> writeMs{0};    // Time spent in them
+    std::atomic<uint32_t> stallMs{0};    // Time the network side waited for a free buffer
+    std::atomic<uint32_t> latency[LATENCY_BUCKETS] = {};
+  };
+
+  UploadWriter() = default;
+  // Same as abort()
+  ~UploadWriter();
+  UploadWriter(const UploadWriter&) = delete;
+  UploadWriter& operator=(const UploadWriter&) = delete;
+
+  // Takes over `file`, opened for writing, and starts the storage task
+  void begin(FsFile&& file);
+  // Queues `length` bytes. Returns false once any write has failed; the rest of the upload is then discarded.
+  bool write(const uint8_t* data, size_t length);
+  // Waits until the buffers queued so far are written, then syncs the file so that its size on the card covers them.
+  // The buffer being filled stays with the caller. Returns false once any write has failed.
+  bool sync();
+  // Writes what is buffered, waits for the task and closes the file. Returns false if any write failed.
+  bool finish();
+  // Stops the task, drops whatever is buffered and closes the file
+  void abort();
+  bool isOpen() const { return open; }
+
+  // Statistics of the current or most recent upload, shared by all writers
+  static const Stats& stats() { return sharedStats; }
+
+ private:
+  static constexpr size_t BUFFER_COUNT = 2;
+  static constexpr size_t BUFFER_SIZE = 16 * 1024;
+  // Buffer used when writing inline, the size uploads were written in before
+  static constexpr size_t INLINE_BUFFER_SIZE = 4 * 1024;
+  // Free heap left to WiFi and the web server after the buffers are allocated
+  static constexpr uint32_t MIN_FREE_HEAP = 48 * 1024;
+  static constexpr uint32_t TASK_STACK_SIZE = 4096;
+  // How long write() waits for a buffer before feeding the watchdog and looking again
+  static constexpr TickType_t WAIT_TICKS = pdMS_TO_TICKS(100);
+
+  // Length of the chunk without data that asks the task to sync the file
+  static constexpr size_t SYNC_MARKER = SIZE_MAX;
+
+  struct Chunk {
+    uint8_t* data;
+    size_t length;  // 0 ends the task
+  };
+
+  static Stats sharedStats;
+
+  FsFile file;
+  bool open = false;
+  std::unique_ptr<uint32_t[]> storage;  // All buffers, back to back
+  size_t bufferSize = 0;
+  uint8_t* current = nullptr;  // Buffer being filled by write(), owned by the caller until it is queued
+  size_t currentLength = 0;
+  QueueHandle_t freeQueue = nullptr;          // Chunk, buffers ready to be filled
+  QueueHandle_t writeQueue = nullptr;         // Chunk, buffers waiting for the task
+  SemaphoreHandle_t idleSemaphore = nullptr;  // Given by the task after a sync and as it exits
+  std::atomic<bool> failed{false};
+  std::atomic<bool> discard{false};  // Set by abort(), the task drops the buffers it still gets
+
+  bool allocate();
+  bool startTask();
+  void stopTask();
+  bool flushCurrent();
+  bool writeChunk(const uint8_t* data, size_t length);
+  void close();
+  static void taskTrampoline(void* param);
+  void run();
+};
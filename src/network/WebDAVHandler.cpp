@@ -6,6 +6,9 @@
 #include <Logging.h>
 #include <esp_task_wdt.h>
 
+#include "BookIngest.h"
+#include "FileResponse.h"
+#include "LibraryCatalog.h"
 #include "util/StringUtils.h"
 
 namespace {
@@ -16,6 +19,12 @@ constexpr size_t HIDDEN_ITEMS_COUNT = sizeof(HIDDEN_ITEMS) / sizeof(HIDDEN_ITEMS
 // ESP32 doesn't have real-time clock set by default, so we use a fixed epoch date
 // as a fallback. The date is not critical for WebDAV Class 1 operations.
 const char* FIXED_DATE = "Thu, 01 Jan 2024 00:00:00 GMT";
+
+// Files copied from a computer keep their modification time; sync clients compare it along with the ETag
+String fileDate(FsFile& file) {
+  const String date = FileResponse::lastModified(file);
+  return date.isEmpty() ? String(FIXED_DATE) : date;
+}
 }  // namespace
 
 // ── RequestHandler interface ─────────────────────────────────────────────────
@@ -97,7 +106,12 @@ void WebDAVHandler::raw(WebServer& server, const String& uri, HTTPRaw& raw) {
     if (_putFile) _putFile.close();
     if (_putOk) {
       String tempPath = _putPath + ".davtmp";
-      if (_putExisted) Storage.remove(_putPath.c_str());
+      // The book being replaced must not be read by its preparation meanwhile
+      BOOK_INGEST.forget(_putPath.c_str());
+      if (_putExisted) {
+        Storage.remove(_putPath.c_str());
+        LIBRARY_CATALOG.fileRemoved(_putPath.c_str());
+      }
       FsFile tmp = Storage.open(tempPath.c_str());
       if (tmp) {
         _putOk = tmp.rename(_putPath.c_str());
@@ -214,7 +228,7 @@ void WebDAVHandler::handlePropfind(WebServer& s) {
   if (isDir) {
     sendPropEntry(s, path, true, 0, FIXED_DATE);
   } else {
-    sendPropEntry(s, path, false, root.size(), FIXED_DATE);
+    sendPropEntry(s, path, false, root.size(), fileDate(root), FileResponse::etag(root));
     root.close();
     s.sendContent("</D:multistatus>\n");
     s.sendContent("");
@@ -248,7 +262,7 @@ void WebDAVHandler::handlePropfind(WebServer& s) {
         if (file.isDirectory()) {
           sendPropEntry(s, childPath, true, 0, FIXED_DATE);
         } else {
-          sendPropEntry(s, childPath, false, file.size(), FIXED_DATE);
+          sendPropEntry(s, childPath, false, file.size(), fileDate(file), FileResponse::etag(file));
         }
       }
 
@@ -265,7 +279,7 @@ void WebDAVHandler::handlePropfind(WebServer& s) {
 }
 
 void WebDAVHandler::sendPropEntry(WebServer& s, const String& path, bool isDir, size_t size,
-                                  const String& lastModified) const {
+                                  const String& lastModified, const String& etag) const {
   String href;
   urlEncodePath(path, href);
   // Ensure directory hrefs end with /
@@ -286,6 +300,14 @@ void WebDAVHandler::sendPropEntry(WebServer& s, const String& path, bool isDir,
     xml += "<D:getcontenttype>";
     xml += mime;
     xml += "</D:getcontenttype>";
+    if (!etag.isEmpty()) {
+      // Same validator as GET sends, quotes escaped for XML
+      String escaped = etag;
+      escaped.replace("\"", "&quot;");
+      xml += "<D:getetag>";
+      xml += escaped;
+      xml += "</D:getetag>";
+    }
   }
 
   xml += "<D:getlastmodified>";
@@ -325,12 +347,7 @@ void WebDAVHandler::handleGet(WebServer& s) {
     return;
   }
 
-  String contentType = getMimeType(path);
-  s.setContentLength(file.size());
-  s.send(200, contentType.c_str(), "");
-
-  NetworkClient client = s.client();
-  client.write(file);
+  FileResponse::send(s, file, getMimeType(path));
   file.close();
 }
 
@@ -362,9 +379,7 @@ void WebDAVHandler::handleHead(WebServer& s) {
     return;
   }
 
-  String contentType = getMimeType(path);
-  s.setContentLength(file.size());
-  s.send(200, contentType.c_str(), "");
+  FileResponse::send(s, file, getMimeType(path), false);
   file.close();
 }
 
@@ -388,6 +403,8 @@ void WebDAVHandler::handlePut(WebServer& s) {
   }
 
   clearEpubCacheIfNeeded(path);
+  LIBRARY_CATALOG.fileChanged(path.c_str());
+  BOOK_INGEST.enqueue(path.c_str());
   s.send(_putExisted ? 204 : 201);
   LOG_DBG("DAV", "PUT complete: %s", path.c_str());
 }
@@ -430,6 +447,7 @@ void WebDAVHandler::handleDelete(WebServer& s) {
     }
     file.close();
     if (Storage.rmdir(path.c_str())) {
+      LIBRARY_CATALOG.fileRemoved(path.c_str());
       s.send(204);
     } else {
       s.send(500, "text/plain", "Failed to remove directory");
@@ -438,6 +456,7 @@ void WebDAVHandler::handleDelete(WebServer& s) {
     file.close();
     clearEpubCacheIfNeeded(path);
     if (Storage.remove(path.c_str())) {
+      LIBRARY_CATALOG.fileRemoved(path.c_str());
       s.send(204);
     } else {
       s.send(500, "text/plain", "Failed to delete file");
@@ -478,6 +497,7 @@ void WebDAVHandler::handleMkcol(WebServer& s) {
   }
 
   if (Storage.mkdir(path.c_str())) {
+    LIBRARY_CATALOG.fileChanged(path.c_str());
     s.send(201);
     LOG_DBG("DAV", "Created directory: %s", path.c_str());
   } else {
@@ -536,7 +556,9 @@ void WebDAVHandler::handleMove(WebServer& s) {
   }
 
   if (dstExists) {
+    clearEpubCacheIfNeeded(dstPath);
     Storage.remove(dstPath.c_str());
+    LIBRARY_CATALOG.fileRemoved(dstPath.c_str());
   }
 
   FsFile file = Storage.open(srcPath.c_str());
@@ -550,6 +572,8 @@ void WebDAVHandler::handleMove(WebServer& s) {
   file.close();
 
   if (success) {
+    LIBRARY_CATALOG.fileRenamed(srcPath.c_str(), dstPath.c_str());
+    BOOK_INGEST.enqueue(dstPath.c_str());
     s.send(dstExists ? 204 : 201);
   } else {
     s.send(500, "text/plain", "Move failed");
@@ -616,7 +640,9 @@ void WebDAVHandler::handleCopy(WebServer& s) {
   }
 
   if (dstExists) {
+    clearEpubCacheIfNeeded(dstPath);
     Storage.remove(dstPath.c_str());
+    LIBRARY_CATALOG.fileRemoved(dstPath.c_str());
   }
 
   FsFile dstFile;
@@ -644,8 +670,11 @@ void WebDAVHandler::handleCopy(WebServer& s) {
   dstFile.close();
 
   if (copyOk) {
+    LIBRARY_CATALOG.fileChanged(dstPath.c_str());
+    BOOK_INGEST.enqueue(dstPath.c_str());
     s.send(dstExists ? 204 : 201);
   } else {
+    clearEpubCacheIfNeeded(dstPath);
     Storage.remove(dstPath.c_str());
     s.send(500, "text/plain", "Copy failed - disk full?");
   }
@@ -801,6 +830,7 @@ bool WebDAVHandler::getOverwrite(WebServer& s) const {
 }
 
 void WebDAVHandler::clearEpubCacheIfNeeded(const String& path) const {
+  BOOK_INGEST.forget(path.c_str());
   if (StringUtils::checkFileExtension(path, ".epub")) {
     Epub(path.c_str(), "/.crosspoint").clearCache();
     LOG_DBG("DAV", "Cleared epub cache for: %s", path.c_str());
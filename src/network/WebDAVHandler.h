@@ -39,6 +39,7 @@ class WebDAVHandler : public RequestHandler {
   int getDepth(WebServer& s) const;
   bool getOverwrite(WebServer& s) const;
   void clearEpubCacheIfNeeded(const String& path) const;
-  void sendPropEntry(WebServer& s, const String& href, bool isDir, size_t size, const String& lastModified) const;
+  void sendPropEntry(WebServer& s, const String& href, bool isDir, size_t size, const String& lastModified,
+                     const String& etag = "") const;
   String getMimeType(const String& path) const;
 };
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Holds a FreeRTOS mutex for the lifetime of the guard
+class MutexGuard {
+  SemaphoreHandle_t mutex;
+
+ public:
+  explicit MutexGuard(const SemaphoreHandle_t mutex) : mutex(mutex) { xSemaphoreTake(mutex, portMAX_DELAY); }
+  ~MutexGuard() { xSemaphoreGive(mutex); }
+  MutexGuard(const MutexGuard&) = delete;
+  MutexGuard& operator=(const MutexGuard&) = delete;
+};
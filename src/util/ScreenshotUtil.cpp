@@ -9,6 +9,7 @@
 #include <string>
 
 #include "Bitmap.h"  // Required for BmpHeader struct definition
+#include "LibraryCatalog.h"
 
 void ScreenshotUtil::takeScreenshot(GfxRenderer& renderer) {
   const uint8_t* fb = renderer.getFrameBuffer();
@@ -51,6 +52,7 @@ bool ScreenshotUtil::saveFramebufferAsBmp(const char* filename, const uint8_t* f
       if (!Storage.mkdir(dir.c_str())) {
         return false;
       }
+      LIBRARY_CATALOG.fileChanged(dir);
     }
   }
 
@@ -113,5 +115,6 @@ bool ScreenshotUtil::saveFramebufferAsBmp(const char* filename, const uint8_t* f
     return false;
   }
 
+  LIBRARY_CATALOG.fileChanged(filename);
   return true;
 }
@@ -0,0 +1,205 @@
+#include <HalStorage.h>
+#include <WebServer.h>
+#include <utime.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "HostPlatform.h"
+#include "network/FileResponse.h"
+
+// Checks FileResponse's header parsing and its answers to conditional and range requests against files on the host
+// storage. Prints every failed check and exits non-zero if there was one.
+
+namespace fs = std::filesystem;
+
+namespace {
+
+int failures = 0;
+
+void check(const bool ok, const std::string& what) {
+  if (!ok) {
+    std::printf("FAIL %s\n", what.c_str());
+    failures++;
+  }
+}
+
+std::string describe(const FileResponse::RangeRequest request, const std::vector<FileResponse::Range>& ranges) {
+  switch (request) {
+    case FileResponse::RangeRequest::Whole:
+      return "whole";
+    case FileResponse::RangeRequest::Unsatisfiable:
+      return "unsatisfiable";
+    case FileResponse::RangeRequest::Partial:
+      break;
+  }
+  std::string result;
+  for (const auto& range : ranges) {
+    result += (result.empty() ? "" : ",") + std::to_string(range.first) + "-" + std::to_string(range.last);
+  }
+  return result;
+}
+
+// `expected` is "whole", "unsatisfiable" or the ranges, e.g. "0-9,900-999"
+void checkRanges(const char* header, const size_t size, const std::string& expected) {
+  std::vector<FileResponse::Range> ranges;
+  const std::string actual = describe(FileResponse::parseRanges(header, size, ranges), ranges);
+  check(actual == expected, std::string("parseRanges(\"") + header + "\", " + std::to_string(size) + ") = " + actual +
+                                ", expected " + expected);
+}
+
+void checkParseRanges() {
+  checkRanges("bytes=0-99", 1000, "0-99");
+  checkRanges("bytes=0-5000", 1000, "0-999");
+  checkRanges(" bytes= 10-19 , 30-39", 1000, "10-19,30-39");
+  // Suffix ranges: the last N bytes, all of the file when N exceeds it
+  checkRanges("bytes=-100", 1000, "900-999");
+  checkRanges("bytes=-5000", 1000, "0-999");
+  checkRanges("bytes=-0", 1000, "unsatisfiable");
+  checkRanges("bytes=-5", 0, "unsatisfiable");
+  // Open-ended ranges, also as the last of several
+  checkRanges("bytes=900-", 1000, "900-999");
+  checkRanges("bytes=0-9,900-", 1000, "0-9,900-999");
+  checkRanges("bytes=1000-", 1000, "unsatisfiable");
+  checkRanges("bytes=0-9,2000-", 1000, "0-9");
+  // Malformed headers are ignored
+  checkRanges("bytes=500-100", 1000, "whole");
+  checkRanges("items=0-99", 1000, "whole");
+  checkRanges("bytes=abc", 1000, "whole");
+  checkRanges("bytes=0-9;10-19", 1000, "whole");
+  checkRanges("bytes=", 1000, "whole");
+
+  std::string header = "bytes=0-0";
+  std::string expected = "0-0";
+  for (size_t i = 1; i < FileResponse::MAX_RANGES; i++) {
+    header += "," + std::to_string(i * 10) + "-" + std::to_string(i * 10);
+    expected += "," + std::to_string(i * 10) + "-" + std::to_string(i * 10);
+  }
+  checkRanges(header.c_str(), 1000, expected);
+  checkRanges((header + ",500-600").c_str(), 1000, "whole");
+}
+
+constexpr uint16_t fatDate(const int year, const int month, const int day) {
+  return (year - 1980) << 9 | month << 5 | day;
+}
+constexpr uint16_t fatTime(const int hour, const int minute, const int second) {
+  return hour << 11 | minute << 5 | second / 2;
+}
+
+void checkDates() {
+  const String date = FileResponse::httpDate(fatDate(1994, 11, 6), fatTime(8, 49, 37));
+  // FAT stores seconds in two second steps
+  check(date == "Sun, 06 Nov 1994 08:49:36 GMT", "httpDate(1994-11-06 08:49:37) = " + date);
+  check(FileResponse::httpDate(fatDate(2024, 2, 29), fatTime(23, 59, 58)) == "Thu, 29 Feb 2024 23:59:58 GMT",
+        "httpDate on a leap day");
+  check(FileResponse::httpDate(0, 0).isEmpty(), "httpDate without a date is empty");
+  check(FileResponse::lastModified(fatDate(2000, 1, 1), 0).isEmpty(), "lastModified of SdFat's default date is empty");
+  check(FileResponse::lastModified(fatDate(2000, 1, 1), fatTime(0, 0, 2)) == "Sat, 01 Jan 2000 00:00:02 GMT",
+        "lastModified of a real date");
+
+  check(FileResponse::parseHttpDate("Sun, 06 Nov 1994 08:49:37 GMT") == 784111777, "parseHttpDate(IMF-fixdate)");
+  check(FileResponse::parseHttpDate(date.c_str()) == 784111776, "parseHttpDate(httpDate(...)) round trip");
+  check(FileResponse::parseHttpDate("Sat, 01 Jan 2000 00:00:00 GMT") == 946684800, "parseHttpDate(2000-01-01)");
+  check(FileResponse::parseHttpDate("Sun, 06 Foo 1994 08:49:37 GMT") == -1, "parseHttpDate with an unknown month");
+  check(FileResponse::parseHttpDate("Sunday, 06-Nov-94 08:49:37 GMT") == -1, "parseHttpDate(RFC 850 date)");
+  check(FileResponse::parseHttpDate("") == -1, "parseHttpDate(\"\")");
+}
+
+// Writes `size` bytes to the SD root and sets the file's modification time, in seconds since 1970
+void writeFile(const std::string& sdRoot, const std::string& name, const size_t size, const time_t modified) {
+  std::ofstream out(sdRoot + "/" + name, std::ios::binary | std::ios::trunc);
+  for (size_t i = 0; i < size; i++) out.put(static_cast<char>('a' + i % 26));
+  out.close();
+  const utimbuf times = {modified, modified};
+  utime((sdRoot + "/" + name).c_str(), &times);
+}
+
+// Answers a GET for `path` with the given request headers
+WebServer get(const std::string& path, const std::map<std::string, String>& headers) {
+  WebServer server;
+  server.requestHeaders = headers;
+  FsFile file;
+  if (!Storage.openFileForRead("FRC", path, file)) {
+    check(false, "cannot open " + path);
+    return server;
+  }
+  FileResponse::send(server, file, "application/octet-stream");
+  file.close();
+  return server;
+}
+
+void checkResponses(const std::string& sdRoot) {
+  constexpr size_t SIZE = 1000;
+  writeFile(sdRoot, "dated.bin", SIZE, 1714564800);  // 2024-05-01 12:00:00
+  writeFile(sdRoot, "undated.bin", SIZE, 946684800);  // SdFat's default, 2000-01-01 00:00:00
+
+  // A file with a real timestamp has a strong tag and a Last-Modified date, and both validate
+  const WebServer dated = get("/dated.bin", {});
+  const String tag = dated.responseHeader("ETag");
+  const String lastModified = dated.responseHeader("Last-Modified");
+  check(dated.status == 200 && dated.body.size() == SIZE, "GET of a dated file");
+  check(tag.startsWith("\"") && tag.endsWith("\""), "strong ETag for a dated file: " + tag);
+  check(lastModified == "Wed, 01 May 2024 12:00:00 GMT", "Last-Modified of a dated file: " + lastModified);
+  check(get("/dated.bin", {{"If-None-Match", tag}}).status == 304, "If-None-Match with the tag gives 304");
+  check(get("/dated.bin", {{"If-None-Match", "W/" + tag}}).status == 304, "If-None-Match compares weakly");
+  check(get("/dated.bin", {{"If-None-Match", String("\"other\"")}}).status == 200, "If-None-Match with another tag");
+  check(get("/dated.bin", {{"If-Modified-Since", lastModified}}).status == 304, "If-Modified-Since the date");
+  check(get("/dated.bin", {{"If-Modified-Since", String("Tue, 30 Apr 2024 12:00:00 GMT")}}).status == 200,
+        "If-Modified-Since an earlier date");
+
+  const WebServer range = get("/dated.bin", {{"Range", String("bytes=-10")}, {"If-Range", tag}});
+  check(range.status == 206 && range.body == std::string("cdefghijkl") &&
+            range.responseHeader("Content-Range") == "bytes 990-999/1000",
+        "If-Range with the tag gives the range");
+  check(get("/dated.bin", {{"Range", String("bytes=-10")}, {"If-Range", lastModified}}).status == 206,
+        "If-Range with the date gives the range");
+  check(get("/dated.bin", {{"Range", String("bytes=-10")}, {"If-Range", "W/" + tag}}).status == 200,
+        "If-Range with a weak tag gives the whole file");
+  check(get("/dated.bin", {{"Range", String("bytes=-10")}, {"If-Range", String("\"other\"")}}).status == 200,
+        "If-Range with another tag gives the whole file");
+
+  const WebServer unsatisfiable = get("/dated.bin", {{"Range", String("bytes=-0")}});
+  check(unsatisfiable.status == 416 && unsatisfiable.responseHeader("Content-Range") == "bytes */1000",
+        "bytes=-0 gives 416");
+
+  const WebServer multipart = get("/dated.bin", {{"Range", String("bytes=0-9,990-")}});
+  check(multipart.status == 206 && multipart.contentType.startsWith("multipart/byteranges; boundary="),
+        "several ranges give multipart/byteranges");
+  check(multipart.contentLength == multipart.body.size(),
+        "multipart Content-Length " + std::to_string(multipart.contentLength) + " matches the body's " +
+            std::to_string(multipart.body.size()) + " bytes");
+
+  // A file with SdFat's default date has only a weak tag, which validates nothing
+  const WebServer undated = get("/undated.bin", {});
+  const String weakTag = undated.responseHeader("ETag");
+  check(weakTag.startsWith("W/\""), "weak ETag for an undated file: " + weakTag);
+  check(undated.responseHeader("Last-Modified").isEmpty(), "no Last-Modified for an undated file");
+  check(get("/undated.bin", {{"If-None-Match", weakTag}}).status == 200, "a weak tag never gives 304");
+  check(get("/undated.bin", {{"If-Modified-Since", String("Sat, 01 Jan 2000 00:00:00 GMT")}}).status == 200,
+        "If-Modified-Since does not apply to an undated file");
+  check(get("/undated.bin", {{"Range", String("bytes=0-9")}, {"If-Range", weakTag}}).status == 200,
+        "If-Range with a weak tag gives the whole file");
+  check(get("/undated.bin", {{"Range", String("bytes=0-9")}}).status == 206, "a plain Range still applies");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::string sdRoot = argc > 1 ? argv[1] : "sd";
+  fs::create_directories(sdRoot);
+  HostPlatform::setStorageRoot(sdRoot);
+  if (!Storage.begin()) {
+    std::fprintf(stderr, "cannot use %s as SD root\n", sdRoot.c_str());
+    return 1;
+  }
+
+  checkParseRanges();
+  checkDates();
+  checkResponses(sdRoot);
+
+  std::printf("%s: %d failed\n", failures == 0 ? "OK" : "FAILED", failures);
+  return failures == 0 ? 0 : 1;
+}
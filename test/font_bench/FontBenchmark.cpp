@@ -0,0 +1,112 @@
+#include <EpdFont.h>
+#include <Utf8.h>
+#include <builtinFonts/all.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Times kerning and ligature lookups for every built-in font, once through the direct-indexed class maps and ligature
+// start filter emitted by fontconvert.py and once through the binary searches alone (the same font data with those
+// tables removed). Both runs must produce the same adjustments and substitutions.
+
+namespace {
+
+struct BuiltinFont {
+  const char* name;
+  const EpdFontData* data;
+};
+
+// Generated by run_font_bench.sh from the EpdFontData definitions in builtinFonts/
+const BuiltinFont kBuiltinFonts[] = {
+#define BUILTIN_FONT(name) {#name, &name},
+#include "BuiltinFontList.inc"
+#undef BUILTIN_FONT
+};
+
+const char* const kSampleText =
+    "\xe2\x80\x9cWell,\xe2\x80\x9d said Prince Vasili, \xe2\x80\x9cthe office of the first floor is offered to "
+    "Tolstoy\xe2\x80\x99s affiliate \xe2\x80\x94 a fluffy, efficient officer.\xe2\x80\x9d AVAST! Tea, Yoyo, "
+    "Wolf, P.T. Barnum\xe2\x80\xa6 \xd0\x92\xd0\xbe\xd0\xb9\xd0\xbd\xd0\xb0 \xd0\xb8 \xd0\xbc\xd0\xb8\xd1\x80: "
+    "\xc2\xab\xd0\x93\xd0\xb5\xd0\xbd\xd0\xb5\xd1\x80\xd0\xb0\xd0\xbb \xd0\xa2\xd1\x83\xd1\x87\xd0\xba\xd0\xbe\xd0"
+    "\xb2\xc2\xbb. Stra\xc3\x9f" "e, \xc3\x85ngstr\xc3\xb6m, \xc5\x81\xc3\xb3" "d\xc5\xba, \xc8\x98tefan "
+    "\xe2\x82\xac" "42.";
+
+struct Result {
+  double kerningNs;
+  double ligatureNs;
+  long kerningSum;
+  uint32_t ligatureHash;
+};
+
+Result measure(const EpdFont& font, const std::vector<uint32_t>& codepoints, const int iterations) {
+  Result result{};
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    long sum = 0;
+    for (size_t c = 1; c < codepoints.size(); c++) {
+      sum += font.getKerning(codepoints[c - 1], codepoints[c]);
+    }
+    result.kerningSum = sum;
+  }
+  result.kerningNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+                     (static_cast<double>(iterations) * (codepoints.size() - 1));
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    uint32_t hash = 2166136261u;
+    const char* text = kSampleText;
+    uint32_t cp;
+    while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+      hash = (hash ^ font.applyLigatures(cp, text)) * 16777619u;
+    }
+    result.ligatureHash = hash;
+  }
+  result.ligatureNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+                      (static_cast<double>(iterations) * codepoints.size());
+
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+  std::vector<uint32_t> codepoints;
+  const auto* text = reinterpret_cast<const uint8_t*>(kSampleText);
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(&text))) {
+    codepoints.push_back(cp);
+  }
+
+  bool mismatch = false;
+  double totals[4] = {};
+  std::printf("%-26s %14s %14s %14s %14s\n", "font", "kern table ns", "kern search ns", "liga table ns",
+              "liga search ns");
+  for (const auto& builtin : kBuiltinFonts) {
+    EpdFontData searchOnly = *builtin.data;
+    searchOnly.kernLeftDirect = nullptr;
+    searchOnly.kernRightDirect = nullptr;
+    searchOnly.ligatureStartFilter = nullptr;
+
+    const Result tables = measure(EpdFont(builtin.data), codepoints, iterations);
+    const Result search = measure(EpdFont(&searchOnly), codepoints, iterations);
+    const bool same = tables.kerningSum == search.kerningSum && tables.ligatureHash == search.ligatureHash;
+    mismatch |= !same;
+
+    std::printf("%-26s %14.2f %14.2f %14.2f %14.2f%s\n", builtin.name, tables.kerningNs, search.kerningNs,
+                tables.ligatureNs, search.ligatureNs, same ? "" : "  MISMATCH");
+    totals[0] += tables.kerningNs;
+    totals[1] += search.kerningNs;
+    totals[2] += tables.ligatureNs;
+    totals[3] += search.ligatureNs;
+  }
+
+  const double count = sizeof(kBuiltinFonts) / sizeof(kBuiltinFonts[0]);
+  std::printf("%-26s %14.2f %14.2f %14.2f %14.2f\n", "mean", totals[0] / count, totals[1] / count, totals[2] / count,
+              totals[3] / count);
+  return mismatch ? 1 : 0;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+// Minimal Arduino surface for building firmware libraries on the host (see test/run_render_bench.sh).
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "HardwareSerial.h"
+#include "Print.h"
+#include "WString.h"
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t*>(addr))
+
+using std::max;
+using std::min;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+// The host has no heap limit worth modelling; the figures are those of an idle device, so heap checks in the libraries
+// take the same branch as on the reader.
+class EspClass {
+ public:
+  uint32_t getFreeHeap() const { return 200 * 1024; }
+  uint32_t getMinFreeHeap() const { return 200 * 1024; }
+  uint32_t getMaxAllocHeap() const { return 100 * 1024; }
+  uint32_t getHeapSize() const { return 320 * 1024; }
+};
+
+extern EspClass ESP;
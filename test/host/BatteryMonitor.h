@@ -0,0 +1,4 @@
+#pragma once
+
+// Battery gauge of the X4; the host reports a full battery from HalPowerManager (see HostInput.cpp).
+class BatteryMonitor {};
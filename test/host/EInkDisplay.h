@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+// Panel geometry of the X4 display driver; the host framebuffer lives in HostPlatform.cpp.
+class EInkDisplay {
+ public:
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Arduino.h"
+#include "Print.h"
+
+// Host serial port: log output goes to stdout.
+class HWCDC : public Print {
+ public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t b) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  operator bool() const { return true; }
+};
+
+extern HWCDC Serial;
@@ -0,0 +1,284 @@
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/stream_buffer.h>
+#include <freertos/task.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "HostPlatform.h"
+
+// The subset of the FreeRTOS API the libraries use, over std::thread. Every handle is a pointer to one of the objects
+// below; a semaphore is a queue of zero-sized items, like in FreeRTOS.
+
+namespace {
+
+// Waits on `condition` until `ready` holds or `ticks` milliseconds have passed. Returns the final value of `ready`.
+template <typename Predicate>
+bool waitFor(std::unique_lock<std::mutex>& lock, std::condition_variable& condition, const TickType_t ticks,
+             Predicate ready) {
+  if (ticks == portMAX_DELAY) {
+    condition.wait(lock, ready);
+    return true;
+  }
+  return condition.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+struct Queue {
+  std::mutex mutex;
+  std::condition_variable changed;
+  size_t length;
+  size_t itemSize;
+  std::deque<std::vector<uint8_t>> items;
+  // Mutexes only: the task that took it last, nullptr while it is given
+  bool isMutex = false;
+  TaskHandle_t holder = nullptr;
+
+  Queue(const size_t length, const size_t itemSize) : length(length), itemSize(itemSize) {}
+};
+
+struct StreamBuffer {
+  std::mutex mutex;
+  std::condition_variable changed;
+  size_t capacity;
+  size_t triggerLevel;
+  std::deque<uint8_t> bytes;
+
+  StreamBuffer(const size_t capacity, const size_t triggerLevel)
+      : capacity(capacity), triggerLevel(std::max<size_t>(triggerLevel, 1)) {}
+};
+
+struct Task {
+  std::string name;
+  std::mutex mutex;
+  std::condition_variable changed;
+  uint32_t notificationValue = 0;
+  // Blocked in ulTaskNotifyTake() with nothing pending
+  bool waiting = false;
+  // Kept once its handle has been handed out, otherwise freed when the task function returns
+  bool keep = false;
+
+  explicit Task(std::string name) : name(std::move(name)) {}
+};
+
+thread_local Task* currentTask = nullptr;
+
+// Tasks that are running or whose handle was handed out, for HostPlatform::waitForTaskIdle()
+std::mutex tasksMutex;
+std::vector<Task*> tasks;
+
+std::recursive_mutex criticalSection;
+
+}  // namespace
+
+QueueHandle_t xQueueCreate(const UBaseType_t length, const UBaseType_t itemSize) {
+  return new Queue(length, itemSize);
+}
+
+BaseType_t xQueueSend(QueueHandle_t handle, const void* item, const TickType_t ticksToWait) {
+  auto* queue = static_cast<Queue*>(handle);
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!waitFor(lock, queue->changed, ticksToWait, [queue] { return queue->items.size() < queue->length; })) {
+    return pdFAIL;
+  }
+  const auto* bytes = static_cast<const uint8_t*>(item);
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t handle, void* buffer, const TickType_t ticksToWait) {
+  auto* queue = static_cast<Queue*>(handle);
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!waitFor(lock, queue->changed, ticksToWait, [queue] { return !queue->items.empty(); })) {
+    return pdFALSE;
+  }
+  if (queue->itemSize > 0) {
+    memcpy(buffer, queue->items.front().data(), queue->itemSize);
+  }
+  queue->items.pop_front();
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t handle, void* buffer, const TickType_t ticksToWait) {
+  auto* queue = static_cast<Queue*>(handle);
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!waitFor(lock, queue->changed, ticksToWait, [queue] { return !queue->items.empty(); })) {
+    return pdFALSE;
+  }
+  if (queue->itemSize > 0) {
+    memcpy(buffer, queue->items.front().data(), queue->itemSize);
+  }
+  return pdTRUE;
+}
+
+void vQueueDelete(QueueHandle_t handle) { delete static_cast<Queue*>(handle); }
+
+SemaphoreHandle_t xSemaphoreCreateBinary() { return xQueueCreate(1, 0); }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+  static_cast<Queue*>(mutex)->isMutex = true;
+  xSemaphoreGive(mutex);
+  return mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, const TickType_t ticksToWait) {
+  auto* queue = static_cast<Queue*>(semaphore);
+  const TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!waitFor(lock, queue->changed, ticksToWait, [queue] { return !queue->items.empty(); })) {
+    return pdFALSE;
+  }
+  queue->items.pop_front();
+  if (queue->isMutex) queue->holder = self;
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  auto* queue = static_cast<Queue*>(semaphore);
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  if (queue->items.size() >= queue->length) return pdFAIL;
+  queue->items.emplace_back();
+  queue->holder = nullptr;
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+TaskHandle_t xSemaphoreGetMutexHolder(SemaphoreHandle_t mutex) {
+  auto* queue = static_cast<Queue*>(mutex);
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  return queue->holder;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) { vQueueDelete(semaphore); }
+
+StreamBufferHandle_t xStreamBufferCreate(const size_t bufferSize, const size_t triggerLevel) {
+  return new StreamBuffer(bufferSize, triggerLevel);
+}
+
+size_t xStreamBufferSend(StreamBufferHandle_t handle, const void* data, const size_t length,
+                         const TickType_t ticksToWait) {
+  auto* buffer = static_cast<StreamBuffer*>(handle);
+  std::unique_lock<std::mutex> lock(buffer->mutex);
+  // Like FreeRTOS: wait for room for the whole message, then write as much as fits
+  const size_t wanted = std::min(length, buffer->capacity);
+  waitFor(lock, buffer->changed, ticksToWait,
+          [buffer, wanted] { return buffer->capacity - buffer->bytes.size() >= wanted; });
+  const size_t n = std::min(length, buffer->capacity - buffer->bytes.size());
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  buffer->bytes.insert(buffer->bytes.end(), bytes, bytes + n);
+  if (n > 0) buffer->changed.notify_all();
+  return n;
+}
+
+size_t xStreamBufferReceive(StreamBufferHandle_t handle, void* data, const size_t length,
+                            const TickType_t ticksToWait) {
+  auto* buffer = static_cast<StreamBuffer*>(handle);
+  std::unique_lock<std::mutex> lock(buffer->mutex);
+  // Like FreeRTOS: wait for the trigger level, then return whatever is there
+  waitFor(lock, buffer->changed, ticksToWait, [buffer] { return buffer->bytes.size() >= buffer->triggerLevel; });
+  const size_t n = std::min(length, buffer->bytes.size());
+  std::copy_n(buffer->bytes.begin(), n, static_cast<uint8_t*>(data));
+  buffer->bytes.erase(buffer->bytes.begin(), buffer->bytes.begin() + n);
+  if (n > 0) buffer->changed.notify_all();
+  return n;
+}
+
+void vStreamBufferDelete(StreamBufferHandle_t handle) { delete static_cast<StreamBuffer*>(handle); }
+
+BaseType_t xTaskCreate(const TaskFunction_t function, const char* name, uint32_t, void* parameters, UBaseType_t,
+                       TaskHandle_t* createdTask) {
+  auto* task = new Task(name ? name : "");
+  task->keep = createdTask != nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tasksMutex);
+    tasks.push_back(task);
+  }
+  std::thread thread([task, function, parameters] {
+    currentTask = task;
+    function(parameters);
+    if (task->keep) return;
+    std::lock_guard<std::mutex> lock(tasksMutex);
+    tasks.erase(std::find(tasks.begin(), tasks.end(), task));
+    delete task;
+  });
+  if (createdTask) *createdTask = task;
+  thread.detach();
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t) {}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t) { return tskIDLE_PRIORITY; }
+
+void vTaskDelay(const TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  if (!currentTask) {
+    static thread_local Task threadTask("");
+    currentTask = &threadTask;
+  }
+  return currentTask;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t handle, const uint32_t value, const eNotifyAction action) {
+  auto* task = static_cast<Task*>(handle);
+  std::lock_guard<std::mutex> lock(task->mutex);
+  switch (action) {
+    case eSetBits:
+      task->notificationValue |= value;
+      break;
+    case eIncrement:
+      task->notificationValue++;
+      break;
+    case eSetValueWithOverwrite:
+    case eSetValueWithoutOverwrite:
+      task->notificationValue = value;
+      break;
+    case eNoAction:
+      break;
+  }
+  task->changed.notify_all();
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(const BaseType_t clearCountOnExit, const TickType_t ticksToWait) {
+  auto* task = static_cast<Task*>(xTaskGetCurrentTaskHandle());
+  std::unique_lock<std::mutex> lock(task->mutex);
+  task->waiting = true;
+  task->changed.notify_all();
+  const bool notified = waitFor(lock, task->changed, ticksToWait, [task] { return task->notificationValue > 0; });
+  task->waiting = false;
+  if (!notified) return 0;
+  const uint32_t value = task->notificationValue;
+  task->notificationValue = clearCountOnExit ? 0 : value - 1;
+  return value;
+}
+
+void vTaskEnterCritical() { criticalSection.lock(); }
+
+void vTaskExitCritical() { criticalSection.unlock(); }
+
+void HostPlatform::waitForTaskIdle(const char* name) {
+  Task* task = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tasksMutex);
+    const auto it =
+        std::find_if(tasks.begin(), tasks.end(), [name](const Task* t) { return t->keep && t->name == name; });
+    if (it == tasks.end()) return;
+    task = *it;
+  }
+  std::unique_lock<std::mutex> lock(task->mutex);
+  task->changed.wait(lock, [task] { return task->waiting && task->notificationValue == 0; });
+}
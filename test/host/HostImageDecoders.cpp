@@ -0,0 +1,10 @@
+#include <Epub/converters/ImageDecoderFactory.h>
+
+// The JPEG and PNG decoders come from PlatformIO registry packages that are not part of the tree, so on the host no
+// image format is supported: chapters lay out their images' alt text and pages render without bitmaps.
+
+ImageToFramebufferDecoder* ImageDecoderFactory::getDecoder(const std::string&) { return nullptr; }
+
+bool ImageDecoderFactory::isFormatSupported(const std::string&) { return false; }
+
+bool ImageDecoderFactory::getDimensions(const std::string&, ImageDimensions&) { return false; }
@@ -0,0 +1,67 @@
+#include <HalGPIO.h>
+#include <HalPowerManager.h>
+
+#include <deque>
+
+#include "HostPlatform.h"
+
+// HalGPIO driven by a queue of scripted button presses, and a HalPowerManager that never throttles or sleeps. Build
+// with CROSSPOINT_EMULATED=1 so HalGPIO does not embed the hardware InputManager.
+
+namespace {
+struct ButtonPress {
+  uint8_t button;
+  unsigned long heldMs;
+};
+
+std::deque<ButtonPress> queuedPresses;
+// The press consumed by the latest update(): it reads as pressed and released within that one loop iteration
+bool hasCurrent = false;
+ButtonPress current{};
+}  // namespace
+
+void HostPlatform::queueButtonPress(const uint8_t buttonIndex, const unsigned long heldMs) {
+  queuedPresses.push_back({buttonIndex, heldMs});
+}
+
+bool HostPlatform::hasQueuedButtonPresses() { return !queuedPresses.empty(); }
+
+void HalGPIO::begin() {}
+
+void HalGPIO::update() {
+  hasCurrent = !queuedPresses.empty();
+  if (hasCurrent) {
+    current = queuedPresses.front();
+    queuedPresses.pop_front();
+  }
+}
+
+bool HalGPIO::isPressed(uint8_t) const { return false; }
+
+bool HalGPIO::wasPressed(const uint8_t buttonIndex) const { return hasCurrent && current.button == buttonIndex; }
+
+bool HalGPIO::wasAnyPressed() const { return hasCurrent; }
+
+bool HalGPIO::wasReleased(const uint8_t buttonIndex) const { return wasPressed(buttonIndex); }
+
+bool HalGPIO::wasAnyReleased() const { return hasCurrent; }
+
+unsigned long HalGPIO::getHeldTime() const { return hasCurrent ? current.heldMs : 0; }
+
+bool HalGPIO::isUsbConnected() const { return true; }
+
+HalGPIO::WakeupReason HalGPIO::getWakeupReason() const { return WakeupReason::PowerButton; }
+
+HalPowerManager powerManager;
+
+void HalPowerManager::begin() {}
+
+void HalPowerManager::setPowerSaving(bool) {}
+
+void HalPowerManager::startDeepSleep(HalGPIO&) const {}
+
+uint16_t HalPowerManager::getBatteryPercentage() const { return 100; }
+
+HalPowerManager::Lock::Lock() { valid = true; }
+
+HalPowerManager::Lock::~Lock() {}
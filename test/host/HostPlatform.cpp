@@ -0,0 +1,78 @@
+#include <Arduino.h>
+#include <HalDisplay.h>
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <utility>
+
+#include "HostPlatform.h"
+
+HWCDC Serial;
+
+EspClass ESP;
+
+size_t HWCDC::write(const uint8_t b) { return fwrite(&b, 1, 1, stdout); }
+
+size_t HWCDC::write(const uint8_t* buffer, const size_t size) { return fwrite(buffer, 1, size, stdout); }
+
+static const auto startTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(const unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+// RAM framebuffer standing in for the panel. Refreshes copy it to the panel image and hand that to the refresh hook.
+static uint8_t frameBuffer[HalDisplay::BUFFER_SIZE];
+static uint8_t panel[HalDisplay::BUFFER_SIZE];
+static uint8_t lsbPlane[HalDisplay::BUFFER_SIZE];
+static uint8_t msbPlane[HalDisplay::BUFFER_SIZE];
+static HostPlatform::RefreshHook refreshHook;
+
+void HostPlatform::setRefreshHook(RefreshHook hook) { refreshHook = std::move(hook); }
+
+HalDisplay::HalDisplay() {}
+
+HalDisplay::~HalDisplay() {}
+
+void HalDisplay::begin() {}
+
+void HalDisplay::clearScreen(const uint8_t color) const { memset(frameBuffer, color, sizeof(frameBuffer)); }
+
+void HalDisplay::drawImage(const uint8_t*, uint16_t, uint16_t, uint16_t, uint16_t, bool) const {}
+
+void HalDisplay::drawImageTransparent(const uint8_t*, uint16_t, uint16_t, uint16_t, uint16_t, bool) const {}
+
+void HalDisplay::displayBuffer(RefreshMode, bool) {
+  memcpy(panel, frameBuffer, sizeof(panel));
+  if (refreshHook) refreshHook(panel, nullptr, nullptr);
+}
+
+void HalDisplay::refreshDisplay(RefreshMode, bool) {
+  if (refreshHook) refreshHook(panel, nullptr, nullptr);
+}
+
+void HalDisplay::deepSleep() {}
+
+uint8_t* HalDisplay::getFrameBuffer() const { return frameBuffer; }
+
+void HalDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
+  copyGrayscaleLsbBuffers(lsbBuffer);
+  copyGrayscaleMsbBuffers(msbBuffer);
+}
+
+void HalDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) { memcpy(lsbPlane, lsbBuffer, sizeof(lsbPlane)); }
+
+void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { memcpy(msbPlane, msbBuffer, sizeof(msbPlane)); }
+
+void HalDisplay::cleanupGrayscaleBuffers(const uint8_t*) {}
+
+void HalDisplay::displayGrayBuffer(bool) {
+  if (refreshHook) refreshHook(panel, lsbPlane, msbPlane);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// Controls for the host implementations of the HAL and FreeRTOS (HostPlatform.cpp, HostStorage.cpp, HostInput.cpp,
+// HostFreeRTOS.cpp), used by the simulator to feed input and observe the panel.
+namespace HostPlatform {
+
+// Directory standing in for the root of the SD card. Defaults to the working directory.
+void setStorageRoot(const std::string& directory);
+
+// Storage traffic since the last reset, summed over every file and the whole-file helpers of HalStorage
+struct StorageCounters {
+  uint64_t filesOpened = 0;
+  uint64_t bytesRead = 0;
+  uint64_t bytesWritten = 0;
+  uint64_t seeks = 0;        // Seeks that moved the position
+  uint64_t bytesSeeked = 0;  // Distance moved by those seeks, in either direction
+};
+StorageCounters getStorageCounters();
+void resetStorageCounters();
+
+// Called whenever the panel would refresh. `frame` is the 1-bit panel image in native 800x480 orientation (bit set =
+// white). For grayscale refreshes `lsb` and `msb` are the two gray planes drawn over it, otherwise both are nullptr.
+using RefreshHook = std::function<void(const uint8_t* frame, const uint8_t* lsb, const uint8_t* msb)>;
+void setRefreshHook(RefreshHook hook);
+
+// Queues a press of one of the HalGPIO::BTN_* buttons, released `heldMs` later. Each HalGPIO::update() consumes one.
+void queueButtonPress(uint8_t buttonIndex, unsigned long heldMs = 0);
+bool hasQueuedButtonPresses();
+
+// Blocks until the task created under this name (with a handle, see xTaskCreate) waits for a notification and has
+// none pending, e.g. until the activity manager's render task has drawn every requested update. Returns at once if
+// there is no such task.
+void waitForTaskIdle(const char* name);
+
+}  // namespace HostPlatform
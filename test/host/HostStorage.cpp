@@ -0,0 +1,422 @@
+#define HAL_STORAGE_IMPL
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <mutex>
+#include <system_error>
+#include <utility>
+
+#include "HostPlatform.h"
+
+// HalStorage over a directory of the host file system, which stands in for the root of the SD card. Paths given to
+// the HAL are absolute SD paths ("/.crosspoint/...") and are resolved below that directory.
+
+namespace fs = std::filesystem;
+
+namespace {
+fs::path storageRoot = fs::current_path();
+std::mutex hostStorageMutex;
+
+// See HostPlatform::StorageCounters. Files are used from several threads, so the counts are atomic.
+std::atomic<uint64_t> filesOpened{0};
+std::atomic<uint64_t> bytesRead{0};
+std::atomic<uint64_t> bytesWritten{0};
+std::atomic<uint64_t> seeks{0};
+std::atomic<uint64_t> bytesSeeked{0};
+
+fs::path hostPath(const char* path) {
+  while (*path == '/') path++;
+  return storageRoot / path;
+}
+
+bool seekTo(std::FILE* file, const long offset, const int whence) {
+  const long before = std::ftell(file);
+  if (std::fseek(file, offset, whence) != 0) return false;
+  const long after = std::ftell(file);
+  if (after != before) {
+    seeks++;
+    bytesSeeked += static_cast<uint64_t>(after > before ? after - before : before - after);
+  }
+  return true;
+}
+}  // namespace
+
+void HostPlatform::setStorageRoot(const std::string& directory) { storageRoot = fs::absolute(directory); }
+
+HostPlatform::StorageCounters HostPlatform::getStorageCounters() {
+  StorageCounters counters;
+  counters.filesOpened = filesOpened;
+  counters.bytesRead = bytesRead;
+  counters.bytesWritten = bytesWritten;
+  counters.seeks = seeks;
+  counters.bytesSeeked = bytesSeeked;
+  return counters;
+}
+
+void HostPlatform::resetStorageCounters() {
+  filesOpened = 0;
+  bytesRead = 0;
+  bytesWritten = 0;
+  seeks = 0;
+  bytesSeeked = 0;
+}
+
+HalStorage HalStorage::instance;
+
+HalStorage::HalStorage() {}
+
+bool HalStorage::begin() {
+  std::error_code ec;
+  fs::create_directories(storageRoot, ec);
+  initialized = fs::is_directory(storageRoot, ec);
+  return initialized;
+}
+
+bool HalStorage::ready() const { return initialized; }
+
+class HalStorage::StorageLock {
+  std::lock_guard<std::mutex> guard{hostStorageMutex};
+};
+
+class HalFile::Impl {
+ public:
+  std::FILE* file = nullptr;
+  fs::path path;
+  bool directory = false;
+  std::vector<fs::path> entries;  // Directory listing, read when the directory is opened
+  size_t nextEntry = 0;
+
+  Impl(fs::path hostPath, const oflag_t oflag) : path(std::move(hostPath)) {
+    std::error_code ec;
+    if (fs::is_directory(path, ec)) {
+      directory = true;
+      for (const auto& entry : fs::directory_iterator(path, ec)) {
+        entries.push_back(entry.path());
+      }
+      std::sort(entries.begin(), entries.end());
+      return;
+    }
+
+    const char* mode = "rb";
+    if ((oflag & O_ACCMODE) != O_RDONLY) {
+      if (oflag & O_TRUNC) {
+        mode = "w+b";
+      } else if (oflag & O_APPEND) {
+        mode = "a+b";
+      } else {
+        mode = (fs::exists(path, ec) || !(oflag & O_CREAT)) ? "r+b" : "w+b";
+      }
+    }
+    file = std::fopen(path.c_str(), mode);
+    if (file) filesOpened++;
+  }
+  ~Impl() { close(); }
+
+  bool close() {
+    if (file) std::fclose(file);
+    const bool wasOpen = file != nullptr || directory;
+    file = nullptr;
+    directory = false;
+    return wasOpen;
+  }
+
+  size_t size() const {
+    if (!file) return 0;
+    const long current = std::ftell(file);
+    std::fseek(file, 0, SEEK_END);
+    const long end = std::ftell(file);
+    std::fseek(file, current, SEEK_SET);
+    return end < 0 ? 0 : static_cast<size_t>(end);
+  }
+};
+
+std::vector<String> HalStorage::listFiles(const char* path, const int maxFiles) {
+  StorageLock lock;
+  std::vector<String> files;
+  std::error_code ec;
+  for (const auto& entry : fs::directory_iterator(hostPath(path), ec)) {
+    if (static_cast<int>(files.size()) >= maxFiles) break;
+    if (entry.is_regular_file()) files.emplace_back(entry.path().filename().string());
+  }
+  return files;
+}
+
+String HalStorage::readFile(const char* path) {
+  StorageLock lock;
+  String content;
+  std::FILE* file = std::fopen(hostPath(path).c_str(), "rb");
+  if (!file) return content;
+  filesOpened++;
+  char buffer[512];
+  size_t n;
+  while ((n = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    bytesRead += n;
+    content.append(buffer, n);
+  }
+  std::fclose(file);
+  return content;
+}
+
+bool HalStorage::readFileToStream(const char* path, Print& out, const size_t chunkSize) {
+  StorageLock lock;
+  std::FILE* file = std::fopen(hostPath(path).c_str(), "rb");
+  if (!file) return false;
+  filesOpened++;
+  std::vector<uint8_t> buffer(chunkSize);
+  size_t n;
+  while ((n = std::fread(buffer.data(), 1, buffer.size(), file)) > 0) {
+    bytesRead += n;
+    out.write(buffer.data(), n);
+  }
+  std::fclose(file);
+  return true;
+}
+
+size_t HalStorage::readFileToBuffer(const char* path, char* buffer, const size_t bufferSize, const size_t maxBytes) {
+  StorageLock lock;
+  if (!buffer || bufferSize == 0) return 0;
+  std::FILE* file = std::fopen(hostPath(path).c_str(), "rb");
+  if (!file) {
+    buffer[0] = '\0';
+    return 0;
+  }
+  filesOpened++;
+  size_t limit = bufferSize - 1;
+  if (maxBytes > 0) limit = std::min(limit, maxBytes);
+  const size_t n = std::fread(buffer, 1, limit, file);
+  bytesRead += n;
+  buffer[n] = '\0';
+  std::fclose(file);
+  return n;
+}
+
+bool HalStorage::writeFile(const char* path, const String& content) {
+  StorageLock lock;
+  std::FILE* file = std::fopen(hostPath(path).c_str(), "wb");
+  if (!file) return false;
+  filesOpened++;
+  const size_t n = std::fwrite(content.data(), 1, content.size(), file);
+  bytesWritten += n;
+  const bool ok = n == content.size();
+  std::fclose(file);
+  return ok;
+}
+
+bool HalStorage::ensureDirectoryExists(const char* path) { return mkdir(path, true); }
+
+HalFile::HalFile() = default;
+
+HalFile::HalFile(std::unique_ptr<Impl> impl) : impl(std::move(impl)) {}
+
+HalFile::~HalFile() = default;
+
+HalFile::HalFile(HalFile&&) = default;
+
+HalFile& HalFile::operator=(HalFile&&) = default;
+
+HalFile HalStorage::open(const char* path, const oflag_t oflag) {
+  StorageLock lock;
+  return HalFile(std::make_unique<HalFile::Impl>(hostPath(path), oflag));
+}
+
+bool HalStorage::mkdir(const char* path, const bool pFlag) {
+  StorageLock lock;
+  std::error_code ec;
+  const fs::path target = hostPath(path);
+  if (pFlag) {
+    fs::create_directories(target, ec);
+  } else {
+    fs::create_directory(target, ec);
+  }
+  return fs::is_directory(target, ec);
+}
+
+bool HalStorage::exists(const char* path) {
+  StorageLock lock;
+  std::error_code ec;
+  return fs::exists(hostPath(path), ec);
+}
+
+bool HalStorage::remove(const char* path) {
+  StorageLock lock;
+  std::error_code ec;
+  const fs::path target = hostPath(path);
+  return fs::is_regular_file(target, ec) && fs::remove(target, ec);
+}
+
+bool HalStorage::rename(const char* oldPath, const char* newPath) {
+  StorageLock lock;
+  std::error_code ec;
+  fs::rename(hostPath(oldPath), hostPath(newPath), ec);
+  return !ec;
+}
+
+bool HalStorage::rmdir(const char* path) {
+  StorageLock lock;
+  std::error_code ec;
+  const fs::path target = hostPath(path);
+  return fs::is_directory(target, ec) && fs::remove(target, ec);
+}
+
+bool HalStorage::openFileForRead([[maybe_unused]] const char* moduleName, const char* path, HalFile& file) {
+  StorageLock lock;
+  std::error_code ec;
+  const fs::path target = hostPath(path);
+  if (!fs::is_regular_file(target, ec)) {
+    LOG_DBG(moduleName, "File does not exist: %s", path);
+    file = HalFile();
+    return false;
+  }
+  file = HalFile(std::make_unique<HalFile::Impl>(target, O_RDONLY));
+  return file.isOpen();
+}
+
+bool HalStorage::openFileForRead(const char* moduleName, const std::string& path, HalFile& file) {
+  return openFileForRead(moduleName, path.c_str(), file);
+}
+
+bool HalStorage::openFileForRead(const char* moduleName, const String& path, HalFile& file) {
+  return openFileForRead(moduleName, path.c_str(), file);
+}
+
+bool HalStorage::openFileForWrite([[maybe_unused]] const char* moduleName, const char* path, HalFile& file) {
+  StorageLock lock;
+  file = HalFile(std::make_unique<HalFile::Impl>(hostPath(path), O_RDWR | O_CREAT | O_TRUNC));
+  if (!file.isOpen()) {
+    LOG_ERR(moduleName, "Failed to open file for writing: %s", path);
+    return false;
+  }
+  return true;
+}
+
+bool HalStorage::openFileForWrite(const char* moduleName, const std::string& path, HalFile& file) {
+  return openFileForWrite(moduleName, path.c_str(), file);
+}
+
+bool HalStorage::openFileForWrite(const char* moduleName, const String& path, HalFile& file) {
+  return openFileForWrite(moduleName, path.c_str(), file);
+}
+
+bool HalStorage::removeDir(const char* path) {
+  StorageLock lock;
+  std::error_code ec;
+  return fs::remove_all(hostPath(path), ec) > 0 && !ec;
+}
+
+// HalFile over stdio. Only the simulator's thread touches a given handle, so unlike the device implementation the
+// calls do not take the storage lock.
+
+void HalFile::flush() {
+  if (impl && impl->file) std::fflush(impl->file);
+}
+
+size_t HalFile::getName(char* name, const size_t len) {
+  if (!impl || len == 0) return 0;
+  const std::string fileName = impl->path.filename().string();
+  const size_t n = std::min(fileName.size(), len - 1);
+  memcpy(name, fileName.data(), n);
+  name[n] = '\0';
+  return n;
+}
+
+size_t HalFile::size() { return impl ? impl->size() : 0; }
+
+size_t HalFile::fileSize() { return size(); }
+
+bool HalFile::seek(const size_t pos) { return seekSet(pos); }
+
+bool HalFile::seekCur(const int64_t offset) {
+  return impl && impl->file && seekTo(impl->file, static_cast<long>(offset), SEEK_CUR);
+}
+
+bool HalFile::seekSet(const size_t offset) {
+  return impl && impl->file && seekTo(impl->file, static_cast<long>(offset), SEEK_SET);
+}
+
+int HalFile::available() const {
+  if (!impl || !impl->file) return 0;
+  const size_t total = impl->size();
+  const size_t current = position();
+  return current < total ? static_cast<int>(std::min<size_t>(total - current, INT32_MAX)) : 0;
+}
+
+size_t HalFile::position() const {
+  if (!impl || !impl->file) return 0;
+  const long current = std::ftell(impl->file);
+  return current < 0 ? 0 : static_cast<size_t>(current);
+}
+
+int HalFile::read(void* buf, const size_t count) {
+  if (!impl || !impl->file) return -1;
+  const size_t n = std::fread(buf, 1, count, impl->file);
+  bytesRead += n;
+  return static_cast<int>(n);
+}
+
+int HalFile::read() {
+  if (!impl || !impl->file) return -1;
+  const int c = std::fgetc(impl->file);
+  if (c == EOF) return -1;
+  bytesRead++;
+  return c;
+}
+
+size_t HalFile::write(const void* buf, const size_t count) {
+  if (!impl || !impl->file) return 0;
+  const size_t n = std::fwrite(buf, 1, count, impl->file);
+  bytesWritten += n;
+  return n;
+}
+
+size_t HalFile::write(const uint8_t b) { return write(&b, 1); }
+
+bool HalFile::rename(const char* newPath) {
+  if (!impl) return false;
+  std::error_code ec;
+  const fs::path target = hostPath(newPath);
+  fs::rename(impl->path, target, ec);
+  if (ec) return false;
+  impl->path = target;
+  return true;
+}
+
+bool HalFile::getModifyDateTime(uint16_t* pdate, uint16_t* ptime) {
+  struct stat st {};
+  if (!impl || ::stat(impl->path.c_str(), &st) != 0) return false;
+  // FAT timestamps are local time with two second resolution; the host's UTC stands in for it
+  std::tm tm{};
+  gmtime_r(&st.st_mtime, &tm);
+  *pdate = static_cast<uint16_t>((tm.tm_year - 80) << 9 | (tm.tm_mon + 1) << 5 | tm.tm_mday);
+  *ptime = static_cast<uint16_t>(tm.tm_hour << 11 | tm.tm_min << 5 | tm.tm_sec / 2);
+  return true;
+}
+
+uint32_t HalFile::firstSector() const {
+  // Stands in for where the file's data starts on the card: the inode changes whenever the file is recreated
+  struct stat st {};
+  return impl && ::stat(impl->path.c_str(), &st) == 0 ? static_cast<uint32_t>(st.st_ino) : 0;
+}
+
+bool HalFile::isDirectory() const { return impl && impl->directory; }
+
+void HalFile::rewindDirectory() {
+  if (impl) impl->nextEntry = 0;
+}
+
+bool HalFile::close() { return impl && impl->close(); }
+
+HalFile HalFile::openNextFile() {
+  if (!impl || !impl->directory || impl->nextEntry >= impl->entries.size()) return HalFile();
+  return HalFile(std::make_unique<Impl>(impl->entries[impl->nextEntry++], O_RDONLY));
+}
+
+bool HalFile::isOpen() const { return impl != nullptr && (impl->file != nullptr || impl->directory); }
+
+HalFile::operator bool() const { return isOpen(); }
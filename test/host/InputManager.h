@@ -0,0 +1,4 @@
+#pragma once
+
+// Button driver of the X4; the host feeds HalGPIO from a script instead (see HostInput.cpp), so nothing is declared.
+class InputManager {};
@@ -0,0 +1,5 @@
+#pragma once
+
+// Declarations only: enough for the web server's header to parse. The simulator replaces the network activities (see
+// test/simulator/StandIns.cpp), so nothing on the host talks to a network.
+class NetworkUDP {};
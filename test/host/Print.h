@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "WString.h"
+
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t b) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char* str) { return write(reinterpret_cast<const uint8_t*>(str), strlen(str)); }
+  size_t print(const char* str) { return write(str); }
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(nullptr, 0, format, args);
+    va_end(args);
+    if (length <= 0) return 0;
+    std::string text(length, '\0');
+    va_start(args, format);
+    vsnprintf(text.data(), text.size() + 1, format, args);
+    va_end(args);
+    return write(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+  }
+  virtual void flush() {}
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+class String : public std::string {
+ public:
+  using std::string::string;
+  String() = default;
+  String(const std::string& str) : std::string(str) {}
+  explicit String(const int value) : std::string(std::to_string(value)) {}
+  explicit String(const unsigned int value) : std::string(std::to_string(value)) {}
+  explicit String(const long value) : std::string(std::to_string(value)) {}
+  explicit String(const unsigned long value) : std::string(std::to_string(value)) {}
+  bool isEmpty() const { return empty(); }
+  bool startsWith(const String& prefix) const { return starts_with(prefix); }
+  bool endsWith(const String& suffix) const { return ends_with(suffix); }
+  void toLowerCase() {
+    std::transform(begin(), end(), begin(), [](const unsigned char c) { return std::tolower(c); });
+  }
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <WString.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// One request and the response to it, for host checks of code that answers through the web server (see
+// test/file_response). The simulator only needs the declaration, see NetworkUdp.h. Header names are matched exactly.
+
+class NetworkClient {
+ public:
+  explicit NetworkClient(std::string* body = nullptr) : body(body) {}
+  size_t write(const uint8_t* data, const size_t length) {
+    if (body) body->append(reinterpret_cast<const char*>(data), length);
+    return length;
+  }
+
+ private:
+  std::string* body;
+};
+
+class WebServer {
+ public:
+  // The request
+  std::map<std::string, String> requestHeaders;
+
+  // The response
+  int status = 0;
+  String contentType;
+  std::vector<std::pair<String, String>> responseHeaders;
+  size_t contentLength = 0;
+  std::string body;
+
+  bool hasHeader(const String& name) const { return requestHeaders.count(name) != 0; }
+  String header(const String& name) const {
+    const auto it = requestHeaders.find(name);
+    return it == requestHeaders.end() ? String("") : it->second;
+  }
+  void sendHeader(const String& name, const String& value) { responseHeaders.emplace_back(name, value); }
+  void setContentLength(const size_t length) { contentLength = length; }
+  void send(const int code, const char* type = "", const String& content = String("")) {
+    status = code;
+    contentType = type;
+    body += content;
+  }
+  NetworkClient client() { return NetworkClient(&body); }
+
+  // A response header, empty if it was not sent
+  String responseHeader(const String& name) const {
+    for (const auto& [headerName, value] : responseHeaders) {
+      if (headerName == name) return value;
+    }
+    return String("");
+  }
+};
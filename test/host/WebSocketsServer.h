@@ -0,0 +1,5 @@
+#pragma once
+
+// Declarations only, see NetworkUdp.h
+enum WStype_t { WStype_ERROR, WStype_DISCONNECTED, WStype_CONNECTED, WStype_TEXT, WStype_BIN };
+class WebSocketsServer {};
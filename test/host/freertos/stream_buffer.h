@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+#include "FreeRTOS.h"
+
+typedef void* StreamBufferHandle_t;
+
+// Implemented in HostFreeRTOS.cpp
+StreamBufferHandle_t xStreamBufferCreate(size_t bufferSize, size_t triggerLevel);
+size_t xStreamBufferSend(StreamBufferHandle_t buffer, const void* data, size_t length, TickType_t ticksToWait);
+size_t xStreamBufferReceive(StreamBufferHandle_t buffer, void* data, size_t length, TickType_t ticksToWait);
+void vStreamBufferDelete(StreamBufferHandle_t buffer);
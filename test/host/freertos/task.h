@@ -0,0 +1,29 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef enum { eNoAction, eSetBits, eIncrement, eSetValueWithOverwrite, eSetValueWithoutOverwrite } eNotifyAction;
+
+#define tskIDLE_PRIORITY 0
+
+// Implemented in HostFreeRTOS.cpp. Tasks run on detached std::threads; the stack size and priority are ignored, and
+// vTaskDelete(nullptr) only marks the end of the task function, which then returns. A handle handed out by
+// xTaskCreate stays valid after its task has ended.
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth, void* parameters,
+                       UBaseType_t priority, TaskHandle_t* createdTask);
+void vTaskDelete(TaskHandle_t task);
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+// Threads not started by xTaskCreate, such as the main thread, get a handle on first use
+TaskHandle_t xTaskGetCurrentTaskHandle();
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
+
+// One lock for every critical section; the mux argument is ignored
+void vTaskEnterCritical();
+void vTaskExitCritical();
+#define taskENTER_CRITICAL(mux) vTaskEnterCritical()
+#define taskEXIT_CRITICAL(mux) vTaskExitCritical()
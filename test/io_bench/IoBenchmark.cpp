@@ -0,0 +1,130 @@
+#include <EpdFontFamily.h>
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalStorage.h>
+#include <builtinFonts/all.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "HostPlatform.h"
+#include "fontIds.h"
+
+// Indexes EPUBs from scratch on the host storage and reports what each stage costs the SD card: files opened, bytes
+// read and written, and the seeks in between. Opening the book builds its metadata cache, then every spine item is
+// laid out into its section file with the default reader settings, as the reader and book ingest do on the device.
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr int FONT_ID = BOOKERLY_14_FONT_ID;
+// Default reader settings, see CrossPointSettings.h and EpubReaderActivity::settingsLayout
+constexpr float LINE_COMPRESSION = 1.0f;
+constexpr bool EXTRA_PARAGRAPH_SPACING = true;
+constexpr uint8_t PARAGRAPH_ALIGNMENT = 0;  // CrossPointSettings::JUSTIFIED
+constexpr bool EMBEDDED_STYLE = true;
+constexpr bool HYPHENATION = false;
+constexpr int SCREEN_MARGIN = 5;
+constexpr int STATUS_BAR_HEIGHT = 19;
+
+HostPlatform::StorageCounters total;
+
+void report(const char* stage, const HostPlatform::StorageCounters& counters) {
+  using ull = unsigned long long;
+  std::printf("  %-10s %8llu %12llu %12llu %8llu %12llu\n", stage, static_cast<ull>(counters.filesOpened),
+              static_cast<ull>(counters.bytesRead), static_cast<ull>(counters.bytesWritten),
+              static_cast<ull>(counters.seeks), static_cast<ull>(counters.bytesSeeked));
+}
+
+// Reports the traffic since the previous stage and adds it to the total
+void endStage(const char* stage) {
+  const auto counters = HostPlatform::getStorageCounters();
+  HostPlatform::resetStorageCounters();
+  report(stage, counters);
+  total.filesOpened += counters.filesOpened;
+  total.bytesRead += counters.bytesRead;
+  total.bytesWritten += counters.bytesWritten;
+  total.seeks += counters.seeks;
+  total.bytesSeeked += counters.bytesSeeked;
+}
+
+bool indexBook(GfxRenderer& renderer, const std::string& sdRoot, const std::string& bookPath) {
+  const std::string sdBookPath = "/" + fs::path(bookPath).filename().string();
+  std::error_code ec;
+  fs::copy_file(bookPath, fs::path(sdRoot) / fs::path(bookPath).filename(), fs::copy_options::update_existing, ec);
+
+  auto epub = std::make_shared<Epub>(sdBookPath, "/.crosspoint");
+  epub->clearCache();
+  HostPlatform::resetStorageCounters();
+  total = {};
+
+  std::printf("%s\n  %-10s %8s %12s %12s %8s %12s\n", sdBookPath.c_str() + 1, "stage", "opened", "read B",
+              "written B", "seeks", "seeked B");
+  if (!epub->load(true)) {
+    std::fprintf(stderr, "failed to load %s\n", bookPath.c_str());
+    return false;
+  }
+  epub->loadResidentTables();
+  endStage("metadata");
+
+  const uint16_t viewportWidth = renderer.getScreenWidth() - 2 * SCREEN_MARGIN;
+  const uint16_t viewportHeight =
+      renderer.getScreenHeight() - SCREEN_MARGIN - std::max(SCREEN_MARGIN, STATUS_BAR_HEIGHT);
+  for (int i = 0; i < epub->getSpineItemsCount(); i++) {
+    Section section(epub, i, renderer);
+    if (!section.createSectionFile(FONT_ID, LINE_COMPRESSION, EXTRA_PARAGRAPH_SPACING, PARAGRAPH_ALIGNMENT,
+                                   viewportWidth, viewportHeight, HYPHENATION, EMBEDDED_STYLE)) {
+      std::fprintf(stderr, "failed to build section %d of %s\n", i, bookPath.c_str());
+      return false;
+    }
+  }
+  endStage("sections");
+  report("total", total);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::fprintf(stderr, "usage: %s sd-root book.epub...\n", argv[0]);
+    return 1;
+  }
+
+  HostPlatform::setStorageRoot(argv[1]);
+  if (!Storage.begin()) {
+    std::fprintf(stderr, "cannot use %s as SD root\n", argv[1]);
+    return 1;
+  }
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+  renderer.setOrientation(GfxRenderer::Portrait);
+
+  FontDecompressor fontDecompressor;
+  if (!fontDecompressor.init()) {
+    std::fprintf(stderr, "Font decompressor init failed\n");
+    return 1;
+  }
+  EpdFont regular(&bookerly_14_regular);
+  EpdFont bold(&bookerly_14_bold);
+  EpdFont italic(&bookerly_14_italic);
+  EpdFont boldItalic(&bookerly_14_bolditalic);
+  renderer.setFontDecompressor(&fontDecompressor);
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+
+  int failures = 0;
+  for (int i = 2; i < argc; i++) {
+    if (!indexBook(renderer, argv[1], argv[i])) failures++;
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,228 @@
+#include <EpdFontFamily.h>
+#include <Epub/LayoutScratch.h>
+#include <Epub/ParsedText.h>
+#include <Epub/WordWidthCache.h>
+#include <Epub/hyphenation/Hyphenator.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/all.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Lays out every <p> of the given XHTML files (see test/run_layout_bench.sh, which extracts them from test/epubs) as
+// justified Bookerly 14 on a portrait page, with and without hyphenation. Reports the time per paragraph and the
+// quality of the result: the leftover space the justification has to spread over the gaps of each full line.
+
+namespace {
+
+constexpr int FONT_ID = 1;
+constexpr uint16_t PAGE_WIDTH = 460;
+
+struct Paragraph {
+  std::vector<std::string> words;
+};
+
+// Appends the UTF-8 encoding of a codepoint
+void appendUtf8(std::string& out, const uint32_t cp) {
+  if (cp < 0x80) {
+    out.push_back(static_cast<char>(cp));
+  } else if (cp < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  } else if (cp < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+  }
+}
+
+// Plain text of an XHTML fragment: tags dropped and the common entities decoded
+std::string plainText(const std::string& html) {
+  std::string text;
+  for (size_t i = 0; i < html.size(); i++) {
+    if (html[i] == '<') {
+      const size_t close = html.find('>', i);
+      if (close == std::string::npos) break;
+      i = close;
+      continue;
+    }
+    if (html[i] == '&') {
+      const size_t semicolon = html.find(';', i);
+      if (semicolon != std::string::npos && semicolon - i <= 8) {
+        const std::string entity = html.substr(i + 1, semicolon - i - 1);
+        if (entity == "amp") text += '&';
+        else if (entity == "lt") text += '<';
+        else if (entity == "gt") text += '>';
+        else if (entity == "quot") text += '"';
+        else if (entity == "apos") text += '\'';
+        else if (entity == "nbsp") appendUtf8(text, 0xA0);
+        else if (entity[0] == '#' && entity.size() > 1 && (entity[1] == 'x' || entity[1] == 'X'))
+          appendUtf8(text, std::strtoul(entity.c_str() + 2, nullptr, 16));
+        else if (entity[0] == '#')
+          appendUtf8(text, std::strtoul(entity.c_str() + 1, nullptr, 10));
+        i = semicolon;
+        continue;
+      }
+    }
+    text += html[i];
+  }
+  return text;
+}
+
+void loadParagraphs(const char* path, std::vector<Paragraph>& paragraphs) {
+  std::ifstream in(path, std::ios::binary);
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  const std::string html = buffer.str();
+
+  size_t pos = 0;
+  while ((pos = html.find("<p", pos)) != std::string::npos) {
+    if (pos + 2 < html.size() && html[pos + 2] != '>' && html[pos + 2] != ' ') {
+      pos += 2;
+      continue;
+    }
+    const size_t end = html.find("</p>", pos);
+    if (end == std::string::npos) break;
+
+    Paragraph paragraph;
+    std::istringstream words(plainText(html.substr(pos, end - pos)));
+    std::string word;
+    while (words >> word) {
+      paragraph.words.push_back(word);
+    }
+    if (!paragraph.words.empty()) {
+      paragraphs.push_back(std::move(paragraph));
+    }
+    pos = end;
+  }
+}
+
+struct Result {
+  size_t lines = 0;
+  size_t splitLines = 0;
+  double slackSum = 0;
+  double slackSquaredSum = 0;
+  double nsPerParagraph = 0;
+};
+
+// Each pass over the chapters lays out in one LayoutScratch, as a section parse does. With `cached`, it also measures
+// through one WordWidthCache.
+Result run(const GfxRenderer& renderer, const std::vector<Paragraph>& paragraphs, const bool hyphenation,
+           const bool cached, const int iterations) {
+  Result result;
+  const int spaceWidth = renderer.getSpaceWidth(FONT_ID, EpdFontFamily::REGULAR);
+
+  // Quality pass: natural width of every full line against the page width
+  WordWidthCache qualityCache;
+  LayoutScratch qualityScratch;
+  for (const auto& paragraph : paragraphs) {
+    ParsedText text(false, hyphenation);
+    for (const auto& word : paragraph.words) {
+      text.addWord(word, EpdFontFamily::REGULAR);
+    }
+    std::vector<std::shared_ptr<TextBlock>> lines;
+    text.layoutAndExtractLines(
+        renderer, FONT_ID, PAGE_WIDTH, [&lines](const std::shared_ptr<TextBlock>& line) { lines.push_back(line); },
+        true, cached ? &qualityCache : nullptr, &qualityScratch);
+    for (size_t i = 0; i + 1 < lines.size(); i++) {
+      const auto& words = lines[i]->getWords();
+      int natural = 0;
+      for (const auto& word : words) {
+        natural += renderer.getTextAdvanceX(FONT_ID, word.c_str(), EpdFontFamily::REGULAR);
+      }
+      natural += static_cast<int>(words.size() - 1) * spaceWidth;
+      // The paragraph indent is an em space in front of the first word, the same width on every run
+      const double slack = PAGE_WIDTH - natural;
+      result.lines++;
+      result.slackSum += slack;
+      result.slackSquaredSum += slack * slack;
+      if (!words.empty() && !words.back().empty() && words.back().back() == '-') {
+        result.splitLines++;
+      }
+    }
+  }
+
+  // Best of several rounds, so that other load on the host does not end up in the figure
+  constexpr int ROUNDS = 5;
+  double bestNs = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterations; iteration++) {
+      WordWidthCache widthCache;
+      LayoutScratch scratch;
+      for (const auto& paragraph : paragraphs) {
+        ParsedText text(false, hyphenation);
+        for (const auto& word : paragraph.words) {
+          text.addWord(word, EpdFontFamily::REGULAR);
+        }
+        text.layoutAndExtractLines(renderer, FONT_ID, PAGE_WIDTH, [](const std::shared_ptr<TextBlock>&) {}, true,
+                                   cached ? &widthCache : nullptr, &scratch);
+      }
+    }
+    const double elapsedNs =
+        std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (round == 0 || elapsedNs < bestNs) {
+      bestNs = elapsedNs;
+    }
+  }
+  result.nsPerParagraph = bestNs / (static_cast<double>(iterations) * paragraphs.size());
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int iterations = 20;
+  std::vector<Paragraph> paragraphs;
+  for (int i = 1; i < argc; i++) {
+    if (std::string(argv[i]) == "-n" && i + 1 < argc) {
+      iterations = std::atoi(argv[++i]);
+    } else {
+      loadParagraphs(argv[i], paragraphs);
+    }
+  }
+  if (paragraphs.empty()) {
+    std::fprintf(stderr, "usage: %s [-n iterations] chapter.xhtml...\n", argv[0]);
+    return 1;
+  }
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  renderer.begin();
+
+  EpdFont regular(&bookerly_14_regular);
+  EpdFont bold(&bookerly_14_bold);
+  EpdFont italic(&bookerly_14_italic);
+  EpdFont boldItalic(&bookerly_14_bolditalic);
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+  Hyphenator::setPreferredLanguage("en");
+
+  size_t wordCount = 0;
+  for (const auto& paragraph : paragraphs) {
+    wordCount += paragraph.words.size();
+  }
+  std::printf("%zu paragraphs, %zu words, page width %d\n", paragraphs.size(), wordCount, PAGE_WIDTH);
+  std::printf("%-12s %-12s %8s %8s %12s %14s %14s\n", "hyphenation", "width cache", "lines", "split", "mean slack",
+              "slack^2/line", "us/paragraph");
+  for (const bool hyphenation : {false, true}) {
+    for (const bool cached : {false, true}) {
+      const Result result = run(renderer, paragraphs, hyphenation, cached, iterations);
+      std::printf("%-12s %-12s %8zu %8zu %12.2f %14.1f %14.2f\n", hyphenation ? "on" : "off", cached ? "on" : "off",
+                  result.lines, result.splitLines, result.slackSum / result.lines,
+                  result.slackSquaredSum / result.lines, result.nsPerParagraph / 1000);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/all.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Renders a full page of Bookerly 14 into the host RAM framebuffer and reports the cost of drawing one glyph for each
+// orientation and render pass. Text is shaped once up front so the timing covers glyph bitmap lookup and blitting.
+// The framebuffer checksum printed alongside lets rendering changes be checked for pixel-identical output.
+
+namespace {
+
+constexpr int FONT_ID = 1;
+constexpr int MARGIN = 10;
+
+const char* const kSampleText =
+    "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, "
+    "it was the epoch of belief, it was the epoch of incredulity, it was the season of Light, it was the season of "
+    "Darkness, it was the spring of hope, it was the winter of despair, we had everything before us, we had nothing "
+    "before us, we were all going direct to Heaven, we were all going direct the other way \xe2\x80\x93 in short, the "
+    "period was so far like the present period, that some of its noisiest authorities insisted on its being "
+    "received, for good or for evil, in the superlative degree of comparison only. ";
+
+struct ShapedLine {
+  int y;
+  std::vector<ShapedGlyph> glyphs;
+};
+
+// Greedy word wrap of the sample text (repeated as needed) until the page is full
+std::vector<ShapedLine> layoutPage(const GfxRenderer& renderer) {
+  std::vector<ShapedLine> lines;
+  const int maxWidth = renderer.getScreenWidth() - 2 * MARGIN;
+  const int lineHeight = renderer.getLineHeight(FONT_ID);
+  const std::string text = kSampleText;
+
+  size_t wordStart = 0;
+  std::string line;
+  for (int y = MARGIN; y + lineHeight <= renderer.getScreenHeight() - MARGIN; y += lineHeight) {
+    line.clear();
+    while (true) {
+      const size_t wordEnd = text.find(' ', wordStart);
+      const std::string word = text.substr(wordStart, wordEnd - wordStart);
+      const std::string candidate = line.empty() ? word : line + " " + word;
+      if (!line.empty() && renderer.getTextWidth(FONT_ID, candidate.c_str()) > maxWidth) {
+        break;
+      }
+      line = candidate;
+      wordStart = wordEnd + 1 < text.size() ? wordEnd + 1 : 0;
+    }
+
+    ShapedLine shaped;
+    shaped.y = y;
+    renderer.shapeText(FONT_ID, line.c_str(), EpdFontFamily::REGULAR, shaped.glyphs);
+    lines.push_back(std::move(shaped));
+  }
+  return lines;
+}
+
+uint64_t checksum(const uint8_t* data, const size_t size) {
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ data[i]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 200;
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  renderer.begin();
+
+  FontDecompressor fontDecompressor;
+  if (!fontDecompressor.init()) {
+    std::fprintf(stderr, "Font decompressor init failed\n");
+    return 1;
+  }
+  EpdFont regular(&bookerly_14_regular);
+  EpdFont bold(&bookerly_14_bold);
+  EpdFont italic(&bookerly_14_italic);
+  EpdFont boldItalic(&bookerly_14_bolditalic);
+  renderer.setFontDecompressor(&fontDecompressor);
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+
+  const struct {
+    GfxRenderer::Orientation orientation;
+    const char* name;
+  } orientations[] = {
+      {GfxRenderer::Portrait, "Portrait"},
+      {GfxRenderer::LandscapeClockwise, "LandscapeClockwise"},
+      {GfxRenderer::PortraitInverted, "PortraitInverted"},
+      {GfxRenderer::LandscapeCounterClockwise, "LandscapeCounterClockwise"},
+  };
+  const struct {
+    GfxRenderer::RenderMode mode;
+    const char* name;
+  } passes[] = {
+      {GfxRenderer::BW, "BW"},
+      {GfxRenderer::GRAYSCALE_LSB, "LSB"},
+      {GfxRenderer::GRAYSCALE_MSB, "MSB"},
+  };
+
+  std::printf("%-26s %-4s %8s %12s %18s\n", "orientation", "pass", "glyphs", "ns/glyph", "checksum");
+  for (const auto& orientation : orientations) {
+    renderer.setOrientation(orientation.orientation);
+    const std::vector<ShapedLine> lines = layoutPage(renderer);
+    size_t glyphCount = 0;
+    for (const auto& line : lines) {
+      glyphCount += line.glyphs.size();
+    }
+
+    for (const auto& pass : passes) {
+      renderer.setRenderMode(pass.mode);
+      const auto renderPage = [&] {
+        renderer.clearScreen(pass.mode == GfxRenderer::BW ? 0xFF : 0x00);
+        for (const auto& line : lines) {
+          renderer.drawShapedText(FONT_ID, MARGIN, line.y, line.glyphs.data(), line.glyphs.size());
+        }
+      };
+
+      renderPage();  // warm the decompressed glyph cache
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; i++) {
+        renderPage();
+      }
+      const double elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+      std::printf("%-26s %-4s %8zu %12.1f %18.16llx\n", orientation.name, pass.name, glyphCount,
+                  elapsedNs / (static_cast<double>(iterations) * glyphCount),
+                  static_cast<unsigned long long>(checksum(renderer.getFrameBuffer(), GfxRenderer::getBufferSize())));
+    }
+  }
+  renderer.setRenderMode(GfxRenderer::BW);
+
+  return 0;
+}
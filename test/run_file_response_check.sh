@@ -0,0 +1,51 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/file_response"
+BINARY="$BUILD_DIR/FileResponseCheck"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/file_response/FileResponseCheck.cpp"
+  "$ROOT_DIR/test/host/HostPlatform.cpp"
+  "$ROOT_DIR/test/host/HostFreeRTOS.cpp"
+  "$ROOT_DIR/test/host/HostStorage.cpp"
+  "$ROOT_DIR/src/network/FileResponse.cpp"
+  "$ROOT_DIR/lib/Logging/Logging.cpp"
+)
+
+INCLUDES=(
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/src"
+  -I"$ROOT_DIR/lib"
+  -I"$ROOT_DIR/lib/hal"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/Logging"
+)
+
+# The web server is the recording stand-in of test/host/WebServer.h
+DEFINES=(
+  -DCROSSPOINT_EMULATED=1
+  -DENABLE_SERIAL_LOG
+  -DLOG_LEVEL="${LOG_LEVEL:-0}"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -ffunction-sections
+  -fdata-sections
+  -pthread
+  "${DEFINES[@]}"
+  "${INCLUDES[@]}"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -Wl,--gc-sections -o "$BINARY"
+
+rm -rf "$BUILD_DIR/sd"
+"$BINARY" "$BUILD_DIR/sd"
@@ -0,0 +1,36 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/font_bench"
+BINARY="$BUILD_DIR/FontBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+# One BUILTIN_FONT(name) line per font defined in builtinFonts/
+grep -ho 'static const EpdFontData [A-Za-z0-9_]*' "$ROOT_DIR"/lib/EpdFont/builtinFonts/*.h |
+  awk '{ print "BUILTIN_FONT(" $4 ")" }' | sort >"$BUILD_DIR/BuiltinFontList.inc"
+
+SOURCES=(
+  "$ROOT_DIR/test/font_bench/FontBenchmark.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+INCLUDES=(
+  -I"$BUILD_DIR"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/Utf8"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  "${INCLUDES[@]}"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
@@ -0,0 +1,120 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/io_bench"
+OBJ_DIR="$BUILD_DIR/obj"
+BINARY="$BUILD_DIR/IoBenchmark"
+
+mkdir -p "$OBJ_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/io_bench/IoBenchmark.cpp"
+  "$ROOT_DIR/test/host/HostPlatform.cpp"
+  "$ROOT_DIR/test/host/HostFreeRTOS.cpp"
+  "$ROOT_DIR/test/host/HostStorage.cpp"
+  "$ROOT_DIR/test/host/HostImageDecoders.cpp"
+  "$ROOT_DIR/lib/Epub/Epub.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/BookMetadataCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/Page.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/ParsedText.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/WordWidthCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/Section.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/SectionLayoutCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/SectionPipeline.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/htmlEntities.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/ImageBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/converters/ImageToFramebufferDecoder.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/css/CssParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/ContainerParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/ContentOpfParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/TocNavParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/TocNcxParser.cpp"
+  "$ROOT_DIR/lib/FsHelpers/FsHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/InflateReader/InflateReader.cpp"
+  "$ROOT_DIR/lib/Logging/Logging.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$ROOT_DIR/lib/ZipFile/ZipFile.cpp"
+)
+
+C_SOURCES=(
+  "$ROOT_DIR/lib/uzlib/src/tinflate.c"
+  "$ROOT_DIR/lib/expat/xmlparse.c"
+  "$ROOT_DIR/lib/expat/xmlrole.c"
+  "$ROOT_DIR/lib/expat/xmltok.c"
+)
+
+INCLUDES=(
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/src"
+  -I"$ROOT_DIR/lib"
+  -I"$ROOT_DIR/lib/Epub"
+  -I"$ROOT_DIR/lib/hal"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/lib/InflateReader"
+  -I"$ROOT_DIR/lib/JpegToBmpConverter"
+  -I"$ROOT_DIR/lib/PngToBmpConverter"
+  -I"$ROOT_DIR/lib/uzlib/src"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/ZipFile"
+  -I"$ROOT_DIR/lib/expat"
+)
+
+# The libraries log to stdout like to the device's serial port, errors only unless LOG_LEVEL is set. Cover and
+# thumbnail generation are not exercised, so their converters are dropped at link time.
+DEFINES=(
+  -DCROSSPOINT_EMULATED=1
+  -DENABLE_SERIAL_LOG
+  -DLOG_LEVEL="${LOG_LEVEL:-0}"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -ffunction-sections
+  -fdata-sections
+  -pthread
+  "${DEFINES[@]}"
+  "${INCLUDES[@]}"
+)
+
+CFLAGS=(
+  -O2
+  -ffunction-sections
+  -fdata-sections
+  # Same expat configuration as platformio.ini
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+  "${INCLUDES[@]}"
+)
+
+OBJECTS=()
+for source in "${C_SOURCES[@]}"; do
+  object="$OBJ_DIR/$(basename "$source").o"
+  cc "${CFLAGS[@]}" -c "$source" -o "$object"
+  OBJECTS+=("$object")
+done
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${OBJECTS[@]}" -Wl,--gc-sections -o "$BINARY"
+
+# The test books, unless books are given on the command line. Each is indexed from scratch.
+if [[ $# -eq 0 ]]; then
+  "$BINARY" "$BUILD_DIR/sd" "$ROOT_DIR"/test/epubs/*.epub
+else
+  "$BINARY" "$BUILD_DIR/sd" "$@"
+fi
@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/layout_bench"
+BINARY="$BUILD_DIR/LayoutBenchmark"
+TEXT_DIR="$BUILD_DIR/text"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/layout_bench/LayoutBenchmark.cpp"
+  "$ROOT_DIR/test/host/HostPlatform.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/ParsedText.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/WordWidthCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+INCLUDES=(
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib"
+  -I"$ROOT_DIR/lib/Epub"
+  -I"$ROOT_DIR/lib/hal"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/InflateReader"
+  -I"$ROOT_DIR/lib/uzlib/src"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Serialization"
+)
+
+# Rendering, glyph decompression and file access are not exercised here, so unreferenced sections are dropped at link
+# time instead of building those layers for the host.
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -ffunction-sections
+  -fdata-sections
+  "${INCLUDES[@]}"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -Wl,--gc-sections -o "$BINARY"
+
+# Chapters of the test books, unless files are given on the command line
+if [[ $# -eq 0 || "$1" == "-n" ]]; then
+  rm -rf "$TEXT_DIR"
+  mkdir -p "$TEXT_DIR"
+  for epub in "$ROOT_DIR"/test/epubs/*.epub; do
+    unzip -q -o "$epub" '*.xhtml' '*.html' -d "$TEXT_DIR/$(basename "$epub" .epub)" 2>/dev/null || true
+  done
+  mapfile -t CHAPTERS < <(find "$TEXT_DIR" -name '*.xhtml' -o -name '*.html' | sort)
+  "$BINARY" "$@" "${CHAPTERS[@]}"
+else
+  "$BINARY" "$@"
+fi
@@ -0,0 +1,64 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/render_bench"
+BINARY="$BUILD_DIR/RenderBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/render_bench/RenderBenchmark.cpp"
+  "$ROOT_DIR/test/host/HostPlatform.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/InflateReader/InflateReader.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+C_SOURCES=(
+  "$ROOT_DIR/lib/uzlib/src/tinflate.c"
+)
+
+INCLUDES=(
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/lib/hal"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/InflateReader"
+  -I"$ROOT_DIR/lib/uzlib/src"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/Logging"
+)
+
+# Bitmap drawing and file access are not exercised here, so unreferenced sections are dropped at link time instead of
+# building the storage layer for the host.
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -ffunction-sections
+  -fdata-sections
+  "${INCLUDES[@]}"
+)
+
+CFLAGS=(
+  -O2
+  -ffunction-sections
+  -fdata-sections
+  "${INCLUDES[@]}"
+)
+
+OBJECTS=()
+for source in "${C_SOURCES[@]}"; do
+  object="$BUILD_DIR/$(basename "$source").o"
+  cc "${CFLAGS[@]}" -c "$source" -o "$object"
+  OBJECTS+=("$object")
+done
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${OBJECTS[@]}" -Wl,--gc-sections -o "$BINARY"
+
+"$BINARY" "$@"
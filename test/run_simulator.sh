@@ -0,0 +1,182 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/simulator"
+OBJ_DIR="$BUILD_DIR/obj"
+I18N_DIR="$BUILD_DIR/i18n"
+BINARY="$BUILD_DIR/Simulator"
+
+mkdir -p "$OBJ_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/simulator/Simulator.cpp"
+  "$ROOT_DIR/test/simulator/StandIns.cpp"
+  "$ROOT_DIR/test/host/HostPlatform.cpp"
+  "$ROOT_DIR/test/host/HostFreeRTOS.cpp"
+  "$ROOT_DIR/test/host/HostStorage.cpp"
+  "$ROOT_DIR/test/host/HostInput.cpp"
+  "$ROOT_DIR/test/host/HostImageDecoders.cpp"
+  "$ROOT_DIR/src/CrossPointSettings.cpp"
+  "$ROOT_DIR/src/CrossPointState.cpp"
+  "$ROOT_DIR/src/LibraryCatalog.cpp"
+  "$ROOT_DIR/src/MappedInputManager.cpp"
+  "$ROOT_DIR/src/RecentBooksStore.cpp"
+  "$ROOT_DIR/src/activities/Activity.cpp"
+  "$ROOT_DIR/src/activities/ActivityManager.cpp"
+  "$ROOT_DIR/src/activities/home/HomeActivity.cpp"
+  "$ROOT_DIR/src/activities/home/MyLibraryActivity.cpp"
+  "$ROOT_DIR/src/activities/home/RecentBooksActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/EpubReaderActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/EpubReaderChapterSelectionActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/EpubReaderFootnotesActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/EpubReaderMenuActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/EpubReaderPercentSelectionActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/QrDisplayActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/ReaderActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/SectionPrefetcher.cpp"
+  "$ROOT_DIR/src/activities/reader/TxtReaderActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/XtcReaderActivity.cpp"
+  "$ROOT_DIR/src/activities/reader/XtcReaderChapterSelectionActivity.cpp"
+  "$ROOT_DIR/src/activities/util/BmpViewerActivity.cpp"
+  "$ROOT_DIR/src/activities/util/ConfirmationActivity.cpp"
+  "$ROOT_DIR/src/activities/util/FullScreenMessageActivity.cpp"
+  "$ROOT_DIR/src/components/UITheme.cpp"
+  "$ROOT_DIR/src/components/themes/BaseTheme.cpp"
+  "$ROOT_DIR/src/components/themes/lyra/Lyra3CoversTheme.cpp"
+  "$ROOT_DIR/src/components/themes/lyra/LyraTheme.cpp"
+  "$ROOT_DIR/src/network/BookIngest.cpp"
+  "$ROOT_DIR/src/network/UploadWriter.cpp"
+  "$ROOT_DIR/src/util/ButtonNavigator.cpp"
+  "$ROOT_DIR/src/util/ScreenshotUtil.cpp"
+  "$ROOT_DIR/src/util/StringUtils.cpp"
+  "$ROOT_DIR/lib/Epub/Epub.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/BookMetadataCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/Page.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/ParsedText.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/WordWidthCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/Section.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/SectionLayoutCache.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/SectionPipeline.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/htmlEntities.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/ImageBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/converters/ImageToFramebufferDecoder.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/css/CssParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/ChapterHtmlSlimParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/ContainerParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/ContentOpfParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/TocNavParser.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/parsers/TocNcxParser.cpp"
+  "$ROOT_DIR/lib/FsHelpers/FsHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/I18n/I18n.cpp"
+  "$ROOT_DIR/lib/InflateReader/InflateReader.cpp"
+  "$ROOT_DIR/lib/JpegToBmpConverter/JpegToBmpConverter.cpp"
+  "$ROOT_DIR/lib/Logging/Logging.cpp"
+  "$ROOT_DIR/lib/PngToBmpConverter/PngToBmpConverter.cpp"
+  "$ROOT_DIR/lib/Txt/Txt.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$ROOT_DIR/lib/Xtc/Xtc.cpp"
+  "$ROOT_DIR/lib/Xtc/Xtc/XtcPanelWriter.cpp"
+  "$ROOT_DIR/lib/Xtc/Xtc/XtcParser.cpp"
+  "$ROOT_DIR/lib/ZipFile/ZipFile.cpp"
+  "$I18N_DIR/I18nStrings.cpp"
+)
+
+C_SOURCES=(
+  "$ROOT_DIR/lib/picojpeg/picojpeg.c"
+  "$ROOT_DIR/lib/uzlib/src/tinflate.c"
+  "$ROOT_DIR/lib/expat/xmlparse.c"
+  "$ROOT_DIR/lib/expat/xmlrole.c"
+  "$ROOT_DIR/lib/expat/xmltok.c"
+)
+
+INCLUDES=(
+  -I"$I18N_DIR"
+  -I"$ROOT_DIR/test/host"
+  -I"$ROOT_DIR/src"
+  -I"$ROOT_DIR/lib"
+  -I"$ROOT_DIR/lib/Epub"
+  -I"$ROOT_DIR/lib/hal"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/lib/I18n"
+  -I"$ROOT_DIR/lib/InflateReader"
+  -I"$ROOT_DIR/lib/JpegToBmpConverter"
+  -I"$ROOT_DIR/lib/KOReaderSync"
+  -I"$ROOT_DIR/lib/OpdsParser"
+  -I"$ROOT_DIR/lib/PngToBmpConverter"
+  -I"$ROOT_DIR/lib/picojpeg"
+  -I"$ROOT_DIR/lib/uzlib/src"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/Txt"
+  -I"$ROOT_DIR/lib/Xtc"
+  -I"$ROOT_DIR/lib/ZipFile"
+  -I"$ROOT_DIR/lib/expat"
+)
+
+# HalGPIO without the hardware InputManager. The firmware logs to stdout like to the device's serial port, errors only
+# unless LOG_LEVEL is set.
+DEFINES=(
+  -DCROSSPOINT_EMULATED=1
+  -DCROSSPOINT_VERSION=\"host\"
+  -DENABLE_SERIAL_LOG
+  -DLOG_LEVEL="${LOG_LEVEL:-0}"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -ffunction-sections
+  -fdata-sections
+  -pthread
+  "${DEFINES[@]}"
+  "${INCLUDES[@]}"
+)
+
+CFLAGS=(
+  -O2
+  -ffunction-sections
+  -fdata-sections
+  # Same expat configuration as platformio.ini
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+  "${INCLUDES[@]}"
+)
+
+# The UI strings, generated like in the PlatformIO build
+mkdir -p "$I18N_DIR"
+python3 "$ROOT_DIR/scripts/gen_i18n.py" "$ROOT_DIR/lib/I18n/translations" "$I18N_DIR" >/dev/null
+
+OBJECTS=()
+for source in "${C_SOURCES[@]}"; do
+  object="$OBJ_DIR/$(basename "$source").o"
+  cc "${CFLAGS[@]}" -c "$source" -o "$object"
+  OBJECTS+=("$object")
+done
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${OBJECTS[@]}" -Wl,--gc-sections -o "$BINARY"
+
+# The test books, unless a book is given on the command line
+if [[ $# -eq 0 || "${!#}" != *.epub ]]; then
+  for epub in "$ROOT_DIR"/test/epubs/*.epub; do
+    echo "== $(basename "$epub")"
+    "$BINARY" -r "$BUILD_DIR/sd" "$@" "$epub"
+  done
+else
+  "$BINARY" -r "$BUILD_DIR/sd" "$@"
+fi
@@ -0,0 +1,510 @@
+#include <EpdFontFamily.h>
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <Epub/SectionPipeline.h>
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalGPIO.h>
+#include <HalStorage.h>
+#include <builtinFonts/all.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "CrossPointSettings.h"
+#include "HostPlatform.h"
+#include "MappedInputManager.h"
+#include "activities/Activity.h"
+#include "activities/ActivityManager.h"
+#include "activities/reader/EpubReaderActivity.h"
+#include "components/UITheme.h"
+#include "fontIds.h"
+#include "util/ButtonNavigator.h"
+
+// Runs the firmware's reader on the host. The activity manager opens the book through ReaderActivity into
+// EpubReaderActivity, as picking it in the library does, and scripted button presses reach the activity through
+// MappedInputManager. Rendering happens on the activity manager's render task and chapters are laid out on the
+// prefetcher's task, each on its own thread. The SD card is a host directory and the panel a RAM buffer. Reports the
+// time from each press until the render task has drawn it, and can write every displayed page as a PNG.
+
+namespace fs = std::filesystem;
+
+HalDisplay display;
+HalGPIO gpio;
+MappedInputManager mappedInputManager(gpio);
+GfxRenderer renderer(display);
+// Lives for the whole program like on the device: it must never be destroyed, so the simulator ends with _Exit
+ActivityManager activityManager(renderer, mappedInputManager);
+FontDecompressor fontDecompressor;
+
+// The default reader font and the UI fonts
+EpdFont bookerly14RegularFont(&bookerly_14_regular);
+EpdFont bookerly14BoldFont(&bookerly_14_bold);
+EpdFont bookerly14ItalicFont(&bookerly_14_italic);
+EpdFont bookerly14BoldItalicFont(&bookerly_14_bolditalic);
+EpdFontFamily bookerly14FontFamily(&bookerly14RegularFont, &bookerly14BoldFont, &bookerly14ItalicFont,
+                                   &bookerly14BoldItalicFont);
+EpdFont smallFont(&notosans_8_regular);
+EpdFontFamily smallFontFamily(&smallFont);
+EpdFont ui10RegularFont(&ubuntu_10_regular);
+EpdFont ui10BoldFont(&ubuntu_10_bold);
+EpdFontFamily ui10FontFamily(&ui10RegularFont, &ui10BoldFont);
+EpdFont ui12RegularFont(&ubuntu_12_regular);
+EpdFont ui12BoldFont(&ubuntu_12_bold);
+EpdFontFamily ui12FontFamily(&ui12RegularFont, &ui12BoldFont);
+
+namespace {
+
+// Name of ActivityManager's render task, see ActivityManager::begin()
+constexpr const char* RENDER_TASK = "ActivityManagerRender";
+
+struct StageStats {
+  int count = 0;
+  double totalMs = 0;
+  double maxMs = 0;
+};
+
+std::map<std::string, StageStats> stages;
+std::vector<std::string> stageOrder;
+
+// Adds the time since `start` to a stage and returns it in milliseconds
+double record(const std::string& stage, const std::chrono::steady_clock::time_point start) {
+  const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  auto [it, inserted] = stages.try_emplace(stage);
+  if (inserted) stageOrder.push_back(stage);
+  it->second.count++;
+  it->second.totalMs += ms;
+  if (ms > it->second.maxMs) it->second.maxMs = ms;
+  return ms;
+}
+
+// The panel as it looks after the latest refresh, in portrait orientation, 2 bits per pixel (0 black .. 3 white)
+constexpr int SCREEN_WIDTH = HalDisplay::DISPLAY_HEIGHT;
+constexpr int SCREEN_HEIGHT = HalDisplay::DISPLAY_WIDTH;
+std::vector<uint8_t> screen(SCREEN_WIDTH * SCREEN_HEIGHT, 3);
+int refreshCount = 0;
+
+void onRefresh(const uint8_t* frame, const uint8_t* lsb, const uint8_t* msb) {
+  refreshCount++;
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    for (int x = 0; x < SCREEN_WIDTH; x++) {
+      // Inverse of GfxRenderer's portrait rotation
+      const int phyX = y;
+      const int phyY = HalDisplay::DISPLAY_HEIGHT - 1 - x;
+      const uint32_t index = phyY * HalDisplay::DISPLAY_WIDTH_BYTES + phyX / 8;
+      const uint8_t mask = 0x80 >> (phyX % 8);
+      uint8_t level = (frame[index] & mask) ? 3 : 0;
+      // The gray passes flag the pixels they update: both planes for dark gray, the MSB plane alone for light gray
+      if (msb && (msb[index] & mask)) {
+        level = (lsb[index] & mask) ? 1 : 2;
+      }
+      screen[y * SCREEN_WIDTH + x] = level;
+    }
+  }
+}
+
+uint32_t crc32(const uint8_t* data, const size_t length, uint32_t crc = 0) {
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+void appendBigEndian(std::vector<uint8_t>& out, const uint32_t value) {
+  out.push_back(value >> 24);
+  out.push_back(value >> 16);
+  out.push_back(value >> 8);
+  out.push_back(value);
+}
+
+void appendChunk(std::vector<uint8_t>& png, const char* type, const std::vector<uint8_t>& data) {
+  appendBigEndian(png, data.size());
+  const size_t typeStart = png.size();
+  png.insert(png.end(), type, type + 4);
+  png.insert(png.end(), data.begin(), data.end());
+  appendBigEndian(png, crc32(png.data() + typeStart, png.size() - typeStart));
+}
+
+// Writes the screen as a 2-bit grayscale PNG. The image data is zlib-wrapped with stored deflate blocks, which keeps
+// the writer free of a compressor; a page is about 100KB.
+bool writePng(const std::string& path) {
+  std::vector<uint8_t> raw;
+  const int rowBytes = SCREEN_WIDTH / 4;
+  raw.reserve((rowBytes + 1) * SCREEN_HEIGHT);
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    raw.push_back(0);  // Filter: none
+    for (int x = 0; x < SCREEN_WIDTH; x += 4) {
+      const uint8_t* p = &screen[y * SCREEN_WIDTH + x];
+      raw.push_back(p[0] << 6 | p[1] << 4 | p[2] << 2 | p[3]);
+    }
+  }
+
+  std::vector<uint8_t> zlib = {0x78, 0x01};
+  for (size_t offset = 0; offset < raw.size();) {
+    const size_t length = std::min<size_t>(raw.size() - offset, 0xFFFF);
+    const bool last = offset + length == raw.size();
+    zlib.push_back(last ? 1 : 0);
+    zlib.push_back(length & 0xFF);
+    zlib.push_back(length >> 8);
+    zlib.push_back(~length & 0xFF);
+    zlib.push_back((~length >> 8) & 0xFF);
+    zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+    offset += length;
+  }
+  uint32_t a = 1, b = 0;
+  for (const uint8_t byte : raw) {
+    a = (a + byte) % 65521;
+    b = (b + a) % 65521;
+  }
+  appendBigEndian(zlib, b << 16 | a);
+
+  std::vector<uint8_t> header;
+  appendBigEndian(header, SCREEN_WIDTH);
+  appendBigEndian(header, SCREEN_HEIGHT);
+  header.insert(header.end(), {2, 0, 0, 0, 0});  // Bit depth 2, grayscale, deflate, adaptive filtering, no interlace
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  appendChunk(png, "IHDR", header);
+  appendChunk(png, "IDAT", zlib);
+  appendChunk(png, "IEND", {});
+
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  if (!file) return false;
+  const bool ok = std::fwrite(png.data(), 1, png.size(), file) == png.size();
+  std::fclose(file);
+  return ok;
+}
+
+// Spans of the section build stages (SectionPipeline), reported from the pipeline's threads
+struct TraceEvent {
+  const char* stage;
+  unsigned long startMicros;
+  unsigned long endMicros;
+};
+std::mutex traceMutex;
+std::vector<TraceEvent> traceEvents;
+std::vector<std::pair<const char*, double>> pipelineBusyMs;  // Per stage, since the last section build
+
+void onPipelineSpan(const char* stage, const unsigned long startMicros, const unsigned long endMicros) {
+  std::lock_guard<std::mutex> lock(traceMutex);
+  traceEvents.push_back({stage, startMicros, endMicros});
+  auto it = std::find_if(pipelineBusyMs.begin(), pipelineBusyMs.end(),
+                         [stage](const auto& entry) { return std::strcmp(entry.first, stage) == 0; });
+  if (it == pipelineBusyMs.end()) it = pipelineBusyMs.insert(it, {stage, 0.0});
+  it->second += (endMicros - startMicros) / 1000.0;
+}
+
+// Busy time of each stage since the previous call, e.g. "inflate 1.2, parse 3.4, write 0.5 ms busy". When the stages
+// overlap their sum exceeds the wall time of the build.
+std::string takePipelineBusy() {
+  std::lock_guard<std::mutex> lock(traceMutex);
+  std::string summary;
+  for (auto& [stage, ms] : pipelineBusyMs) {
+    char part[48];
+    std::snprintf(part, sizeof(part), "%s%s %.1f", summary.empty() ? "" : ", ", stage, ms);
+    summary += part;
+    ms = 0;
+  }
+  return summary + " ms busy";
+}
+
+// Writes the spans in the Chrome trace event format (chrome://tracing, Perfetto), one row per stage
+bool writeTrace(const std::string& path) {
+  std::FILE* file = std::fopen(path.c_str(), "w");
+  if (!file) return false;
+  std::lock_guard<std::mutex> lock(traceMutex);
+  std::vector<const char*> rows;
+  std::fprintf(file, R"({"traceEvents": [)" "\n");
+  for (size_t i = 0; i < traceEvents.size(); i++) {
+    const TraceEvent& event = traceEvents[i];
+    auto row = std::find_if(rows.begin(), rows.end(),
+                            [&event](const char* stage) { return std::strcmp(stage, event.stage) == 0; });
+    if (row == rows.end()) row = rows.insert(row, event.stage);
+    std::fprintf(file, R"(  {"name": "%s", "ph": "X", "pid": 1, "tid": %d, "ts": %lu, "dur": %lu},)" "\n",
+                 event.stage, static_cast<int>(row - rows.begin()), event.startMicros,
+                 event.endMicros - event.startMicros);
+  }
+  for (size_t i = 0; i < rows.size(); i++) {
+    std::fprintf(file, R"(  {"name": "thread_name", "ph": "M", "pid": 1, "tid": %d, "args": {"name": "%s"}}%s)" "\n",
+                 static_cast<int>(i), rows[i], i + 1 < rows.size() ? "," : "");
+  }
+  std::fprintf(file, "]}\n");
+  return std::fclose(file) == 0;
+}
+
+// Parses a script such as "right*20,left:800,down": button names, an optional hold time in ms and a repeat count
+bool queueScript(const std::string& script) {
+  static const std::map<std::string, uint8_t> buttons = {
+      {"back", HalGPIO::BTN_BACK}, {"confirm", HalGPIO::BTN_CONFIRM}, {"left", HalGPIO::BTN_LEFT},
+      {"right", HalGPIO::BTN_RIGHT}, {"up", HalGPIO::BTN_UP}, {"down", HalGPIO::BTN_DOWN},
+      {"power", HalGPIO::BTN_POWER}};
+  size_t start = 0;
+  while (start < script.size()) {
+    size_t end = script.find(',', start);
+    if (end == std::string::npos) end = script.size();
+    std::string token = script.substr(start, end - start);
+    start = end + 1;
+
+    int repeat = 1;
+    unsigned long heldMs = 0;
+    if (const size_t star = token.find('*'); star != std::string::npos) {
+      repeat = std::atoi(token.c_str() + star + 1);
+      token.resize(star);
+    }
+    if (const size_t colon = token.find(':'); colon != std::string::npos) {
+      heldMs = std::strtoul(token.c_str() + colon + 1, nullptr, 10);
+      token.resize(colon);
+    }
+    const auto button = buttons.find(token);
+    if (button == buttons.end() || repeat < 1) {
+      std::fprintf(stderr, "unknown key in script: %s\n", token.c_str());
+      return false;
+    }
+    for (int i = 0; i < repeat; i++) {
+      HostPlatform::queueButtonPress(button->second, heldMs);
+    }
+  }
+  return true;
+}
+
+// Position the reader stored with its latest render (EpubReaderActivity::saveProgress). The page count is 0 while the
+// chapter is still being indexed.
+struct Position {
+  int spineIndex = -1;
+  int page = 0;
+  int pageCount = 0;
+
+  bool operator==(const Position& other) const = default;
+};
+
+Position readPosition(const std::string& cachePath) {
+  Position position;
+  FsFile file;
+  if (!Storage.openFileForRead("SIM", cachePath + "/progress.bin", file)) return position;
+  uint8_t data[6] = {};
+  const int length = file.read(data, sizeof(data));
+  file.close();
+  if (length >= 4) {
+    position.spineIndex = data[0] | data[1] << 8;
+    position.page = data[2] | data[3] << 8;
+  }
+  if (length == 6) position.pageCount = data[4] | data[5] << 8;
+  return position;
+}
+
+// Makes the reader open the book at the start of a spine item, as if it had last been read there
+bool writePosition(const Epub& epub, const int spineIndex) {
+  epub.setupCacheDir();
+  FsFile file;
+  if (!Storage.openFileForWrite("SIM", epub.getCachePath() + "/progress.bin", file)) return false;
+  const uint8_t data[4] = {static_cast<uint8_t>(spineIndex & 0xFF), static_cast<uint8_t>(spineIndex >> 8), 0, 0};
+  const bool ok = file.write(data, sizeof(data)) == sizeof(data);
+  file.close();
+  return ok;
+}
+
+// Builds each chapter the reader turned to, without a prefetcher: the time a chapter turn took when the reader
+// built the chapter after the press. The book's cache under a root of its own stays apart from the reader's.
+void compareSynchronousBuilds(const std::string& sdBookPath, const std::vector<std::pair<int, double>>& chapterTurns) {
+  auto epub = std::make_shared<Epub>(sdBookPath, "/.crosspoint-sim");
+  epub->clearCache();
+  if (!epub->load(true, SETTINGS.embeddedStyle == 0)) {
+    std::fprintf(stderr, "failed to load %s\n", sdBookPath.c_str());
+    return;
+  }
+  epub->loadResidentTables();
+
+  const SectionPrefetcher::Layout layout = EpubReaderActivity::settingsLayout(renderer);
+  std::printf("%-8s %16s %16s\n", "section", "chapter turn ms", "section build ms");
+  for (const auto& [spineIndex, turnMs] : chapterTurns) {
+    Section section(epub, spineIndex, renderer);
+    const auto start = std::chrono::steady_clock::now();
+    if (!section.createSectionFile(layout.fontId, layout.lineCompression, layout.extraParagraphSpacing,
+                                   layout.paragraphAlignment, layout.viewportWidth, layout.viewportHeight,
+                                   layout.hyphenationEnabled, layout.embeddedStyle)) {
+      std::fprintf(stderr, "failed to build section %d\n", spineIndex);
+      continue;
+    }
+    const double buildMs = record("section build", start);
+    std::printf("%-8d %16.1f %16.1f\n", spineIndex, turnMs, buildMs);
+  }
+  epub->clearCache();
+}
+
+// The activity part of the main loop in main.cpp, then waits for the render task to draw what was requested
+void runActivities() {
+  activityManager.loop();
+  HostPlatform::waitForTaskIdle(RENDER_TASK);
+}
+
+int run(int argc, char** argv) {
+  // The serial log goes to stdout; keep it in step with the report and with stderr
+  std::setvbuf(stdout, nullptr, _IOLBF, BUFSIZ);
+  std::string sdRoot = "sd";
+  std::string outputDir;
+  std::string script = "right*10";
+  std::string bookPath;
+  std::string tracePath;
+  bool cold = false;
+  bool hyphenation = false;
+  bool compare = false;
+  int startSpine = 0;
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "-r" && i + 1 < argc) {
+      sdRoot = argv[++i];
+    } else if (arg == "-o" && i + 1 < argc) {
+      outputDir = argv[++i];
+    } else if (arg == "-k" && i + 1 < argc) {
+      script = argv[++i];
+    } else if (arg == "-t" && i + 1 < argc) {
+      tracePath = argv[++i];
+    } else if (arg == "-s" && i + 1 < argc) {
+      startSpine = std::atoi(argv[++i]);
+    } else if (arg == "-c") {
+      cold = true;
+    } else if (arg == "-b") {
+      compare = true;
+    } else if (arg == "-h") {
+      hyphenation = true;
+    } else {
+      bookPath = arg;
+    }
+  }
+  if (bookPath.empty() || !queueScript(script)) {
+    std::fprintf(stderr,
+                 "usage: %s [-r sd-root] [-o png-dir] [-k script] [-s spine-index] [-t trace.json] [-b] [-c] [-h] "
+                 "book.epub\n"
+                 "  script: comma separated back|confirm|left|right|up|down|power[:held-ms][*repeat]\n"
+                 "  -t: write the section build stages as a Chrome trace, -c: drop the book's cache first,\n"
+                 "  -b: compare each chapter turn with building the chapter after the press, as without\n"
+                 "  prefetching, -h: hyphenation on\n",
+                 argv[0]);
+    return 1;
+  }
+
+  // The book is read from the SD root like any other book on the card
+  HostPlatform::setStorageRoot(sdRoot);
+  if (!Storage.begin()) {
+    std::fprintf(stderr, "cannot use %s as SD root\n", sdRoot.c_str());
+    return 1;
+  }
+  const std::string sdBookPath = "/" + fs::path(bookPath).filename().string();
+  std::error_code ec;
+  fs::copy_file(bookPath, fs::path(sdRoot) / fs::path(bookPath).filename(), fs::copy_options::update_existing, ec);
+  if (!outputDir.empty()) fs::create_directories(outputDir, ec);
+
+  // Setup in main.cpp, with the default settings: the host has no JSON support to read them from the card
+  gpio.begin();
+  display.begin();
+  renderer.begin();
+  activityManager.begin();
+  HostPlatform::setRefreshHook(onRefresh);
+  SectionPipeline::setTraceHook(onPipelineSpan);
+  if (!fontDecompressor.init()) {
+    std::fprintf(stderr, "Font decompressor init failed\n");
+    return 1;
+  }
+  renderer.setFontDecompressor(&fontDecompressor);
+  renderer.insertFont(BOOKERLY_14_FONT_ID, bookerly14FontFamily);
+  renderer.insertFont(UI_10_FONT_ID, ui10FontFamily);
+  renderer.insertFont(UI_12_FONT_ID, ui12FontFamily);
+  renderer.insertFont(SMALL_FONT_ID, smallFontFamily);
+  SETTINGS.hyphenationEnabled = hyphenation;
+  UITheme::getInstance().reload();
+  ButtonNavigator::setMappedInputManager(mappedInputManager);
+
+  // Only used for its cache location; the reader loads its own instance
+  Epub book(sdBookPath, "/.crosspoint");
+  if (cold) book.clearCache();
+  if (startSpine > 0 && !writePosition(book, startSpine)) {
+    std::fprintf(stderr, "cannot store the start position\n");
+    return 1;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  activityManager.goToReader(sdBookPath);
+  runActivities();
+  const double openMs = record("open", start);
+  Position position = readPosition(book.getCachePath());
+  if (position.spineIndex < 0) {
+    std::fprintf(stderr, "failed to open %s\n", bookPath.c_str());
+    return 1;
+  }
+  std::printf("%s: section %d page %d shown %.1f ms after opening\n", sdBookPath.c_str() + 1, position.spineIndex,
+              position.page + 1, openMs);
+
+  int frame = 0;
+  const auto savePage = [&]() {
+    if (outputDir.empty()) return;
+    char name[64];
+    std::snprintf(name, sizeof(name), "/%04d-s%03d-p%03d.png", frame, position.spineIndex, position.page);
+    if (!writePng(outputDir + name)) std::fprintf(stderr, "cannot write %s%s\n", outputDir.c_str(), name);
+  };
+  savePage();
+
+  // One loop iteration per scripted press
+  std::vector<std::pair<int, double>> chapterTurns;
+  while (HostPlatform::hasQueuedButtonPresses()) {
+    const int refreshesBefore = refreshCount;
+    start = std::chrono::steady_clock::now();
+    gpio.update();
+    runActivities();
+    if (refreshCount == refreshesBefore) continue;
+
+    const Position previous = position;
+    position = readPosition(book.getCachePath());
+    if (position.spineIndex != previous.spineIndex) {
+      const double ms = record("chapter turn", start);
+      chapterTurns.emplace_back(position.spineIndex, ms);
+      std::printf("  section %d: page %d shown %.1f ms after the press (%s)\n", position.spineIndex,
+                  position.page + 1, ms, takePipelineBusy().c_str());
+    } else {
+      record(position == previous ? "other input" : "page turn", start);
+    }
+    frame++;
+    savePage();
+  }
+
+  std::printf("%d refreshes, now at section %d page %d/%d\n", refreshCount, position.spineIndex, position.page + 1,
+              position.pageCount);
+
+  // Leave the reader like the device does before sleeping, so a background build is cancelled rather than cut off
+  activityManager.goToFullScreenMessage("");
+  runActivities();
+  if (compare) compareSynchronousBuilds(sdBookPath, chapterTurns);
+
+  std::printf("%-14s %6s %10s %10s %10s\n", "stage", "count", "total ms", "mean ms", "max ms");
+  for (const auto& name : stageOrder) {
+    const StageStats& stats = stages[name];
+    std::printf("%-14s %6d %10.1f %10.2f %10.2f\n", name.c_str(), stats.count, stats.totalMs,
+                stats.totalMs / stats.count, stats.maxMs);
+  }
+
+  if (!tracePath.empty() && !writeTrace(tracePath)) {
+    std::fprintf(stderr, "cannot write %s\n", tracePath.c_str());
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int status = run(argc, argv);
+  std::fflush(nullptr);
+  std::_Exit(status);
+}
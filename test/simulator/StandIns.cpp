@@ -0,0 +1,74 @@
+#include <GfxRenderer.h>
+
+#include "JsonSettingsIO.h"
+#include "KOReaderCredentialStore.h"
+#include "activities/ActivityManager.h"
+#include "activities/browser/OpdsBookBrowserActivity.h"
+#include "activities/network/CrossPointWebServerActivity.h"
+#include "activities/reader/KOReaderSyncActivity.h"
+#include "activities/settings/SettingsActivity.h"
+#include "util/QrUtils.h"
+
+// Replacements for the parts of the firmware the simulator cannot build on the host: they need the network stack or
+// PlatformIO registry packages (ArduinoJson, QRCode, MD5Builder) that are not part of the tree. The activity manager
+// still links every activity it can launch, so these stand in for the network ones and return as soon as they are
+// entered.
+
+// Settings, reading state and recent books stay in memory: nothing is read from or written to the card
+bool JsonSettingsIO::saveSettings(const CrossPointSettings&, const char*) { return true; }
+bool JsonSettingsIO::loadSettings(CrossPointSettings&, const char*, bool*) { return false; }
+bool JsonSettingsIO::saveState(const CrossPointState&, const char*) { return true; }
+bool JsonSettingsIO::loadState(CrossPointState&, const char*) { return false; }
+bool JsonSettingsIO::saveWifi(const WifiCredentialStore&, const char*) { return true; }
+bool JsonSettingsIO::loadWifi(WifiCredentialStore&, const char*, bool*) { return false; }
+bool JsonSettingsIO::saveKOReader(const KOReaderCredentialStore&, const char*) { return true; }
+bool JsonSettingsIO::loadKOReader(KOReaderCredentialStore&, const char*, bool*) { return false; }
+bool JsonSettingsIO::saveRecentBooks(const RecentBooksStore&, const char*) { return true; }
+bool JsonSettingsIO::loadRecentBooks(RecentBooksStore&, const char*) { return false; }
+
+// No sync account, so the reader menu's sync entry does nothing
+KOReaderCredentialStore KOReaderCredentialStore::instance;
+bool KOReaderCredentialStore::hasCredentials() const { return false; }
+
+// The code's frame in place of the code
+void QrUtils::drawQrCode(const GfxRenderer& renderer, const Rect& bounds, const std::string&) {
+  renderer.drawRect(bounds.x, bounds.y, bounds.width, bounds.height);
+}
+
+// Never started, only destroyed with its activity
+CrossPointWebServer::~CrossPointWebServer() = default;
+
+void CrossPointWebServerActivity::onEnter() {
+  Activity::onEnter();
+  activityManager.goHome();
+}
+void CrossPointWebServerActivity::onExit() { Activity::onExit(); }
+void CrossPointWebServerActivity::loop() {}
+void CrossPointWebServerActivity::render(RenderLock&&) {}
+
+void OpdsBookBrowserActivity::onEnter() {
+  Activity::onEnter();
+  activityManager.goHome();
+}
+void OpdsBookBrowserActivity::onExit() { Activity::onExit(); }
+void OpdsBookBrowserActivity::loop() {}
+void OpdsBookBrowserActivity::render(RenderLock&&) {}
+
+void SettingsActivity::onEnter() {
+  Activity::onEnter();
+  activityManager.goHome();
+}
+void SettingsActivity::onExit() { Activity::onExit(); }
+void SettingsActivity::loop() {}
+void SettingsActivity::render(RenderLock&&) {}
+
+void KOReaderSyncActivity::onEnter() {
+  Activity::onEnter();
+  ActivityResult cancelled;
+  cancelled.isCancelled = true;
+  setResult(std::move(cancelled));
+  finish();
+}
+void KOReaderSyncActivity::onExit() { Activity::onExit(); }
+void KOReaderSyncActivity::loop() {}
+void KOReaderSyncActivity::render(RenderLock&&) {}